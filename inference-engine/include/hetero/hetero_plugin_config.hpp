@@ -31,6 +31,12 @@ namespace HeteroConfigParams {
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
+/**
+ * @def HETERO_CONFIG_VALUE(name)
+ * @brief Shortcut for defining HETERO configuration values
+ */
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
+
 /**
  * @brief The key for enabling of dumping the topology with details of layers and details how
  * this network would be executed on different devices to the disk in GraphViz format.
@@ -38,5 +44,35 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipelined execution of the subnetworks.
+ * Each subnetwork is a stage which starts the subnetwork request of the next hetero infer request as soon as
+ * the previous one is completed, so the devices work on different infer requests at the same time.
+ * The subnetworks are loaded with CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS) disabled.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE);
+
+/**
+ * @brief The key for choosing of the policy which assigns layers without affinity to the devices.
+ * This option should be used with values:
+ * HETERO_CONFIG_VALUE(PRIORITY) (default) - a layer is assigned to the first device in TARGET_FALLBACK supporting it
+ * HETERO_CONFIG_VALUE(COST_MODEL) - the network is profiled on each of the devices using performance counters and
+ * the layers are assigned to minimize the estimated latency including the transfers of data between subgraphs.
+ * The transfer time is estimated by the bandwidth of copying of the host memory measured on the network load.
+ * The chosen partition is reported by ExecutableNetwork::GetExecGraphInfo()
+ */
+DECLARE_HETERO_CONFIG_KEY(AFFINITY_MODE);
+DECLARE_HETERO_CONFIG_VALUE(PRIORITY);
+DECLARE_HETERO_CONFIG_VALUE(COST_MODEL);
+
+/**
+ * @brief The key for setting of the maximal number of subgraphs produced by HETERO_CONFIG_VALUE(COST_MODEL)
+ * affinity mode. A network, which has disconnected parts, may still be split into more subgraphs if all its layers
+ * are assigned to one device.
+ * This option should be used with positive integer values, default is "4"
+ */
+DECLARE_HETERO_CONFIG_KEY(MAX_SUBGRAPHS);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -343,4 +343,73 @@ public:
      */
     const Blob::Ptr& v() const noexcept;
 };
+
+/**
+ * @brief Represents a batch of images, each one is a separate blob
+ *
+ * Underlying blobs are typically ROI blobs of the same source frame (see make_shared_blob(blob, roi)), which may
+ * have different sizes. When set as an input with a resize algorithm specified, every image is resized into
+ * the corresponding item of the network's input batch in one pre-processing call.
+ */
+class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the BatchedBlob object
+     */
+    using Ptr = std::shared_ptr<BatchedBlob>;
+
+    /**
+     * @brief A smart pointer to the const BatchedBlob object
+     */
+    using CPtr = std::shared_ptr<const BatchedBlob>;
+
+    /**
+     * @brief A deleted default constructor
+     */
+    BatchedBlob() = delete;
+
+    /**
+     * @brief Constructs a batched blob from a vector of images
+     *
+     * All images must be 4D memory blobs with batch size 1 and the same precision, layout and number of channels.
+     *
+     * @param blobs A vector of blobs that is copied to this object
+     */
+    explicit BatchedBlob(const std::vector<Blob::Ptr>& blobs);
+
+    /**
+     * @brief Constructs a batched blob from a vector of images
+     *
+     * All images must be 4D memory blobs with batch size 1 and the same precision, layout and number of channels.
+     *
+     * @param blobs A vector of blobs that is moved to this object
+     */
+    explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
+
+    /**
+     * @brief A virtual destructor. It is made out of line for RTTI to
+     * work correctly on some platforms.
+     */
+    virtual ~BatchedBlob();
+
+    /**
+     * @brief A copy constructor
+     */
+    BatchedBlob(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A copy assignment operator
+     */
+    BatchedBlob& operator=(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A move constructor
+     */
+    BatchedBlob(BatchedBlob&& blob) = default;
+
+    /**
+     * @brief A move assignment operator
+     */
+    BatchedBlob& operator=(BatchedBlob&& blob) = default;
+};
 }  // namespace InferenceEngine
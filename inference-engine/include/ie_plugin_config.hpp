@@ -12,6 +12,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -151,11 +153,59 @@ DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_NAME, std::string);
  */
 DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 
+/**
+ * @brief Metric to get a number of bytes of weights memory the CPU plugin does not allocate because
+ * identical weights are shared between layers, streams and networks loaded in the process.
+ * String value is "CPU_WEIGHTS_SHARING_BYTES_SAVED"
+ */
+DECLARE_METRIC_KEY(CPU_WEIGHTS_SHARING_BYTES_SAVED, uint64_t);
+
 /**
  * @brief Metric to get an unsigned integer value of optimal number of executable network infer requests.
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a histogram of request batches executed by the CPU executable network with
+ * CPU_REQUESTS_BATCH_SIZE config enabled. i-th element is a number of executed batches of `i + 1` requests.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_REQUESTS_BATCH_SIZE_HISTOGRAM, std::vector<unsigned int>);
+
+/**
+ * @brief Metric to get per-node executions kept by the CPU executable network with CPU_TRACE_BUFFER_SIZE
+ * config enabled, in the Chrome trace JSON format (can be opened in chrome://tracing).
+ *
+ * Each node event has the executing thread, the implementation type, the size of node inputs and outputs,
+ * the time the node waited for its predecessors after they had been finished and the critical path mark.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_TRACE, std::string);
+
+/**
+ * @brief Metrics to get the number of infer requests executed by the CPU executable network with
+ * CPU_SHAPES_CACHE_SIZE config enabled by a cached network compiled for the shapes of the inputs (hits),
+ * by a cached network compiled for greater spatial dimensions (padded hits) and the number of
+ * networks compiled for new shapes (misses).
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPES_CACHE_HITS, uint64_t);
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPES_CACHE_PADDED_HITS, uint64_t);
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPES_CACHE_MISSES, uint64_t);
+
+/**
+ * @brief Metric to get the total time in milliseconds spent by the CPU executable network with
+ * CPU_SHAPES_CACHE_SIZE config enabled to compile the networks for all the shapes.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPES_CACHE_COMPILE_TIME, float);
+
+/**
+ * @brief Metric to get the size in bytes of the memory shared by the intermediate blobs of the CPU executable
+ * network per placement strategy.
+ *
+ * The map contains the strategy used by the network ("CPU_MEMORY_REUSE_SIZE_FIRST", etc.) or all the strategies
+ * with CPU_MEMORY_REUSE_MIN config value, and "LOWER_BOUND", the maximal size of blobs alive at the same time,
+ * which no strategy can go below.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_MEMORY_REUSE_REPORT, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
@@ -217,6 +267,89 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief The name for enabling parallel execution of independent graph branches on the CPU.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES (nodes which do not depend on each other are executed concurrently,
+ * the threads of the stream are split between the branches that are ready to run)
+ * PluginConfigParams::NO (default, nodes are executed one by one in the topological order)
+ * The option takes effect only if the OpenVINO is compiled with TBB threading.
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief The name for setting the maximal number of infer requests which are combined by the CPU
+ * executable network into a single batched inference.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * "1" (default, requests are executed independently) or an integer number greater than one.
+ * The network is loaded with the batch multiplied by this value, so all the network inputs and outputs
+ * must have the batch as the first dimension.
+ */
+DECLARE_CONFIG_KEY(CPU_REQUESTS_BATCH_SIZE);
+
+/**
+ * @brief The name for setting the time in microseconds the CPU executable network waits for a batch
+ * of infer requests to be filled before the partial batch is executed.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork() together with CPU_REQUESTS_BATCH_SIZE.
+ * "0" (default) means that the requests which are waiting at the moment a worker becomes available
+ * are executed as a batch immediately.
+ */
+DECLARE_CONFIG_KEY(CPU_REQUESTS_BATCH_TIMEOUT);
+
+/**
+ * @brief The name for setting the number of node executions kept by each CPU plugin graph (stream)
+ * for the CPU_TRACE executable network metric.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * "0" (default, tracing is disabled) or a positive integer number. The oldest executions are overwritten
+ * when the buffer is full.
+ */
+DECLARE_CONFIG_KEY(CPU_TRACE_BUFFER_SIZE);
+
+/**
+ * @brief The name for setting the maximal number of networks compiled by the CPU executable network
+ * for different shapes of infer request inputs.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * "0" (default, input blobs must have the shapes the network is loaded with) or a positive integer number.
+ * A network for new input shapes is reshaped and compiled in the background, the least recently used
+ * networks are evicted. The weights are shared by all the compiled networks.
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPES_CACHE_SIZE);
+
+/**
+ * @brief The name for setting whether an infer request, which inputs have no compiled network yet,
+ * may be executed by a cached network with greater spatial dimensions.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork() together with CPU_SHAPES_CACHE_SIZE, this option
+ * should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default). The inputs are padded
+ * by zeros at the end of spatial dimensions and the outputs are cropped, so it is valid for fully convolutional
+ * networks with planar layouts only. The option is ignored, i.e. the requests wait for the network compiled for
+ * their shapes, if the network reduces or normalizes the spatial dimensions (e.g. global pooling, softmax or
+ * reductions over them) or if its convolutions or poolings read the padded area as non-zero values.
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPES_CACHE_PADDING);
+
+/**
+ * @brief The name for setting the strategy of placement of the intermediate blobs into the memory shared by
+ * the CPU plugin graph.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * CPU_MEMORY_REUSE_SIZE_FIRST (default, the biggest blobs are placed first to the lowest free address),
+ * CPU_MEMORY_REUSE_LIFETIME_FIRST (the longest living blobs are placed first to the lowest free address),
+ * CPU_MEMORY_REUSE_BEST_FIT (the biggest blobs are placed first to the smallest free gap they fit in) or
+ * CPU_MEMORY_REUSE_MIN (all the strategies are tried, the one with the smallest memory size is used).
+ * The resulting sizes are reported by the CPU_MEMORY_REUSE_REPORT executable network metric.
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_REUSE_STRATEGY);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_REUSE_SIZE_FIRST);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_REUSE_LIFETIME_FIRST);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_REUSE_BEST_FIT);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_REUSE_MIN);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -360,5 +493,17 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief This key defines the directory used by InferenceEngine::Core to cache compiled networks.
+ *
+ * Should be passed into InferenceEngine::Core::SetConfig without a device name, the directory is shared by
+ * all devices and SetConfig throws if a device name is given. When the value is a non-empty directory path,
+ * Core::LoadNetwork computes a hash of the network, the device name and the load configuration and imports
+ * a previously exported network from `<dir>/<hash>.blob` if it exists. Otherwise the network is compiled as
+ * usual and exported into the cache for devices which support the ImportNetwork / Export API.
+ * An empty value disables caching. The directory must exist.
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
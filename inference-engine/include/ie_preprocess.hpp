@@ -21,7 +21,10 @@ namespace InferenceEngine {
  * @brief This structure stores info about pre-processing of network inputs (scale, mean image, ...)
  */
 struct PreProcessChannel {
-    /** @brief Scale parameter for a channel */
+    /**
+     * @brief Scale parameter for a channel, the input is multiplied by it after the mean subtraction.
+     * The CPU plugin applies it only to inputs normalized by the G-API pre-processing
+     */
     float stdScale = 1;
 
     /** @brief Mean value for a channel */
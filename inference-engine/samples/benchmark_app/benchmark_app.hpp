@@ -79,9 +79,24 @@ static const char report_type_message[] = "Optional. Enable collecting statistic
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
+// @brief message for json_stats option
+static const char json_stats_message[] = "Optional. Dump statistics report in JSON format to benchmark_report.json located in the path "
+                                         "specified in -report_folder. The report includes latency percentiles, latency histogram "
+                                         "and throughput time series.";
+
+// @brief message for throughput_interval option
+static const char throughput_interval_message[] = "Optional. Interval in milliseconds used to collect throughput time series "
+                                                  "for the statistics report. Default value is 1000.";
+
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
+// @brief message for rate option
+static const char rate_message[] = "Optional. Target arrival rate of infer requests per second for the open-loop load generation "
+                                   "in the Async mode. Infer requests are started on a fixed schedule regardless of completions "
+                                   "and latency includes time spent waiting for an idle infer request. "
+                                   "If not specified, the closed-loop mode is used.";
+
 // @brief message for progress bar option
 static const char progress_message[] = "Optional. Show progress bar (can affect performance measurement). Default values is \"false\".";
 
@@ -167,9 +182,18 @@ DEFINE_string(report_type, "", report_type_message);
 /// @brief Path to a folder where statistics report is stored
 DEFINE_string(report_folder, "", report_folder_message);
 
+/// @brief Enables dumping of statistics report in JSON format
+DEFINE_bool(json_stats, false, json_stats_message);
+
+/// @brief Interval in milliseconds to collect throughput time series
+DEFINE_uint32(throughput_interval, 1000, throughput_interval_message);
+
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
+/// @brief Target arrival rate of infer requests per second (0 means closed-loop mode)
+DEFINE_double(rate, 0.0, rate_message);
+
 /// @brief Define flag for showing progress bar <br>
 DEFINE_bool(progress, false, progress_message);
 
@@ -212,6 +236,7 @@ static void showUsage() {
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
+    std::cout << "    -rate \"<double>\"          " << rate_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
@@ -221,6 +246,8 @@ static void showUsage() {
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
+    std::cout << "    -json_stats               " << json_stats_message << std::endl;
+    std::cout << "    -throughput_interval      " << throughput_interval_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
 #ifdef USE_OPENCV
@@ -16,6 +16,7 @@
 #include <functional>
 
 #include "inference_engine.hpp"
+#include "latency_recorder.hpp"
 #include "statistics_report.hpp"
 
 typedef std::chrono::high_resolution_clock Time;
@@ -41,8 +42,10 @@ public:
                 });
     }
 
-    void startAsync() {
-        _startTime = Time::now();
+    /// @param arrivalTime A time the request was scheduled to start at. Latency is measured from this point,
+    /// so time spent waiting for an idle request in the open-loop mode is accounted as well.
+    void startAsync(const Time::time_point& arrivalTime = Time::now()) {
+        _startTime = arrivalTime;
         _request.StartAsync();
     }
 
@@ -101,7 +104,7 @@ public:
     void resetTimes() {
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
-        _latencies.clear();
+        _latencies.reset();
     }
 
     double getDurationInMilliseconds() {
@@ -110,8 +113,8 @@ public:
 
     void putIdleRequest(size_t id,
                         const double latency) {
+        _latencies.record(latency);
         std::unique_lock<std::mutex> lock(_mutex);
-        _latencies.push_back(latency);
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -131,7 +134,7 @@ public:
         _cv.wait(lock, [this]{ return _idleIds.size() == requests.size(); });
     }
 
-    std::vector<double> getLatencies() {
+    const LatencyRecorder& getLatencies() const {
         return _latencies;
     }
 
@@ -143,5 +146,5 @@ private:
     std::condition_variable _cv;
     Time::time_point _startTime;
     Time::time_point _endTime;
-    std::vector<double> _latencies;
+    LatencyRecorder _latencies;
 };
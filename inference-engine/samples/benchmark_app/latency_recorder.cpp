@@ -0,0 +1,165 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "latency_recorder.hpp"
+
+namespace {
+
+unsigned getMostSignificantBit(uint64_t value) {
+    unsigned msb = 0;
+    while (value >>= 1) {
+        msb++;
+    }
+    return msb;
+}
+
+double toMilliseconds(uint64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) * 0.000001;
+}
+
+}  // namespace
+
+LatencyRecorder::LatencyRecorder() :
+    _bucketsCount((64 - precisionBits + 2) * subBucketsCount) {
+    _buckets.reset(new std::atomic<uint64_t>[_bucketsCount]);
+    reset();
+}
+
+size_t LatencyRecorder::getBucketIndex(uint64_t value) {
+    if (value < 2 * subBucketsCount) {
+        return static_cast<size_t>(value);
+    }
+    auto shift = getMostSignificantBit(value) - precisionBits + 1;
+    return static_cast<size_t>(shift * subBucketsCount + (value >> shift));
+}
+
+uint64_t LatencyRecorder::getBucketLowerBound(size_t index) {
+    if (index < 2 * subBucketsCount) {
+        return index;
+    }
+    auto shift = index / subBucketsCount - 1;
+    auto subBucket = index - shift * subBucketsCount;
+    return static_cast<uint64_t>(subBucket) << shift;
+}
+
+uint64_t LatencyRecorder::getBucketUpperBound(size_t index) {
+    if (index < 2 * subBucketsCount) {
+        return index;
+    }
+    auto shift = index / subBucketsCount - 1;
+    auto subBucket = index - shift * subBucketsCount;
+    return (static_cast<uint64_t>(subBucket + 1) << shift) - 1;
+}
+
+void LatencyRecorder::record(double latencyInMilliseconds) {
+    auto value = static_cast<uint64_t>(std::max(latencyInMilliseconds, 0.0) * 1000000.0);
+    _buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+
+    auto min = _min.load(std::memory_order_relaxed);
+    while (value < min && !_min.compare_exchange_weak(min, value, std::memory_order_relaxed)) {}
+    auto max = _max.load(std::memory_order_relaxed);
+    while (value > max && !_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+
+    _count.fetch_add(1, std::memory_order_release);
+}
+
+void LatencyRecorder::reset() {
+    for (size_t i = 0; i < _bucketsCount; i++) {
+        _buckets[i].store(0, std::memory_order_relaxed);
+    }
+    _sum.store(0, std::memory_order_relaxed);
+    _min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+    _count.store(0, std::memory_order_release);
+}
+
+uint64_t LatencyRecorder::getCount() const {
+    return _count.load(std::memory_order_acquire);
+}
+
+double LatencyRecorder::getMin() const {
+    return getCount() == 0 ? 0.0 : toMilliseconds(_min.load(std::memory_order_relaxed));
+}
+
+double LatencyRecorder::getMax() const {
+    return toMilliseconds(_max.load(std::memory_order_relaxed));
+}
+
+double LatencyRecorder::getAverage() const {
+    auto count = getCount();
+    return count == 0 ? 0.0 : toMilliseconds(_sum.load(std::memory_order_relaxed)) / count;
+}
+
+double LatencyRecorder::getPercentile(double percentile) const {
+    auto count = getCount();
+    if (count == 0) {
+        return 0.0;
+    }
+    auto rank = static_cast<uint64_t>(std::ceil(std::min(std::max(percentile, 0.0), 100.0) / 100.0 * count));
+    rank = std::max<uint64_t>(rank, 1);
+
+    auto min = _min.load(std::memory_order_relaxed);
+    auto max = _max.load(std::memory_order_relaxed);
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < _bucketsCount; i++) {
+        accumulated += _buckets[i].load(std::memory_order_relaxed);
+        if (accumulated >= rank) {
+            auto lower = getBucketLowerBound(i);
+            auto value = lower + (getBucketUpperBound(i) - lower) / 2;
+            return toMilliseconds(std::min(std::max(value, min), max));
+        }
+    }
+    return toMilliseconds(max);
+}
+
+std::vector<LatencyRecorder::Bucket> LatencyRecorder::getHistogram() const {
+    std::vector<Bucket> histogram;
+    for (size_t i = 0; i < _bucketsCount; i++) {
+        auto count = _buckets[i].load(std::memory_order_relaxed);
+        if (count != 0) {
+            histogram.push_back({toMilliseconds(getBucketLowerBound(i)), toMilliseconds(getBucketUpperBound(i)), count});
+        }
+    }
+    return histogram;
+}
+
+ThroughputTimeline::ThroughputTimeline(std::chrono::milliseconds interval) : _interval(interval) {}
+
+void ThroughputTimeline::start(Clock::time_point startTime, uint64_t completed) {
+    _startTime = startTime;
+    _intervalStartTime = startTime;
+    _intervalStartCompleted = completed;
+    _samples.clear();
+}
+
+void ThroughputTimeline::sample(Clock::time_point now, uint64_t completed) {
+    if (_interval.count() > 0 && now - _intervalStartTime >= _interval) {
+        addSample(now, completed);
+    }
+}
+
+void ThroughputTimeline::finish(Clock::time_point now, uint64_t completed) {
+    if (now > _intervalStartTime && completed != _intervalStartCompleted) {
+        addSample(now, completed);
+    }
+}
+
+const std::vector<ThroughputTimeline::Sample>& ThroughputTimeline::getSamples() const {
+    return _samples;
+}
+
+void ThroughputTimeline::addSample(Clock::time_point now, uint64_t completed) {
+    using ms = std::chrono::duration<double, std::milli>;
+    _samples.push_back({std::chrono::duration_cast<ms>(now - _startTime).count(),
+                        std::chrono::duration_cast<ms>(now - _intervalStartTime).count(),
+                        completed - _intervalStartCompleted});
+    _intervalStartTime = now;
+    _intervalStartCompleted = completed;
+}
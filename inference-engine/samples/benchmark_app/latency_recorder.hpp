@@ -0,0 +1,89 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/// @brief Lock-free latency histogram with bounded relative error.
+/// Latencies are stored in nanoseconds in log-linear buckets: values below 2^precisionBits are stored exactly,
+/// larger values are stored with relative error less than 2^(1 - precisionBits). Recording is a few relaxed
+/// atomic operations, so it can be done directly from infer request callbacks without a mutex.
+class LatencyRecorder final {
+public:
+    struct Bucket {
+        double lowerBound;  // ms
+        double upperBound;  // ms
+        uint64_t count;
+    };
+
+    LatencyRecorder();
+
+    void record(double latencyInMilliseconds);
+
+    void reset();
+
+    uint64_t getCount() const;
+    double getMin() const;
+    double getMax() const;
+    double getAverage() const;
+
+    /// @brief Returns an approximate latency value in milliseconds for a percentile in [0, 100] range
+    double getPercentile(double percentile) const;
+
+    /// @brief Returns all non-empty buckets in ascending order
+    std::vector<Bucket> getHistogram() const;
+
+private:
+    static constexpr unsigned precisionBits = 8;
+    static constexpr uint64_t subBucketsCount = 1ULL << (precisionBits - 1);
+
+    static size_t getBucketIndex(uint64_t value);
+    static uint64_t getBucketLowerBound(size_t index);
+    static uint64_t getBucketUpperBound(size_t index);
+
+    std::unique_ptr<std::atomic<uint64_t>[]> _buckets;
+    size_t _bucketsCount;
+    std::atomic<uint64_t> _count;
+    std::atomic<uint64_t> _sum;
+    std::atomic<uint64_t> _min;
+    std::atomic<uint64_t> _max;
+};
+
+/// @brief Collects number of completed infer requests per fixed time interval.
+/// Sampling is done by the thread which starts infer requests, so no synchronization is required.
+class ThroughputTimeline final {
+public:
+    using Clock = std::chrono::high_resolution_clock;
+
+    struct Sample {
+        double timeStamp;  // ms since start, end of the interval
+        double duration;   // ms
+        uint64_t completed;
+    };
+
+    explicit ThroughputTimeline(std::chrono::milliseconds interval);
+
+    void start(Clock::time_point startTime, uint64_t completed);
+
+    void sample(Clock::time_point now, uint64_t completed);
+
+    /// @brief Records the last partial interval
+    void finish(Clock::time_point now, uint64_t completed);
+
+    const std::vector<Sample>& getSamples() const;
+
+private:
+    void addSample(Clock::time_point now, uint64_t completed);
+
+    std::chrono::milliseconds _interval;
+    Clock::time_point _startTime;
+    Clock::time_point _intervalStartTime;
+    uint64_t _intervalStartCompleted = 0;
+    std::vector<Sample> _samples;
+};
@@ -7,6 +7,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -66,6 +67,14 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("Incorrect arrival rate. Please set -rate option to a positive value.");
+    }
+
+    if (FLAGS_rate > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop load generation (-rate option) is supported in the Async mode only.");
+    }
+
     return true;
 }
 
@@ -93,15 +102,6 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T> &vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ?
-           sortedVec[sortedVec.size() / 2ULL] :
-           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
-}
-
 /**
 * @brief The entry point of the benchmark application
 */
@@ -130,8 +130,8 @@ int main(int argc, char *argv[]) {
                 command_line_arguments.push_back({ flag.name, flag.current_value });
             }
         }
-        if (!FLAGS_report_type.empty()) {
-            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder});
+        if (!FLAGS_report_type.empty() || FLAGS_json_stats) {
+            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder, FLAGS_json_stats});
             statistics->addParameters(StatisticsReport::Category::COMMAND_LINE_PARAMETERS, command_line_arguments);
         }
         auto isFlagSetInCommandLine = [&command_line_arguments] (const std::string& name) {
@@ -452,6 +452,7 @@ int main(int argc, char *argv[]) {
                                               {"number of iterations", std::to_string(niter)},
                                               {"number of parallel infer requests", std::to_string(nireq)},
                                               {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
+                                              {"arrival rate (requests per second)", FLAGS_rate > 0 ? double_to_string(FLAGS_rate) : "closed-loop"},
                                       });
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
@@ -492,6 +493,9 @@ int main(int argc, char *argv[]) {
             if (!device_ss.str().empty()) {
                 ss << " using " << device_ss.str();
             }
+            if (FLAGS_rate > 0) {
+                ss << ", open-loop with " << double_to_string(FLAGS_rate) << " requests per second";
+            }
         }
         ss << ", limits: ";
         if (duration_seconds > 0) {
@@ -522,8 +526,14 @@ int main(int argc, char *argv[]) {
         inferRequestsQueue.waitAll();
         inferRequestsQueue.resetTimes();
 
+        const bool isOpenLoop = FLAGS_rate > 0;
+        const auto arrivalInterval = std::chrono::duration<double, std::nano>(1000000000.0 / (isOpenLoop ? FLAGS_rate : 1.0));
+        const LatencyRecorder& latencies = inferRequestsQueue.getLatencies();
+        ThroughputTimeline throughputTimeline{std::chrono::milliseconds(FLAGS_throughput_interval)};
+
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        throughputTimeline.start(startTime, latencies.getCount());
 
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
@@ -531,7 +541,13 @@ int main(int argc, char *argv[]) {
 
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !isOpenLoop && iteration % nireq != 0)) {
+            Time::time_point arrivalTime;
+            if (isOpenLoop) {
+                // requests arrive on a fixed schedule, so the time spent waiting for an idle request is a part of latency
+                arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(arrivalInterval * static_cast<double>(iteration));
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -546,11 +562,13 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                inferRequest->startAsync(isOpenLoop ? arrivalTime : Time::now());
             }
             iteration++;
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+            auto now = Time::now();
+            execTime = std::chrono::duration_cast<ns>(now - startTime).count();
+            throughputTimeline.sample(now, latencies.getCount());
 
             if (niter > 0) {
                 progressBar.addProgress(1);
@@ -567,8 +585,16 @@ int main(int argc, char *argv[]) {
 
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
-
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        throughputTimeline.finish(Time::now(), latencies.getCount());
+
+        double latency = latencies.getPercentile(50);
+        std::vector<std::pair<std::string, double>> latencyPercentiles = {
+            {"p50", latency},
+            {"p90", latencies.getPercentile(90)},
+            {"p99", latencies.getPercentile(99)},
+            {"p99.9", latencies.getPercentile(99.9)},
+            {"max", latencies.getMax()},
+        };
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
@@ -583,12 +609,22 @@ int main(int argc, char *argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
+                                                  {"min latency (ms)", double_to_string(latencies.getMin())},
+                                                  {"average latency (ms)", double_to_string(latencies.getAverage())},
                                           });
+                for (auto& percentile : latencyPercentiles) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {percentile.first + " latency (ms)", double_to_string(percentile.second)},
+                                              });
+                }
+                statistics->addLatencyHistogram(latencies.getHistogram());
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
                                               {"throughput", double_to_string(fps)}
                                       });
+            statistics->addThroughputTimeline(throughputTimeline.getSamples(), batchSize);
         }
 
         progressBar.finish();
@@ -633,8 +669,16 @@ int main(int argc, char *argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::string separator = " ";
+            std::cout << "Percentiles:";
+            for (auto& percentile : latencyPercentiles) {
+                std::cout << separator << percentile.first << " " << double_to_string(percentile.second) << " ms";
+                separator = ", ";
+            }
+            std::cout << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -7,9 +7,47 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
 
 #include "statistics_report.hpp"
 
+namespace {
+
+std::string escapeJson(const std::string& value) {
+    std::stringstream escaped;
+    for (auto c : value) {
+        switch (c) {
+            case '"': escaped << "\\\""; break;
+            case '\\': escaped << "\\\\"; break;
+            case '\n': escaped << "\\n"; break;
+            case '\r': escaped << "\\r"; break;
+            case '\t': escaped << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                } else {
+                    escaped << c;
+                }
+        }
+    }
+    return escaped.str();
+}
+
+const std::map<StatisticsReport::Category, std::pair<std::string, std::string>>& getCategoryNames() {
+    static const std::map<StatisticsReport::Category, std::pair<std::string, std::string>> names = {
+        {StatisticsReport::Category::COMMAND_LINE_PARAMETERS, {"Command line parameters", "command_line_parameters"}},
+        {StatisticsReport::Category::RUNTIME_CONFIG, {"Configuration setup", "configuration_setup"}},
+        {StatisticsReport::Category::EXECUTION_RESULTS, {"Execution results", "execution_results"}},
+    };
+    return names;
+}
+
+}  // namespace
+
 void StatisticsReport::addParameters(const Category &category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -17,7 +55,28 @@ void StatisticsReport::addParameters(const Category &category, const Parameters&
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+void StatisticsReport::addLatencyHistogram(const std::vector<LatencyRecorder::Bucket>& histogram) {
+    _latencyHistogram = histogram;
+}
+
+void StatisticsReport::addThroughputTimeline(const std::vector<ThroughputTimeline::Sample>& samples, size_t batchSize) {
+    _throughputTimeline.clear();
+    for (auto& sample : samples) {
+        double fps = sample.duration > 0 ? batchSize * 1000.0 * sample.completed / sample.duration : 0.0;
+        _throughputTimeline.emplace_back(sample.timeStamp, fps);
+    }
+}
+
 void StatisticsReport::dump() {
+    if (!_config.report_type.empty()) {
+        dumpCsv();
+    }
+    if (_config.json_stats) {
+        dumpJson();
+    }
+}
+
+void StatisticsReport::dumpCsv() {
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv");
 
     auto dump_parameters = [ &dumper ] (const Parameters &parameters) {
@@ -26,33 +85,84 @@ void StatisticsReport::dump() {
             dumper.endLine();
         }
     };
-    if (_parameters.count(Category::COMMAND_LINE_PARAMETERS)) {
-        dumper << "Command line parameters";
-        dumper.endLine();
+    for (auto& category : getCategoryNames()) {
+        if (_parameters.count(category.first)) {
+            dumper << category.second.first;
+            dumper.endLine();
 
-        dump_parameters(_parameters.at(Category::COMMAND_LINE_PARAMETERS));
-        dumper.endLine();
+            dump_parameters(_parameters.at(category.first));
+            dumper.endLine();
+        }
     }
 
-    if (_parameters.count(Category::RUNTIME_CONFIG)) {
-        dumper << "Configuration setup";
+    if (!_latencyHistogram.empty()) {
+        dumper << "Latency histogram";
         dumper.endLine();
-
-        dump_parameters(_parameters.at(Category::RUNTIME_CONFIG));
+        dumper << "lower bound (ms)" << "upper bound (ms)" << "count";
+        dumper.endLine();
+        for (auto& bucket : _latencyHistogram) {
+            dumper << bucket.lowerBound << bucket.upperBound << bucket.count;
+            dumper.endLine();
+        }
         dumper.endLine();
     }
 
-    if (_parameters.count(Category::EXECUTION_RESULTS)) {
-        dumper << "Execution results";
+    if (!_throughputTimeline.empty()) {
+        dumper << "Throughput time series";
         dumper.endLine();
-
-        dump_parameters(_parameters.at(Category::EXECUTION_RESULTS));
+        dumper << "time (ms)" << "throughput";
+        dumper.endLine();
+        for (auto& sample : _throughputTimeline) {
+            dumper << sample.first << sample.second;
+            dumper.endLine();
+        }
         dumper.endLine();
     }
 
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
+void StatisticsReport::dumpJson() {
+    auto filename = _config.report_folder + _separator + "benchmark_report.json";
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Can't open file " + filename + " to dump statistics report");
+    }
+    file << std::setprecision(std::numeric_limits<double>::digits10);
+
+    file << "{";
+    bool first = true;
+    for (auto& category : getCategoryNames()) {
+        if (!_parameters.count(category.first))
+            continue;
+        file << (first ? "" : ",") << "\n  \"" << category.second.second << "\": {";
+        first = false;
+        auto& parameters = _parameters.at(category.first);
+        for (size_t i = 0; i < parameters.size(); i++) {
+            file << (i == 0 ? "" : ",") << "\n    \"" << escapeJson(parameters[i].first) << "\": \""
+                 << escapeJson(parameters[i].second) << "\"";
+        }
+        file << "\n  }";
+    }
+
+    file << (first ? "" : ",") << "\n  \"latency_histogram\": [";
+    for (size_t i = 0; i < _latencyHistogram.size(); i++) {
+        auto& bucket = _latencyHistogram[i];
+        file << (i == 0 ? "" : ",") << "\n    {\"lower_bound_ms\": " << bucket.lowerBound
+             << ", \"upper_bound_ms\": " << bucket.upperBound << ", \"count\": " << bucket.count << "}";
+    }
+    file << "\n  ],";
+
+    file << "\n  \"throughput_timeline\": [";
+    for (size_t i = 0; i < _throughputTimeline.size(); i++) {
+        file << (i == 0 ? "" : ",") << "\n    {\"time_ms\": " << _throughputTimeline[i].first
+             << ", \"throughput\": " << _throughputTimeline[i].second << "}";
+    }
+    file << "\n  ]\n}\n";
+
+    slog::info << "Statistics report in JSON format is stored to " << filename << slog::endl;
+}
+
 void StatisticsReport::dumpPerformanceCountersRequest(CsvDumper& dumper,
                                                       const PerformaceCounters& perfCounts) {
     auto performanceMapSorted = perfCountersSorted(perfCounts);
@@ -14,12 +14,14 @@
 #include <samples/slog.hpp>
 #include <samples/csv_dumper.hpp>
 
+#include "latency_recorder.hpp"
+
 // @brief statistics reports types
 static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
-/// @brief Responsible for collecting of statistics and dumping to .csv file
+/// @brief Responsible for collecting of statistics and dumping to .csv and .json files
 class StatisticsReport {
 public:
     typedef std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> PerformaceCounters;
@@ -28,6 +30,7 @@ public:
     struct Config {
         std::string report_type;
         std::string report_folder;
+        bool json_stats;
     };
 
     enum class Category {
@@ -53,11 +56,19 @@ public:
 
     void addParameters(const Category &category, const Parameters& parameters);
 
+    void addLatencyHistogram(const std::vector<LatencyRecorder::Bucket>& histogram);
+
+    void addThroughputTimeline(const std::vector<ThroughputTimeline::Sample>& samples, size_t batchSize);
+
     void dump();
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
 private:
+    void dumpCsv();
+
+    void dumpJson();
+
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
 
@@ -67,6 +78,12 @@ private:
     // parameters
     std::map<Category, Parameters> _parameters;
 
+    // latency histogram
+    std::vector<LatencyRecorder::Bucket> _latencyHistogram;
+
+    // throughput time series: end of interval (ms) and FPS within the interval
+    std::vector<std::pair<double, double>> _throughputTimeline;
+
     // csv separator
     std::string _separator;
 };
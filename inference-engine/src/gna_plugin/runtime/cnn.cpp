@@ -8,6 +8,7 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "cpu_kernels.hpp"
 #include "backend/dnn_types.h"
 
 
@@ -26,17 +27,14 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad problem dimensions in CNNFilter32!";
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    GNAPluginNS::runtime::parallel_rows(num_filter_outputs, num_filters * num_filter_coefficients, [&](size_t j) {
+        const float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
+        for (uint32_t i = 0; i < num_filters; i++) {
+            const float *ptr_coef = ptr_filters + i * num_filter_coefficients;
+            ptr_outputs[j * num_filters + i] = ptr_biases[i] + GNAPluginNS::runtime::dot(ptr_in, ptr_coef, num_filter_coefficients);
         }
-    }
+    });
 }
 
 void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number_type) {
@@ -0,0 +1,128 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// cpu_kernels.hpp : building blocks of the software emulation routines
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <ie_parallel.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GNA_RUNTIME_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+
+// the number of multiply-adds below which a kernel is computed in the calling thread
+constexpr std::size_t kMinParallelWork = 1 << 15;
+
+/**
+ * @brief Calls func(row) for every row, splitting the rows between threads if the problem is big enough
+ * @param rows the number of independent rows
+ * @param rowWork an estimate of the number of multiply-adds per row
+ */
+template <typename F>
+void parallel_rows(const std::size_t rows, const std::size_t rowWork, const F& func) {
+    if (rows > 1 && rows * rowWork >= kMinParallelWork) {
+        InferenceEngine::parallel_for(rows, func);
+    } else {
+        for (std::size_t row = 0; row < rows; row++) {
+            func(row);
+        }
+    }
+}
+
+/**
+ * @brief Dot product of two contiguous vectors computed with 8 independent partial sums
+ */
+inline float dot(const float *a, const float *b, const uint32_t n) {
+    uint32_t k = 0;
+#ifdef GNA_RUNTIME_SSE2
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    for (; k + 8 <= n; k += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + k), _mm_loadu_ps(b + k)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + k + 4), _mm_loadu_ps(b + k + 4)));
+    }
+    float partial[4];
+    _mm_storeu_ps(partial, _mm_add_ps(acc0, acc1));
+    float sum = (partial[0] + partial[2]) + (partial[1] + partial[3]);
+#else
+    float acc[8] = {};
+    for (; k + 8 <= n; k += 8) {
+        for (uint32_t l = 0; l < 8; l++) {
+            acc[l] += a[k + l] * b[k + l];
+        }
+    }
+    float sum = ((acc[0] + acc[4]) + (acc[2] + acc[6])) + ((acc[1] + acc[5]) + (acc[3] + acc[7]));
+#endif
+    for (; k < n; k++) {
+        sum += a[k] * b[k];
+    }
+    return sum;
+}
+
+/**
+ * @brief Columns [j0, j0 + nb) of one row of a matrix product, see gemm_row
+ *
+ * The number of columns is a compile-time constant for the full blocks, so the inner loop is vectorized.
+ */
+template <int block>
+inline void gemm_row_block(const float *a, const int a_stride,
+                           const float *b, const int ldb,
+                           const int j0, const int nb, const int k,
+                           float *c, const bool accumulate) {
+    float acc[block];
+    for (int j = 0; j < nb; j++) {
+        acc[j] = accumulate ? c[j0 + j] : 0.0f;
+    }
+    for (int kk = 0; kk < k; kk++) {
+        const float av = a[kk * a_stride];
+        const float *b_row = b + kk * ldb + j0;
+        if (nb == block) {
+            for (int j = 0; j < block; j++) {
+                acc[j] += av * b_row[j];
+            }
+        } else {
+            for (int j = 0; j < nb; j++) {
+                acc[j] += av * b_row[j];
+            }
+        }
+    }
+    for (int j = 0; j < nb; j++) {
+        c[j0 + j] = acc[j];
+    }
+}
+
+/**
+ * @brief One row of a matrix product: c[j] (+)= sum over k of a[k * a_stride] * b[k * ldb + j]
+ *
+ * The columns of b are processed by blocks, so every element of a is loaded once per block and the inner loop is
+ * contiguous. The products are summed in the order of k, like in the reference implementation, so the result is
+ * bit-exact with it. The only exception is a single column of contiguous a and b (a matrix-vector product): it is
+ * computed by dot, which reorders the summation.
+ */
+inline void gemm_row(const float *a, const int a_stride,
+                     const float *b, const int ldb,
+                     const int n, const int k,
+                     float *c, const bool accumulate) {
+    if (n == 1 && a_stride == 1 && ldb == 1) {
+        c[0] = (accumulate ? c[0] : 0.0f) + dot(a, b, k);
+        return;
+    }
+
+    constexpr int block = 8;
+    for (int j0 = 0; j0 < n; j0 += block) {
+        gemm_row_block<block>(a, a_stride, b, ldb, j0, std::min(block, n - j0), k, c, accumulate);
+    }
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
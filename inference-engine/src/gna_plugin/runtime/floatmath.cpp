@@ -1,13 +1,18 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software emulation
 //
 
 #include <cstdint>
 #include <cstdio>
 
 #include "floatmath.h"
+#include "cpu_kernels.hpp"
+
+using GNAPluginNS::runtime::dot;
+using GNAPluginNS::runtime::gemm_row;
+using GNAPluginNS::runtime::parallel_rows;
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -19,44 +24,25 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
         throw -1;
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        parallel_rows(M, N * K, [&](size_t i) {
+            gemm_row(A + i * lda, 1, B, ldb, N, K, C + i * ldc, beta == 1.0);
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
+        parallel_rows(M, N * K, [&](size_t i) {
+            for (int j = 0; j < N; j++) {
+                C[i * ldc + j] = beta * C[i * ldc + j] + alpha * dot(A + i * lda, B + j * ldb, K);
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        parallel_rows(M, N * K, [&](size_t i) {
+            gemm_row(A + i, lda, B, ldb, N, K, C + i * ldc, beta == 1.0);
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
         throw -1;
@@ -97,47 +83,28 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const MKL_INT lda, const float *B, const MKL_INT ldb,
                         const float beta, float *C, const MKL_INT ldc,
                         const uint32_t *OutputList, const MKL_INT L) {
-    int i, j, k, l;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm_subset!\n");
         throw -1;
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        parallel_rows(L, N * K, [&](size_t l) {
+            const uint32_t i = OutputList[l];
+            gemm_row(A + i * lda, 1, B, ldb, N, K, C + l * ldc, beta == 1.0);
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (l = 0; l < L; l++) {
-                float sum;
-                j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + l] = sum;
+        parallel_rows(M, L * K, [&](size_t i) {
+            for (int l = 0; l < L; l++) {
+                const uint32_t j = OutputList[l];
+                C[i * ldc + l] = beta * C[i * ldc + l] + alpha * dot(A + i * lda, B + j * ldb, K);
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        parallel_rows(L, N * K, [&](size_t l) {
+            const uint32_t i = OutputList[l];
+            gemm_row(A + i, lda, B, ldb, N, K, C + l * ldc, beta == 1.0);
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm_subset!\n");
         throw -1;
@@ -153,20 +120,12 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
+    const uint32_t num_columns = K1 + K2;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    parallel_rows(N, num_columns, [&](size_t i) {
+        const float *x_row = X + i * num_columns;
+        C[i] = B[i] + dot(A1, x_row, K1) + dot(A2, x_row + K1, K2);
+    });
 }
 
 #ifdef __cplusplus
@@ -4,6 +4,7 @@
 //  pwl_design.cpp : simple activation function designer
 //
 
+#include <algorithm>
 #include <vector>
 #include <iostream>
 #include <limits>
@@ -28,6 +29,7 @@
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
+#include "cpu_kernels.hpp"
 
 double first_deriv_tanh(const double x) { return(1.0 - tanh(x) * tanh(x)); }
 double first_deriv_exp(const double x) { return(exp(x)); }
@@ -781,107 +783,102 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+namespace {
+
+// Applies func to every element of the region of the component's input, a single frame is split between threads
+// by blocks of columns
+template <typename F>
+void PwlApply32Elementwise(intel_dnn_component_t *component,
+                           uint32_t num_row_start,
+                           uint32_t num_row_end,
+                           uint32_t num_col_start,
+                           uint32_t num_col_end,
+                           const F& func) {
+    constexpr uint32_t num_block_columns = 256;
+    const float *ptr_in = reinterpret_cast<const float *>(component->ptr_inputs);
+    float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
+    const uint32_t num_columns = component->num_columns_in;
+    const uint32_t num_rows = num_row_end - num_row_start + 1;
+    const uint32_t num_blocks = (num_col_end - num_col_start + num_block_columns) / num_block_columns;
+
+    GNAPluginNS::runtime::parallel_rows(num_rows * num_blocks, num_block_columns, [&](size_t ind) {
+        const uint32_t i = num_row_start + static_cast<uint32_t>(ind / num_blocks);
+        const uint32_t j_start = num_col_start + static_cast<uint32_t>(ind % num_blocks) * num_block_columns;
+        const uint32_t j_end = std::min(j_start + num_block_columns - 1, num_col_end);
+        for (uint32_t j = j_start; j <= j_end; j++) {
+            ptr_out[i * num_columns + j] = func(ptr_in[i * num_columns + j]);
+        }
+    });
+}
+
+// The region of PwlApply32, the activation is a template argument of apply, so it is inlined into the loop
+struct PwlRegion32 {
+    intel_dnn_component_t *component;
+    uint32_t num_row_start;
+    uint32_t num_row_end;
+    uint32_t num_col_start;
+    uint32_t num_col_end;
+
+    template <typename F>
+    void apply(const F& func) const {
+        PwlApply32Elementwise(component, num_row_start, num_row_end, num_col_start, num_col_end, func);
+    }
+};
+
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
                 uint32_t num_col_start,
                 uint32_t num_col_end) {
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
-    float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
-    float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
-    uint32_t num_columns = component->num_columns_in;
+    const PwlRegion32 region{component, num_row_start, num_row_end, num_col_start, num_col_end};
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
-                }
-            }
+            region.apply([](float x) -> float { return 0.5 * (1.0 + tanh(0.5 * x)); });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-                }
-            }
+            region.apply([](float x) -> float { return tanh(x); });
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
-                }
-            }
+            region.apply([](float x) -> float { return x / (1.0 + fabs(x)); });
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ? ptr_in[i * num_columns + j] * transform->func_id.negative_slope : ptr_in[i * num_columns + j];
-                }
-            }
+        case kActRelu: {
+            const float negative_slope = transform->func_id.negative_slope;
+            region.apply([negative_slope](float x) -> float { return (x < 0.0f) ? x * negative_slope : x; });
             break;
+        }
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
-            }
+            region.apply([](float x) -> float { return x; });
             break;
         case kActKaldiLstmClipping:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > KALDI_LSTM_CLIP_UPPER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_UPPER;
-                    } else if (val < KALDI_LSTM_CLIP_LOWER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_LOWER;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
+            region.apply([](float x) -> float {
+                if (x > KALDI_LSTM_CLIP_UPPER) {
+                    return KALDI_LSTM_CLIP_UPPER;
+                } else if (x < KALDI_LSTM_CLIP_LOWER) {
+                    return KALDI_LSTM_CLIP_LOWER;
                 }
-            }
+                return x;
+            });
             break;
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
-                }
-            }
+            region.apply([](float x) -> float { return exp(x); });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
-                }
-            }
+            region.apply([](float x) -> float { return log(x); });
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-                }
-            }
+            region.apply([](float x) -> float { return fabs(x); });
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
-                }
-            }
+            region.apply([](float x) -> float { return (x == 0) ? 0.0 : ((x > 0) ? 1.0 : -1.0); });
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            region.apply([](float x) -> float { return -1.0 * log(x); });
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            region.apply([](float x) -> float { return -0.5 * log(x); });
             break;
         case kActCustom:
             // break;
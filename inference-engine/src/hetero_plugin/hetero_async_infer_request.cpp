@@ -4,6 +4,7 @@
 
 #include <utility>
 #include <memory>
+#include <exception>
 #include "hetero_async_infer_request.hpp"
 #include <ie_profiling.hpp>
 
@@ -19,25 +20,50 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const HeteroInferRequest::Ptr&
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(InferRequest* inferRequest) : _inferRequest{inferRequest} {
+            RequestExecutor(InferRequest* inferRequest, const HeteroStageExecutor::Ptr& stageExecutor) :
+                _inferRequest{inferRequest}, _stageExecutor{stageExecutor} {
                 _inferRequest->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
                 [this] (InferRequest, StatusCode sts) mutable {
                     _status = sts;
                     auto capturedTask = std::move(_task);
+                    if (nullptr != _stageExecutor) {
+                        _stageExecutor->release();
+                    }
                     capturedTask();
                 });
             }
             void run(Task task) override {
                 _task = std::move(task);
-                _inferRequest->StartAsync();
+                _exception = nullptr;
+                if (nullptr == _stageExecutor) {
+                    _inferRequest->StartAsync();
+                    return;
+                }
+                // in the pipeline mode the request may be started by the completion callback of another request
+                _stageExecutor->run([this] {
+                    try {
+                        _inferRequest->StartAsync();
+                    } catch (...) {
+                        _exception = std::current_exception();
+                        auto capturedTask = std::move(_task);
+                        _stageExecutor->release();
+                        capturedTask();
+                    }
+                });
             };
-            InferRequest*   _inferRequest = nullptr;
-            StatusCode      _status = StatusCode::OK;
-            Task            _task;
+            InferRequest*               _inferRequest = nullptr;
+            HeteroStageExecutor::Ptr    _stageExecutor;
+            StatusCode                  _status = StatusCode::OK;
+            std::exception_ptr          _exception;
+            Task                        _task;
         };
 
-        auto reuestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request.get());
+        auto& subRequestDesc = _heteroInferRequest->_inferRequests[requestId];
+        auto reuestExecutor = std::make_shared<RequestExecutor>(subRequestDesc._request.get(), subRequestDesc._stageExecutor);
         _pipeline.emplace_back(reuestExecutor, [reuestExecutor] {
+            if (nullptr != reuestExecutor->_exception) {
+                std::rethrow_exception(reuestExecutor->_exception);
+            }
             if (StatusCode::OK != reuestExecutor->_status) {
                 THROW_IE_EXCEPTION << InferenceEngine::details::as_status << reuestExecutor->_status;
             }
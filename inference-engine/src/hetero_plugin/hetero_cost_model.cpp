@@ -0,0 +1,204 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_cost_model.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ie_layers.h>
+#include <details/caseless.hpp>
+#include <details/ie_cnn_network_tools.h>
+
+#include "hetero_graph_splitter.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+using namespace HeteroPlugin;
+
+namespace {
+
+bool isPlacedByConsumers(const CNNLayerPtr& layer) {
+    return CaselessEq<std::string>()(layer->type, "input") ||
+           CaselessEq<std::string>()(layer->type, "const");
+}
+
+size_t byteSize(const DataPtr& data) {
+    const auto& desc = data->getTensorDesc();
+    size_t size = desc.getPrecision().size();
+    for (auto dim : desc.getDims()) {
+        size *= dim;
+    }
+    return size;
+}
+
+Partition partitionBySegments(const ICNNNetwork& network, const CostModel& costModel, size_t maxSegments) {
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    const size_t devicesNum = costModel.devices.size();
+    IE_ASSERT(devicesNum == costModel.layersTime.size());
+    IE_ASSERT(devicesNum < std::numeric_limits<std::int8_t>::max());
+
+    auto sortedLayers = CNNNetSortTopologically(network);
+    std::vector<CNNLayerPtr> layers;
+    std::unordered_map<std::string, size_t> layerIndex;
+    for (auto&& layer : sortedLayers) {
+        if (!isPlacedByConsumers(layer)) {
+            layerIndex[layer->name] = layers.size();
+            layers.push_back(layer);
+        }
+    }
+    const size_t layersNum = layers.size();
+
+    Partition partition;
+    if (layersNum != 0) {
+        // the size of the blobs alive between the layer i - 1 and the layer i, which are transferred on the device switch
+        std::vector<std::int64_t> liveBytesDelta(layersNum + 1, 0);
+        for (size_t i = 0; i < layersNum; i++) {
+            for (auto&& data : layers[i]->outData) {
+                size_t lastConsumer = i;
+                for (auto&& consumer : data->getInputTo()) {
+                    auto it = layerIndex.find(consumer.first);
+                    if (it != layerIndex.end()) {
+                        lastConsumer = std::max(lastConsumer, it->second);
+                    }
+                }
+                if (lastConsumer > i) {
+                    auto size = static_cast<std::int64_t>(byteSize(data));
+                    liveBytesDelta[i + 1] += size;
+                    liveBytesDelta[lastConsumer + 1] -= size;
+                }
+            }
+        }
+        std::vector<float> switchTime(layersNum, 0.f);
+        std::int64_t liveBytes = 0;
+        for (size_t i = 0; i < layersNum; i++) {
+            liveBytes += liveBytesDelta[i];
+            switchTime[i] = costModel.subgraphOverhead + costModel.transferTimePerByte * static_cast<float>(liveBytes);
+        }
+
+        auto layerTime = [&] (size_t layer, size_t device) {
+            const auto& times = costModel.layersTime[device];
+            auto it = times.find(layers[layer]->name);
+            return it == times.end() ? inf : it->second;
+        };
+
+        // latency[device * maxSegments + segment] of the layers [0, i] if the layer i is executed by the device
+        // in the given segment, previousDevice stores the device of the layer i - 1 for the backtracking
+        std::vector<float> latency(devicesNum * maxSegments, inf), nextLatency(devicesNum * maxSegments);
+        std::vector<std::int8_t> previousDevice(layersNum * devicesNum * maxSegments, -1);
+        for (size_t device = 0; device < devicesNum; device++) {
+            latency[device * maxSegments] = costModel.subgraphOverhead + layerTime(0, device);
+        }
+        for (size_t i = 1; i < layersNum; i++) {
+            for (size_t device = 0; device < devicesNum; device++) {
+                const float time = layerTime(i, device);
+                for (size_t segment = 0; segment < maxSegments; segment++) {
+                    float best = latency[device * maxSegments + segment];
+                    auto bestDevice = static_cast<std::int8_t>(device);
+                    for (size_t prevDevice = 0; segment != 0 && prevDevice < devicesNum; prevDevice++) {
+                        float candidate = latency[prevDevice * maxSegments + segment - 1] + switchTime[i];
+                        if (prevDevice != device && candidate < best) {
+                            best = candidate;
+                            bestDevice = static_cast<std::int8_t>(prevDevice);
+                        }
+                    }
+                    nextLatency[device * maxSegments + segment] = best + time;
+                    previousDevice[(i * devicesNum + device) * maxSegments + segment] = bestDevice;
+                }
+            }
+            std::swap(latency, nextLatency);
+        }
+
+        auto best = std::min_element(latency.begin(), latency.end());
+        if (*best == inf) {
+            for (auto&& layer : layers) {
+                bool supported = false;
+                for (auto&& times : costModel.layersTime) {
+                    supported = supported || times.count(layer->name) != 0;
+                }
+                if (!supported) {
+                    THROW_IE_EXCEPTION << "Network passed to LoadNetwork has layer " << layer->name
+                                       << " which is not supported by any of the devices in the cost model";
+                }
+            }
+            THROW_IE_EXCEPTION << "The cost model could not assign the layers to devices using up to "
+                               << maxSegments << " subgraphs";
+        }
+        partition.latency = *best;
+
+        size_t device = std::distance(latency.begin(), best) / maxSegments;
+        size_t segment = std::distance(latency.begin(), best) % maxSegments;
+        for (size_t i = layersNum; i-- > 0;) {
+            partition.affinities[layers[i]->name] = costModel.devices[device];
+            partition.layersTime[layers[i]->name] = layerTime(i, device);
+            if (i != 0) {
+                auto prevDevice = static_cast<size_t>(previousDevice[(i * devicesNum + device) * maxSegments + segment]);
+                if (prevDevice != device) {
+                    segment--;
+                    device = prevDevice;
+                }
+            }
+        }
+    }
+
+    // consumers precede the layers in the reversed topological order
+    for (auto it = sortedLayers.rbegin(); it != sortedLayers.rend(); ++it) {
+        auto& layer = *it;
+        if (!isPlacedByConsumers(layer)) {
+            continue;
+        }
+        for (auto&& data : layer->outData) {
+            for (auto&& consumer : data->getInputTo()) {
+                auto affinity = partition.affinities.find(consumer.first);
+                if (affinity != partition.affinities.end()) {
+                    auto device = affinity->second;
+                    partition.affinities[layer->name] = device;
+                    break;
+                }
+            }
+            if (partition.affinities.count(layer->name) != 0) {
+                break;
+            }
+        }
+    }
+    return partition;
+}
+
+// the number of subgraphs the HETERO executable network splits the network into with the given affinities
+size_t countSubgraphs(ICNNNetwork& network, const std::unordered_map<std::string, std::string>& affinities) {
+    auto sortedLayers = CNNNetSortTopologically(network);
+    std::vector<std::string> originalAffinities;
+    std::vector<std::string> devices;
+    for (auto&& layer : sortedLayers) {
+        originalAffinities.push_back(layer->affinity);
+        auto it = affinities.find(layer->name);
+        layer->affinity = it != affinities.end() ? it->second : std::string();
+        if (std::find(devices.begin(), devices.end(), layer->affinity) == devices.end()) {
+            devices.push_back(layer->affinity);
+        }
+    }
+    auto subgraphsNum = devices.empty() ? 0 : splitGraph(network, devices).size();
+    for (size_t i = 0; i < sortedLayers.size(); i++) {
+        sortedLayers[i]->affinity = originalAffinities[i];
+    }
+    return subgraphsNum;
+}
+
+}  // namespace
+
+Partition HeteroPlugin::partitionByCostModel(ICNNNetwork& network, const CostModel& costModel, size_t maxSubgraphs) {
+    maxSubgraphs = std::max<size_t>(maxSubgraphs, 1);
+    // a segment of the topological order may consist of several disconnected subgraphs, and Input and Const layers
+    // may split a segment too, so the number of segments is decreased until the number of subgraphs fits
+    for (size_t maxSegments = maxSubgraphs; ; maxSegments--) {
+        auto partition = partitionBySegments(network, costModel, maxSegments);
+        if (maxSegments == 1 || countSubgraphs(network, partition.affinities) <= maxSubgraphs) {
+            return partition;
+        }
+    }
+}
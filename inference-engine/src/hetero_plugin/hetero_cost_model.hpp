@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the cost model based assignment of layers to devices
+ * @file hetero_cost_model.hpp
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ie_icnn_network.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Estimates of the execution time of layers on the devices
+ */
+struct CostModel {
+    std::vector<std::string>                                devices;
+    // the execution time of the layers in microseconds per device, a layer missing in the map is not supported
+    std::vector<std::unordered_map<std::string, float>>     layersTime;
+    // the time of transfer of one byte of a blob from one subgraph to another in microseconds
+    float                                                   transferTimePerByte = 0.f;
+    // the time of start and completion of one subgraph infer request in microseconds
+    float                                                   subgraphOverhead = 0.f;
+};
+
+/**
+ * @brief The assignment of layers to devices
+ */
+struct Partition {
+    std::unordered_map<std::string, std::string>    affinities;
+    // the estimated execution time of the layers on the assigned devices in microseconds
+    std::unordered_map<std::string, float>          layersTime;
+    // the estimated latency of the network in microseconds
+    float                                           latency = 0.f;
+};
+
+/**
+ * @brief Assigns layers to devices minimizing the estimated latency of the network, whose subgraphs are executed
+ * one after another.
+ *
+ * The layers are split into segments of the topological order, each segment is executed by one device. The cost of
+ * a switch of devices between two segments is the subgraph overhead plus the transfer time of all the blobs produced
+ * before the switch and consumed after it. The optimal split is found by dynamic programming over
+ * (layer, device, number of segments), so the complexity is O(layers * devices^2 * maxSubgraphs).
+ * Input and Const layers are assigned to the device of their consumers.
+ * The subgraphs are counted the way the HETERO executable network splits the network, and the number of segments is
+ * decreased while they exceed maxSubgraphs. A network, which has disconnected parts, may still be split into more
+ * subgraphs if all its layers are assigned to one device.
+ *
+ * @param network A network to partition, the affinities of its layers are kept intact
+ * @param costModel Estimates of the execution time of layers on devices
+ * @param maxSubgraphs A maximal number of subgraphs
+ * @return The partition with the minimal estimated latency
+ */
+Partition partitionByCostModel(InferenceEngine::ICNNNetwork& network, const CostModel& costModel, size_t maxSubgraphs);
+
+}  // namespace HeteroPlugin
@@ -14,6 +14,7 @@
 #include <map>
 #include <utility>
 #include <fstream>
+#include <sstream>
 #include <algorithm>
 #include <string>
 #include <memory>
@@ -26,6 +27,7 @@
 #include "hetero/hetero_plugin_config.hpp"
 #include "hetero_plugin.hpp"
 #include "network_serializer.h"
+#include "exec_graph_info.hpp"
 
 using namespace InferenceEngine;
 using namespace details;
@@ -133,6 +135,20 @@ void dumpGraph(InferenceEngine::ICNNNetwork &network,
     saveGraphToDot(network, stream, split_color);
 }
 
+bool isPipeline(const std::map<std::string, std::string>& config) {
+    auto it = config.find(HETERO_CONFIG_KEY(PIPELINE));
+    return it != config.end() && it->second == YES;
+}
+
+// exclusive async requests serialize all the subnetworks in one executor, so the stages could not overlap
+void disableExclusiveAsyncRequestsIfPipeline(const std::map<std::string, std::string>& heteroConfig,
+                                             std::map<std::string, std::string>& loadConfig) {
+    auto it = loadConfig.find(KEY_EXCLUSIVE_ASYNC_REQUESTS);
+    if (isPipeline(heteroConfig) && it != loadConfig.end()) {
+        it->second = NO;
+    }
+}
+
 }   // namespace
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::ICNNNetwork&  network_,
@@ -167,7 +183,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::ICNNNetw
     if (allEmpty) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it != _config.end()) {
-            _heteroPlugin->SetAffinity(network, _config);
+            _heteroPlugin->SetAffinity(network, _config, &_layersEstimatedTime);
         } else {
             THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
         }
@@ -314,10 +330,12 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::ICNNNetw
         assert(metaDevices.size() == 1);
 
         auto loadConfig = metaDevices[deviceName];
+        disableExclusiveAsyncRequestsIfPipeline(_config, loadConfig);
         d._network = _heteroPlugin->GetCore()->LoadNetwork(d._clonedNetwork, deviceName, loadConfig);
     }
 
     networks = std::move(descs);
+    CreateStageExecutors();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -362,6 +380,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     for (auto&& config : configs) {
         importedConfigs[config.first] = config.second;
     }
+    _config = importedConfigs;
 
     std::vector<NetworkDesc> descs;
     pugi::xml_node subnetworksNode = heteroNode.child("subnetworks");
@@ -372,6 +391,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
         auto metaDevices = _heteroPlugin->GetDevicePlugins(deviceName, importedConfigs);
         assert(metaDevices.size() == 1);
         auto& loadConfig = metaDevices[deviceName];
+        disableExclusiveAsyncRequestsIfPipeline(_config, loadConfig);
 
         InferenceEngine::ExecutableNetwork executableNetwork;
         CNNNetwork cnnnetwork;
@@ -436,10 +456,28 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
             deviceName,
             loaded ? CNNNetwork{cloneNet(static_cast<InferenceEngine::ICNNNetwork&>(cnnnetwork))} : CNNNetwork{},
             executableNetwork,
+            nullptr,
         });
     }
 
     networks = std::move(descs);
+    CreateStageExecutors();
+}
+
+void HeteroExecutableNetwork::CreateStageExecutors() {
+    if (!isPipeline(_config)) {
+        return;
+    }
+    for (auto&& desc : networks) {
+        // a stage executes as many requests at once as its device is able to overlap
+        unsigned int maxRequests = 1u;
+        try {
+            maxRequests = desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::details::InferenceEngineException&) {
+            // the metric is optional, the stage executes one request at a time
+        }
+        desc._stageExecutor = std::make_shared<HeteroStageExecutor>(maxRequests);
+    }
 }
 
 void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
@@ -523,6 +561,7 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = ProfilingTask{"Infer" + std::to_string(index++)};
+        desc._stageExecutor = subnetwork._stageExecutor;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs,
@@ -540,6 +579,89 @@ void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncReques
     asyncThreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
 }
 
+void HeteroExecutableNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) {
+    auto net = std::make_shared<details::CNNNetworkImpl>();
+    net->setPrecision(Precision::FP32);
+    net->setName(_name);
+
+    // the execution graphs of the subnetworks are merged, the nodes are named as the performance counters
+    for (size_t index = 0; index < networks.size(); index++) {
+        auto& subnetwork = networks[index];
+        auto subgraph = subnetwork._network.GetExecGraphInfo();
+        auto prefix = "subgraph" + std::to_string(index) + ": ";
+
+        std::vector<std::pair<CNNLayerPtr, CNNLayerPtr>> layers;
+        std::unordered_map<std::string, CNNLayerPtr> copies;
+        details::CNNNetworkIterator it(&static_cast<const ICNNNetwork&>(subgraph));
+        while (it != details::CNNNetworkIterator()) {
+            CNNLayerPtr layer = *it;
+            CNNLayerPtr copy = std::make_shared<CNNLayer>(LayerParams{prefix + layer->name, layer->type, layer->precision});
+            copy->params = layer->params;
+            copy->params[ExecGraphInfoSerialization::AFFINITY] = subnetwork._device;
+            copy->params[ExecGraphInfoSerialization::SUBGRAPH_INDEX] = std::to_string(index);
+            if (!_layersEstimatedTime.empty()) {
+                float estimatedTime = 0.f;
+                std::stringstream originalNames{layer->GetParamAsString(ExecGraphInfoSerialization::ORIGINAL_NAMES, "")};
+                for (std::string name; std::getline(originalNames, name, ',');) {
+                    auto itTime = _layersEstimatedTime.find(name);
+                    if (itTime != _layersEstimatedTime.end()) {
+                        estimatedTime += itTime->second;
+                    }
+                }
+                copy->params[ExecGraphInfoSerialization::ESTIMATED_TIME] = std::to_string(estimatedTime);
+            }
+            copy->insData.resize(layer->insData.size());
+            copy->outData.resize(layer->outData.size());
+            copies[layer->name] = copy;
+            layers.emplace_back(layer, copy);
+            net->addLayer(copy);
+            it++;
+        }
+
+        for (auto&& layer : layers) {
+            for (size_t port = 0; port < layer.first->outData.size(); port++) {
+                auto& data = layer.first->outData[port];
+                if (nullptr == data) {
+                    continue;
+                }
+                auto copyData = std::make_shared<Data>(prefix + data->getName(), data->getTensorDesc());
+                copyData->getCreatorLayer() = layer.second;
+                layer.second->outData[port] = copyData;
+                net->addData(copyData->getName().c_str(), copyData);
+                for (auto&& consumer : data->getInputTo()) {
+                    auto itConsumer = copies.find(consumer.first);
+                    if (copies.end() == itConsumer) {
+                        continue;
+                    }
+                    auto& consumerCopy = itConsumer->second;
+                    copyData->getInputTo()[consumerCopy->name] = consumerCopy;
+                    for (size_t inPort = 0; inPort < consumer.second->insData.size(); inPort++) {
+                        if (consumer.second->insData[inPort].lock() == data) {
+                            consumerCopy->insData[inPort] = copyData;
+                        }
+                    }
+                }
+            }
+        }
+
+        for (auto&& input : subgraph.getInputsInfo()) {
+            auto data = input.second->getInputData();
+            auto creator = data->getCreatorLayer().lock();
+            if (nullptr == creator || copies.end() == copies.find(creator->name)) {
+                continue;
+            }
+            auto& creatorCopy = copies.at(creator->name);
+            auto itData = std::find(creator->outData.begin(), creator->outData.end(), data);
+            IE_ASSERT(creator->outData.end() != itData);
+            auto inputInfo = std::make_shared<InputInfo>();
+            inputInfo->setInputData(creatorCopy->outData[std::distance(creator->outData.begin(), itData)]);
+            net->setInputInfo(inputInfo);
+        }
+    }
+
+    graphPtr = net;
+}
+
 void HeteroExecutableNetwork::GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *) const {
     if (name == "TARGET_FALLBACK") {
         auto it = _config.find(name);
@@ -549,10 +671,16 @@ void HeteroExecutableNetwork::GetConfig(const std::string &name, InferenceEngine
             result = std::string{};
         }
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
+               name == HETERO_CONFIG_KEY(PIPELINE) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(AFFINITY_MODE) ||
+               name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        result = it->second;
     } else {
         // find config key among plugin config keys
         for (auto&& desc : networks) {
@@ -636,6 +764,9 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE),
+            HETERO_CONFIG_KEY(AFFINITY_MODE),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -23,6 +23,7 @@
 #include "ie_icore.hpp"
 #include "cnn_network_impl.hpp"
 #include "hetero_async_infer_request.hpp"
+#include "hetero_stage_executor.hpp"
 
 namespace HeteroPlugin {
 
@@ -61,19 +62,26 @@ public:
 
     void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
 
+    void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
+
     void ExportImpl(std::ostream& modelFile) override;
 
 private:
+    void CreateStageExecutors();
+
     struct NetworkDesc {
         std::string                                 _device;
         InferenceEngine::CNNNetwork                 _clonedNetwork;
         InferenceEngine::ExecutableNetwork          _network;
+        HeteroStageExecutor::Ptr                    _stageExecutor;
     };
     std::vector<NetworkDesc> networks;
 
     Engine*                             _heteroPlugin;
     std::string                         _name;
     std::map<std::string, std::string>  _config;
+    // the execution time of the layers estimated by the cost model affinity mode
+    std::unordered_map<std::string, float> _layersEstimatedTime;
 };
 
 }  // namespace HeteroPlugin
@@ -20,6 +20,8 @@
 #include <cpp/ie_infer_request.hpp>
 #include <cpp/ie_executable_network.hpp>
 
+#include "hetero_stage_executor.hpp"
+
 namespace HeteroPlugin {
 
 class HeteroInferRequest : public InferenceEngine::InferRequestInternal {
@@ -30,6 +32,8 @@ public:
         InferenceEngine::ExecutableNetwork  _network;
         InferenceEngine::InferRequest::Ptr  _request;
         InferenceEngine::ProfilingTask      _profilingTask;
+        // not nullptr in the pipeline mode only
+        HeteroStageExecutor::Ptr            _stageExecutor;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -11,6 +11,11 @@
 #include <utility>
 #include <fstream>
 #include <unordered_set>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <limits>
 #include "ie_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
@@ -32,6 +37,9 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE)] = NO;
+    _config[HETERO_CONFIG_KEY(AFFINITY_MODE)] = HETERO_CONFIG_VALUE(PRIORITY);
+    _config[HETERO_CONFIG_KEY(MAX_SUBGRAPHS)] = "4";
 }
 
 namespace {
@@ -127,18 +135,164 @@ void HeteroLayerColorer::operator()(const CNNLayerPtr layer,
     node_properties.emplace_back("fillcolor", deviceColorMap[device]);
 }
 
-void Engine::SetAffinity(InferenceEngine::ICNNNetwork &network, const Configs &config) {
-    QueryNetworkResult qr;
-    QueryNetwork(network, config, qr);
+namespace {
 
-    details::CNNNetworkIterator i(&network);
-    while (i != details::CNNNetworkIterator()) {
-        CNNLayer::Ptr layer = *i;
-        auto it = qr.supportedLayersMap.find(layer->name);
-        if (it != qr.supportedLayersMap.end()) {
-            layer->affinity = it->second;
+using Clock = std::chrono::steady_clock;
+
+// the blobs are handed over between the subgraphs through the host memory, so the time of a copy of a buffer
+// larger than the caches estimates the transfer time of a byte
+float measureHostTransferTimePerByte() {
+    constexpr size_t bufferSize = 32 * 1024 * 1024;
+    constexpr int copyIterations = 3;
+    std::vector<std::uint8_t> source(bufferSize, 1), destination(bufferSize, 0);
+    float bestTime = std::numeric_limits<float>::max();
+    for (int i = 0; i < copyIterations; i++) {
+        auto start = Clock::now();
+        std::memcpy(destination.data(), source.data(), bufferSize);
+        bestTime = std::min(bestTime,
+            std::chrono::duration_cast<std::chrono::duration<float, std::micro>>(Clock::now() - start).count());
+    }
+    return bestTime / bufferSize;
+}
+
+}  // namespace
+
+CostModel Engine::ProfileNetwork(const ICNNNetwork& network, const Configs& config) {
+    constexpr int profilingIterations = 3;
+
+    auto fallbackDevices = DeviceIDParser::getHeteroDevices(config.at("TARGET_FALLBACK"));
+    CostModel costModel;
+    costModel.devices = fallbackDevices;
+    costModel.layersTime.resize(fallbackDevices.size());
+    costModel.transferTimePerByte = measureHostTransferTimePerByte();
+
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    float overheadSum = 0.f;
+    size_t overheadRuns = 0;
+    for (size_t device = 0; device < fallbackDevices.size(); device++) {
+        // the profiled device has the highest priority, the layers it does not support are executed by the rest ones
+        auto deviceName = fallbackDevices[device];
+        std::string fallback = deviceName;
+        for (auto&& otherDevice : fallbackDevices) {
+            if (otherDevice != deviceName) {
+                fallback += "," + otherDevice;
+            }
+        }
+        auto profilingConfig = config;
+        profilingConfig["TARGET_FALLBACK"] = fallback;
+        profilingConfig[HETERO_CONFIG_KEY(AFFINITY_MODE)] = HETERO_CONFIG_VALUE(PRIORITY);
+        profilingConfig[HETERO_CONFIG_KEY(PIPELINE)] = NO;
+        profilingConfig[KEY_PERF_COUNT] = YES;
+
+        std::map<std::string, float> perfTime;
+        float inferTime = 0.f;
+        QueryNetworkResult qr;
+        try {
+            QueryNetwork(network, profilingConfig, qr);
+            auto execNetwork = std::make_shared<HeteroExecutableNetwork>(network, profilingConfig, this);
+            IInferRequest::Ptr request;
+            execNetwork->CreateInferRequest(request);
+            InferRequest inferRequest{request};
+            for (auto&& input : inputs) {
+                auto blob = inferRequest.GetBlob(input.first);
+                std::memset(blob->buffer().as<std::uint8_t*>(), 0, blob->byteSize());
+            }
+            // the first inference is a warm up
+            inferRequest.Infer();
+            for (int i = 0; i < profilingIterations; i++) {
+                auto start = Clock::now();
+                inferRequest.Infer();
+                inferTime += std::chrono::duration_cast<std::chrono::duration<float, std::micro>>(Clock::now() - start).count();
+                for (auto&& perf : inferRequest.GetPerformanceCounts()) {
+                    if (InferenceEngineProfileInfo::EXECUTED == perf.second.status) {
+                        perfTime[perf.first] += perf.second.realTime_uSec;
+                    }
+                }
+            }
+        } catch (const std::exception&) {
+            // the device is not able to execute the network even with the help of the rest ones, so it is not used
+            continue;
+        }
+
+        auto& layersTime = costModel.layersTime[device];
+        for (auto&& layer : qr.supportedLayersMap) {
+            // the layers fused to others or optimized out have no performance counters
+            if (layer.second == deviceName) {
+                layersTime[layer.first] = 0.f;
+            }
+        }
+        // the performance counters of the hetero request are named "subgraph<index>: <layer name>"
+        std::unordered_set<std::string> subgraphs;
+        float layersTimeSum = 0.f;
+        for (auto&& perf : perfTime) {
+            auto separator = perf.first.find(": ");
+            if (separator == std::string::npos) {
+                continue;
+            }
+            subgraphs.insert(perf.first.substr(0, separator));
+            layersTimeSum += perf.second;
+            auto layerName = perf.first.substr(separator + 2);
+            auto it = qr.supportedLayersMap.find(layerName);
+            if (it != qr.supportedLayersMap.end() && it->second == deviceName) {
+                layersTime[layerName] = perf.second / profilingIterations;
+            }
+        }
+        if (!subgraphs.empty()) {
+            overheadSum += std::max(0.f, inferTime - layersTimeSum) / (profilingIterations * subgraphs.size());
+            overheadRuns++;
+        }
+    }
+    if (overheadRuns != 0) {
+        costModel.subgraphOverhead = overheadSum / overheadRuns;
+    }
+    return costModel;
+}
+
+void Engine::SetAffinity(InferenceEngine::ICNNNetwork &network, const Configs &config,
+                         std::unordered_map<std::string, float>* layersTime) {
+    auto tconfig = mergeConfigs(_config, config);
+    auto itMode = tconfig.find(HETERO_CONFIG_KEY(AFFINITY_MODE));
+    if (itMode != tconfig.end() && itMode->second == HETERO_CONFIG_VALUE(COST_MODEL)) {
+        int maxSubgraphs = 0;
+        try {
+            maxSubgraphs = std::stoi(tconfig.at(HETERO_CONFIG_KEY(MAX_SUBGRAPHS)));
+        } catch (const std::exception&) {
+        }
+        if (maxSubgraphs <= 0) {
+            THROW_IE_EXCEPTION << "Wrong value for property key " << HETERO_CONFIG_KEY(MAX_SUBGRAPHS)
+                               << ". Expected only positive integer numbers";
+        }
+
+        auto partition = partitionByCostModel(network, ProfileNetwork(network, tconfig), static_cast<size_t>(maxSubgraphs));
+        details::CNNNetworkIterator i(&network);
+        while (i != details::CNNNetworkIterator()) {
+            CNNLayer::Ptr layer = *i;
+            auto it = partition.affinities.find(layer->name);
+            if (it != partition.affinities.end()) {
+                layer->affinity = it->second;
+            }
+            i++;
+        }
+        if (nullptr != layersTime) {
+            *layersTime = std::move(partition.layersTime);
+        }
+    } else if (itMode != tconfig.end() && itMode->second != HETERO_CONFIG_VALUE(PRIORITY)) {
+        THROW_IE_EXCEPTION << "Wrong value " << itMode->second << " for property key " << HETERO_CONFIG_KEY(AFFINITY_MODE)
+                           << ". Expected only " << HETERO_CONFIG_VALUE(PRIORITY) << "/" << HETERO_CONFIG_VALUE(COST_MODEL);
+    } else {
+        QueryNetworkResult qr;
+        QueryNetwork(network, config, qr);
+
+        details::CNNNetworkIterator i(&network);
+        while (i != details::CNNNetworkIterator()) {
+            CNNLayer::Ptr layer = *i;
+            auto it = qr.supportedLayersMap.find(layer->name);
+            if (it != qr.supportedLayersMap.end()) {
+                layer->affinity = it->second;
+            }
+            i++;
         }
-        i++;
     }
 
     auto dumpDot = [](const Configs & config) {
@@ -215,6 +369,9 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE),
+            HETERO_CONFIG_KEY(AFFINITY_MODE),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else if (METRIC_KEY(FULL_DEVICE_NAME) == name) {
@@ -230,6 +387,15 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+        IE_ASSERT(it != _config.end());
+        bool pipeline = it->second == YES;
+        return { pipeline };
+    } else if (name == HETERO_CONFIG_KEY(AFFINITY_MODE) || name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        return { it->second };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
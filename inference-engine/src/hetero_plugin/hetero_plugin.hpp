@@ -8,6 +8,7 @@
 #include "ie_icore.hpp"
 #include "cpp_interfaces/impl/ie_plugin_internal.hpp"
 #include "cpp/ie_plugin_cpp.hpp"
+#include "hetero_cost_model.hpp"
 #include <memory>
 #include <string>
 #include <map>
@@ -42,13 +43,21 @@ public:
     ExecutableNetwork ImportNetworkImpl(std::istream& heteroModel, const Configs& config) override;
 
 
-    void SetAffinity(InferenceEngine::ICNNNetwork& network, const Configs &config);
+    /**
+     * @brief Assigns the layers without affinity to the devices from TARGET_FALLBACK
+     * @param layersTime If not nullptr, receives the execution time of the layers estimated by the cost model
+     */
+    void SetAffinity(InferenceEngine::ICNNNetwork& network, const Configs &config,
+                     std::unordered_map<std::string, float>* layersTime = nullptr);
 
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback,
         const Configs & localConfig) const;
 
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string & deviceName) const;
+
+    // measures the execution time of the layers on each of the fallback devices using performance counters
+    CostModel ProfileNetwork(const InferenceEngine::ICNNNetwork& network, const Configs& config);
 };
 
 struct HeteroLayerColorer {
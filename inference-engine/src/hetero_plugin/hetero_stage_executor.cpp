@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_stage_executor.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroStageExecutor::HeteroStageExecutor(unsigned int maxRequests) :
+    _maxRequests{std::max(maxRequests, 1u)} {
+}
+
+void HeteroStageExecutor::run(Task task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_inFlight >= _maxRequests) {
+            _queue.emplace_back(std::move(task));
+            return;
+        }
+        _inFlight++;
+    }
+    task();
+}
+
+void HeteroStageExecutor::release() {
+    Task next;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_queue.empty()) {
+            _inFlight--;
+            return;
+        }
+        // the slot is passed to the next request as is
+        next = std::move(_queue.front());
+        _queue.pop_front();
+    }
+    next();
+}
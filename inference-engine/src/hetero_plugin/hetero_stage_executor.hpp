@@ -0,0 +1,51 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the executor of a subnetwork pipeline stage
+ * @file hetero_stage_executor.hpp
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include <threading/ie_itask_executor.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Limits the number of subnetwork infer requests executed at once by one pipeline stage.
+ *
+ * Tasks passed to the executor start subnetwork infer requests. They are started in the order of submission,
+ * when the stage has a free slot. A slot is returned by the release() call when the started request is completed,
+ * so the next hetero request enters the stage while the previous one is executed by the following stages.
+ */
+class HeteroStageExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    using Ptr = std::shared_ptr<HeteroStageExecutor>;
+
+    explicit HeteroStageExecutor(unsigned int maxRequests);
+
+    /**
+     * @brief Runs the task in the calling thread if the stage has a free slot or queues it
+     * @param task A task which starts the subnetwork infer request, it must not throw
+     */
+    void run(InferenceEngine::Task task) override;
+
+    /**
+     * @brief Returns the slot of the completed request and starts the next queued one, if any
+     */
+    void release();
+
+private:
+    std::mutex                          _mutex;
+    std::deque<InferenceEngine::Task>   _queue;
+    unsigned int                        _inFlight = 0;
+    const unsigned int                  _maxRequests;
+};
+
+}  // namespace HeteroPlugin
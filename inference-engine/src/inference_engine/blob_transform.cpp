@@ -5,17 +5,99 @@
 #include "blob_transform.hpp"
 
 #include "ie_system_conf.h"
+#include "ie_parallel.hpp"
 #ifdef HAVE_SSE
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+#endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
+namespace {
+
+// blobs smaller than this are copied by the calling thread, the threads wake up costs more
+constexpr size_t parallel_copy_threshold = 64 * 1024;
+
+template <typename F>
+void blob_for_2d(size_t byte_size, size_t D0, size_t D1, const F& func) {
+    if (byte_size < parallel_copy_threshold) {
+        for_2d(0, 1, D0, D1, func);
+    } else {
+        parallel_for2d(D0, D1, func);
+    }
+}
+
+template <typename F>
+void blob_for_3d(size_t byte_size, size_t D0, size_t D1, size_t D2, const F& func) {
+    if (byte_size < parallel_copy_threshold) {
+        for_3d(0, 1, D0, D1, D2, func);
+    } else {
+        parallel_for3d(D0, D1, D2, func);
+    }
+}
+
+template <typename data_t>
+void blob_copy_dense(const data_t* src_ptr, data_t* dst_ptr, size_t count) {
+    if (count * sizeof(data_t) < parallel_copy_threshold) {
+        std::memcpy(dst_ptr, src_ptr, count * sizeof(data_t));
+        return;
+    }
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(count, nthr, ithr, start, end);
+        std::memcpy(dst_ptr + start, src_ptr + start, (end - start) * sizeof(data_t));
+    });
+}
+
+// Transposes `rows` x `cols` matrix: dst[c * dst_stride + r] = src[r * src_stride + c]
+template <typename data_t>
+void blob_transpose(const data_t* src_ptr, data_t* dst_ptr, size_t src_stride, size_t dst_stride,
+                    size_t rows, size_t cols) {
+#ifdef HAVE_AVX2
+    static const bool use_avx2 = with_cpu_x86_avx2();
+    if (use_avx2) {
+        switch (sizeof(data_t)) {
+        case sizeof(uint32_t):
+            blob_transpose_32_avx2(reinterpret_cast<const uint32_t*>(src_ptr), reinterpret_cast<uint32_t*>(dst_ptr),
+                                   src_stride, dst_stride, rows, cols);
+            return;
+        case sizeof(uint16_t):
+            blob_transpose_16_avx2(reinterpret_cast<const uint16_t*>(src_ptr), reinterpret_cast<uint16_t*>(dst_ptr),
+                                   src_stride, dst_stride, rows, cols);
+            return;
+        case sizeof(uint8_t):
+            blob_transpose_8_avx2(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
+                                  src_stride, dst_stride, rows, cols);
+            return;
+        }
+    }
+#endif  // HAVE_AVX2
+    // 8x8 tiles keep both source rows and destination rows in cache
+    constexpr size_t tile = 8;
+    for (size_t r0 = 0; r0 < rows; r0 += tile) {
+        const size_t r1 = std::min(r0 + tile, rows);
+        for (size_t c0 = 0; c0 < cols; c0 += tile) {
+            const size_t c1 = std::min(c0 + tile, cols);
+            for (size_t r = r0; r < r1; r++) {
+                for (size_t c = c0; c < c1; c++) {
+                    dst_ptr[c * dst_stride + r] = src_ptr[r * src_stride + c];
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
 template <InferenceEngine::Precision::ePrecision PRC>
 static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
@@ -47,22 +129,30 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
     const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
+    dst_ptr += dst_blk_desc.getOffsetPadding();
+
+    const size_t byte_size = N * C * H * W * sizeof(data_t);
 
 #ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            blob_for_2d(byte_size, N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr + n * N_src_stride + h * H_src_stride),
+                                        reinterpret_cast<uint8_t*>(dst_ptr + n * N_dst_stride + h * H_dst_stride),
+                                        N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
+                                        1, 1, static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            blob_for_2d(byte_size, N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr + n * N_src_stride + h * H_src_stride),
+                                         reinterpret_cast<float*>(dst_ptr + n * N_dst_stride + h * H_dst_stride),
+                                         N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
+                                         1, 1, static_cast<int>(W));
+            });
             return;
         }
     }
@@ -70,55 +160,73 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
         C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            blob_for_2d(byte_size, N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr + n * N_src_stride + h * H_src_stride),
+                                        reinterpret_cast<uint8_t*>(dst_ptr + n * N_dst_stride + h * H_dst_stride),
+                                        N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
+                                        1, 1, static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            blob_for_2d(byte_size, N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr + n * N_src_stride + h * H_src_stride),
+                                         reinterpret_cast<float*>(dst_ptr + n * N_dst_stride + h * H_dst_stride),
+                                         N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
+                                         1, 1, static_cast<int>(W));
+            });
             return;
         }
     }
 #endif  // HAVE_SSE
 
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
+        if (C_src_stride == 1 && W_dst_stride == 1) {
+            // every image row is W x C matrix transposed into C x W one
+            blob_for_2d(byte_size, N, H, [&](size_t n, size_t h) {
+                blob_transpose(src_ptr + n * N_src_stride + h * H_src_stride,
+                               dst_ptr + n * N_dst_stride + h * H_dst_stride,
+                               W_src_stride, C_dst_stride, W, C);
+            });
+            return;
+        }
+        blob_for_2d(byte_size, N, C, [&](size_t n, size_t c) {
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    src_ptr_l_l += W_src_stride;
+                    dst_ptr_l++;
                 }
             }
-        }
+        });
     } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
+        if (W_src_stride == 1 && C_dst_stride == 1) {
+            // every image row is C x W matrix transposed into W x C one
+            blob_for_2d(byte_size, N, H, [&](size_t n, size_t h) {
+                blob_transpose(src_ptr + n * N_src_stride + h * H_src_stride,
+                               dst_ptr + n * N_dst_stride + h * H_dst_stride,
+                               C_src_stride, W_dst_stride, C, W);
+            });
+            return;
+        }
+        blob_for_2d(byte_size, N, C, [&](size_t n, size_t c) {
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    dst_ptr_l += W_dst_stride;
+                    src_ptr_l_l++;
                 }
             }
-        }
+        });
     } else {
-        for (int i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        blob_copy_dense(src_ptr, dst_ptr, N * C * H * W);
     }
 }
 
@@ -179,22 +287,28 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NDHWC ? dst_strides[2] : dst_strides[3];
     const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
 
+    const size_t byte_size = N * C * D * H * W * sizeof(data_t);
+
 #ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                    C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
+            blob_for_3d(byte_size, N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride),
+                                        reinterpret_cast<uint8_t*>(dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride),
+                                        N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
+                                        C_dst_stride, 1, 1, 1, static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                     C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
+            blob_for_3d(byte_size, N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride),
+                                         reinterpret_cast<float*>(dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride),
+                                         N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
+                                         C_dst_stride, 1, 1, 1, static_cast<int>(W));
+            });
             return;
         }
     }
@@ -202,60 +316,70 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
         C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                    H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
+            blob_for_3d(byte_size, N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride),
+                                        reinterpret_cast<uint8_t*>(dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride),
+                                        N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
+                                        H_dst_stride, 1, 1, 1, static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                     H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
+            blob_for_3d(byte_size, N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride),
+                                         reinterpret_cast<float*>(dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride),
+                                         N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
+                                         H_dst_stride, 1, 1, 1, static_cast<int>(W));
+            });
             return;
         }
     }
 #endif  // HAVE_SSE
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
+        if (C_src_stride == 1 && W_dst_stride == 1) {
+            blob_for_3d(byte_size, N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_transpose(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride,
+                               dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride,
+                               W_src_stride, C_dst_stride, W, C);
+            });
+            return;
+        }
+        blob_for_3d(byte_size, N, C, D, [&](size_t n, size_t c, size_t d) {
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    src_ptr_l_l += W_src_stride;
+                    dst_ptr_l++;
                 }
             }
-        }
+        });
     } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
+        if (W_src_stride == 1 && C_dst_stride == 1) {
+            blob_for_3d(byte_size, N, D, H, [&](size_t n, size_t d, size_t h) {
+                blob_transpose(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride,
+                               dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride,
+                               C_src_stride, W_dst_stride, C, W);
+            });
+            return;
+        }
+        blob_for_3d(byte_size, N, C, D, [&](size_t n, size_t c, size_t d) {
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    dst_ptr_l += W_dst_stride;
+                    src_ptr_l_l++;
                 }
             }
-        }
+        });
     } else {
-        for (int i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        blob_copy_dense(src_ptr, dst_ptr, N * C * D * H * W);
     }
 }
 
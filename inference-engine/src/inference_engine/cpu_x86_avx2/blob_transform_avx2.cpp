@@ -0,0 +1,182 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+namespace InferenceEngine {
+
+namespace {
+
+template <typename T>
+inline void transpose_tail(const T* src_ptr, T* dst_ptr, size_t src_stride, size_t dst_stride,
+                           size_t row_begin, size_t row_end, size_t col_begin, size_t col_end) {
+    // destination rows are written sequentially, the tails are narrow for the source rows
+    for (size_t c = col_begin; c < col_end; c++) {
+        for (size_t r = row_begin; r < row_end; r++) {
+            dst_ptr[c * dst_stride + r] = src_ptr[r * src_stride + c];
+        }
+    }
+}
+
+// 8 rows x 8 columns of 32-bit elements
+inline void transpose_8x8_32(const uint32_t* src_ptr, uint32_t* dst_ptr, size_t src_stride, size_t dst_stride) {
+    const float* src = reinterpret_cast<const float*>(src_ptr);
+    float* dst = reinterpret_cast<float*>(dst_ptr);
+
+    __m256 r0 = _mm256_loadu_ps(src + 0 * src_stride);
+    __m256 r1 = _mm256_loadu_ps(src + 1 * src_stride);
+    __m256 r2 = _mm256_loadu_ps(src + 2 * src_stride);
+    __m256 r3 = _mm256_loadu_ps(src + 3 * src_stride);
+    __m256 r4 = _mm256_loadu_ps(src + 4 * src_stride);
+    __m256 r5 = _mm256_loadu_ps(src + 5 * src_stride);
+    __m256 r6 = _mm256_loadu_ps(src + 6 * src_stride);
+    __m256 r7 = _mm256_loadu_ps(src + 7 * src_stride);
+
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+    __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+    __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+    __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+    __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    _mm256_storeu_ps(dst + 0 * dst_stride, _mm256_permute2f128_ps(u0, u4, 0x20));
+    _mm256_storeu_ps(dst + 1 * dst_stride, _mm256_permute2f128_ps(u1, u5, 0x20));
+    _mm256_storeu_ps(dst + 2 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x20));
+    _mm256_storeu_ps(dst + 3 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x20));
+    _mm256_storeu_ps(dst + 4 * dst_stride, _mm256_permute2f128_ps(u0, u4, 0x31));
+    _mm256_storeu_ps(dst + 5 * dst_stride, _mm256_permute2f128_ps(u1, u5, 0x31));
+    _mm256_storeu_ps(dst + 6 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x31));
+    _mm256_storeu_ps(dst + 7 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x31));
+}
+
+// 8 rows x 16 columns of 16-bit elements: each 128-bit lane is transposed as 8x8 block
+inline void transpose_8x16_16(const uint16_t* src_ptr, uint16_t* dst_ptr, size_t src_stride, size_t dst_stride) {
+    __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_ptr + 0 * src_stride));
+    __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_ptr + 1 * src_stride));
+    __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_ptr + 2 * src_stride));
+    __m256i r3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_ptr + 3 * src_stride));
+    __m256i r4 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_ptr + 4 * src_stride));
+    __m256i r5 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_ptr + 5 * src_stride));
+    __m256i r6 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_ptr + 6 * src_stride));
+    __m256i r7 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_ptr + 7 * src_stride));
+
+    __m256i a0 = _mm256_unpacklo_epi16(r0, r1);
+    __m256i a1 = _mm256_unpackhi_epi16(r0, r1);
+    __m256i a2 = _mm256_unpacklo_epi16(r2, r3);
+    __m256i a3 = _mm256_unpackhi_epi16(r2, r3);
+    __m256i a4 = _mm256_unpacklo_epi16(r4, r5);
+    __m256i a5 = _mm256_unpackhi_epi16(r4, r5);
+    __m256i a6 = _mm256_unpacklo_epi16(r6, r7);
+    __m256i a7 = _mm256_unpackhi_epi16(r6, r7);
+
+    __m256i b0 = _mm256_unpacklo_epi32(a0, a2);
+    __m256i b1 = _mm256_unpackhi_epi32(a0, a2);
+    __m256i b2 = _mm256_unpacklo_epi32(a1, a3);
+    __m256i b3 = _mm256_unpackhi_epi32(a1, a3);
+    __m256i b4 = _mm256_unpacklo_epi32(a4, a6);
+    __m256i b5 = _mm256_unpackhi_epi32(a4, a6);
+    __m256i b6 = _mm256_unpacklo_epi32(a5, a7);
+    __m256i b7 = _mm256_unpackhi_epi32(a5, a7);
+
+    __m256i c[8] = {
+        _mm256_unpacklo_epi64(b0, b4), _mm256_unpackhi_epi64(b0, b4),
+        _mm256_unpacklo_epi64(b1, b5), _mm256_unpackhi_epi64(b1, b5),
+        _mm256_unpacklo_epi64(b2, b6), _mm256_unpackhi_epi64(b2, b6),
+        _mm256_unpacklo_epi64(b3, b7), _mm256_unpackhi_epi64(b3, b7)
+    };
+
+    for (int i = 0; i < 8; i++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + i * dst_stride), _mm256_castsi256_si128(c[i]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + (i + 8) * dst_stride), _mm256_extracti128_si256(c[i], 1));
+    }
+}
+
+// the low and the high lanes of a 256-bit register, _mm256_set_m128i is missing in GCC older than 8
+inline __m256i combine_lanes(__m128i lo, __m128i hi) {
+    return _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+// 8 rows x 16 columns of 8-bit elements
+inline void transpose_8x16_8(const uint8_t* src_ptr, uint8_t* dst_ptr, size_t src_stride, size_t dst_stride) {
+    __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 0 * src_stride));
+    __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 1 * src_stride));
+    __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 2 * src_stride));
+    __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 3 * src_stride));
+    __m128i r4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 4 * src_stride));
+    __m128i r5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 5 * src_stride));
+    __m128i r6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 6 * src_stride));
+    __m128i r7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 7 * src_stride));
+
+    // columns 0..7 and 8..15 are placed into low and high lanes of the same register
+    __m256i a0 = combine_lanes(_mm_unpacklo_epi8(r0, r1), _mm_unpackhi_epi8(r0, r1));
+    __m256i a1 = combine_lanes(_mm_unpacklo_epi8(r2, r3), _mm_unpackhi_epi8(r2, r3));
+    __m256i a2 = combine_lanes(_mm_unpacklo_epi8(r4, r5), _mm_unpackhi_epi8(r4, r5));
+    __m256i a3 = combine_lanes(_mm_unpacklo_epi8(r6, r7), _mm_unpackhi_epi8(r6, r7));
+
+    __m256i b0 = _mm256_unpacklo_epi16(a0, a1);
+    __m256i b1 = _mm256_unpackhi_epi16(a0, a1);
+    __m256i b2 = _mm256_unpacklo_epi16(a2, a3);
+    __m256i b3 = _mm256_unpackhi_epi16(a2, a3);
+
+    // every 64-bit element holds a column
+    __m256i c[4] = {
+        _mm256_unpacklo_epi32(b0, b2), _mm256_unpackhi_epi32(b0, b2),
+        _mm256_unpacklo_epi32(b1, b3), _mm256_unpackhi_epi32(b1, b3)
+    };
+
+    for (int i = 0; i < 4; i++) {
+        __m128i lo = _mm256_castsi256_si128(c[i]);
+        __m128i hi = _mm256_extracti128_si256(c[i], 1);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst_ptr + (2 * i) * dst_stride), lo);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst_ptr + (2 * i + 1) * dst_stride), _mm_unpackhi_epi64(lo, lo));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst_ptr + (2 * i + 8) * dst_stride), hi);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst_ptr + (2 * i + 9) * dst_stride), _mm_unpackhi_epi64(hi, hi));
+    }
+}
+
+template <typename T, size_t block_rows, size_t block_cols, typename F>
+inline void transpose_blocked(const T* src_ptr, T* dst_ptr, size_t src_stride, size_t dst_stride,
+                              size_t rows, size_t cols, const F& block_kernel) {
+    const size_t rows_aligned = rows - rows % block_rows;
+    const size_t cols_aligned = cols - cols % block_cols;
+    for (size_t r = 0; r < rows_aligned; r += block_rows) {
+        for (size_t c = 0; c < cols_aligned; c += block_cols) {
+            block_kernel(src_ptr + r * src_stride + c, dst_ptr + c * dst_stride + r, src_stride, dst_stride);
+        }
+    }
+    transpose_tail(src_ptr, dst_ptr, src_stride, dst_stride, 0, rows_aligned, cols_aligned, cols);
+    transpose_tail(src_ptr, dst_ptr, src_stride, dst_stride, rows_aligned, rows, 0, cols);
+}
+
+}  // namespace
+
+void blob_transpose_32_avx2(const uint32_t* src_ptr, uint32_t* dst_ptr, size_t src_stride, size_t dst_stride,
+                            size_t rows, size_t cols) {
+    transpose_blocked<uint32_t, 8, 8>(src_ptr, dst_ptr, src_stride, dst_stride, rows, cols, transpose_8x8_32);
+}
+
+void blob_transpose_16_avx2(const uint16_t* src_ptr, uint16_t* dst_ptr, size_t src_stride, size_t dst_stride,
+                            size_t rows, size_t cols) {
+    transpose_blocked<uint16_t, 8, 16>(src_ptr, dst_ptr, src_stride, dst_stride, rows, cols, transpose_8x16_16);
+}
+
+void blob_transpose_8_avx2(const uint8_t* src_ptr, uint8_t* dst_ptr, size_t src_stride, size_t dst_stride,
+                           size_t rows, size_t cols) {
+    transpose_blocked<uint8_t, 8, 16>(src_ptr, dst_ptr, src_stride, dst_stride, rows, cols, transpose_8x16_8);
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Blob-copy primitives manually vectored for AVX2 (w/o threads)
+//
+// Transpose `rows` x `cols` matrix: dst[c * dst_stride + r] = src[r * src_stride + c]
+//
+//------------------------------------------------------------------------
+
+void blob_transpose_32_avx2(const uint32_t* src_ptr, uint32_t* dst_ptr, size_t src_stride, size_t dst_stride,
+                            size_t rows, size_t cols);
+
+void blob_transpose_16_avx2(const uint16_t* src_ptr, uint16_t* dst_ptr, size_t src_stride, size_t dst_stride,
+                            size_t rows, size_t cols);
+
+void blob_transpose_8_avx2(const uint8_t* src_ptr, uint8_t* dst_ptr, size_t src_stride, size_t dst_stride,
+                           size_t rows, size_t cols);
+
+}  // namespace InferenceEngine
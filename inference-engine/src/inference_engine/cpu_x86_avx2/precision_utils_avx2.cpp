@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+// NOTE: the file must be compiled without the contraction of multiplication and addition into FMA,
+//       otherwise `x * scale + bias` is rounded differently from the scalar code
+
+static inline __m256 cvt_f16_f32(__m128i x16) {
+    const __m256i x = _mm256_cvtepu16_epi32(x16);
+    const __m256i abs = _mm256_and_si256(x, _mm256_set1_epi32(0x7FFF));
+    const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x8000)), 16);
+    const __m256i exp = _mm256_and_si256(x, _mm256_set1_epi32(0x7C00));
+    const __m256i mant = _mm256_and_si256(x, _mm256_set1_epi32(0x03FF));
+
+    // normal values: shift mantissa and exp from f16 to f32 position and change exp bias
+    __m256i result = _mm256_add_epi32(_mm256_slli_epi32(abs, 23 - 10), _mm256_set1_epi32((127 - 15) << 23));
+
+    // zero and denormals: mantissa * 2^-24 is representable in f32 exactly
+    const __m256 denorm = _mm256_mul_ps(_mm256_cvtepi32_ps(mant), _mm256_castsi256_ps(_mm256_set1_epi32((127 - 24) << 23)));
+    const __m256i is_denorm = _mm256_cmpeq_epi32(exp, _mm256_setzero_si256());
+    result = _mm256_blendv_epi8(result, _mm256_castps_si256(denorm), is_denorm);
+
+    // NAN and INF: NAN gets the quiet bit
+    const __m256i is_nan_inf = _mm256_cmpeq_epi32(exp, _mm256_set1_epi32(0x7C00));
+    const __m256i is_nan = _mm256_andnot_si256(_mm256_cmpeq_epi32(mant, _mm256_setzero_si256()), is_nan_inf);
+    const __m256i nan_inf_mant = _mm256_or_si256(mant, _mm256_and_si256(is_nan, _mm256_set1_epi32(0x0200)));
+    const __m256i nan_inf = _mm256_or_si256(_mm256_slli_epi32(nan_inf_mant, 23 - 10), _mm256_set1_epi32(0x7F800000));
+    result = _mm256_blendv_epi8(result, nan_inf, is_nan_inf);
+
+    return _mm256_castsi256_ps(_mm256_or_si256(result, sign));
+}
+
+static inline __m128i cvt_f32_f16(__m256 x) {
+    const __m256i exp_mask = _mm256_set1_epi32(0x7F800000);
+    const __m256i u = _mm256_castps_si256(x);
+    const __m256i sign = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(0x8000));
+    const __m256i abs = _mm256_and_si256(u, _mm256_set1_epi32(0x7FFFFFFF));
+    const __m256i exp = _mm256_and_si256(abs, exp_mask);
+
+    // NAN and INF
+    const __m256i is_nan_inf = _mm256_cmpeq_epi32(exp, exp_mask);
+    const __m256i is_nan = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(abs, _mm256_set1_epi32(0x007FFFFF)),
+                                                                  _mm256_setzero_si256()), is_nan_inf);
+    const __m256i nan_inf = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(abs, 23 - 10), _mm256_set1_epi32(0x7FFF)),
+                                            _mm256_and_si256(is_nan, _mm256_set1_epi32(0x0200)));
+
+    // round to nearest f16 by adding halfULP of f16
+    const __m256 half_ulp = _mm256_mul_ps(_mm256_castsi256_ps(exp), _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23)));
+    const __m256 v = _mm256_add_ps(_mm256_castsi256_ps(abs), half_ulp);
+
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 half_min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 15) << 23));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    // change exp bias from 127 to 15 and round to f16
+    __m256i result = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(v), _mm256_set1_epi32((127 - 15) << 23)), 23 - 10);
+    // if input value is more than maximal allowed value for f16 then return this maximal value
+    result = _mm256_blendv_epi8(result, _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF),
+                                _mm256_castps_si256(_mm256_cmp_ps(v, max16, _CMP_GE_OQ)));
+    // if input value is between min16/2 and min16 then return min16
+    result = _mm256_blendv_epi8(result, _mm256_set1_epi32(1 << 10),
+                                _mm256_castps_si256(_mm256_cmp_ps(v, min16, _CMP_LT_OQ)));
+    // if input value does not fit normalized f16 then return 0
+    result = _mm256_andnot_si256(_mm256_castps_si256(_mm256_cmp_ps(v, half_min16, _CMP_LT_OQ)), result);
+
+    result = _mm256_or_si256(_mm256_blendv_epi8(result, nan_inf, is_nan_inf), sign);
+
+    // all the values fit 16 bits, so saturation does not change them
+    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm256_castsi256_si128(packed);
+}
+
+void f16tof32Arrays_avx2(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 x = cvt_f16_f32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(x, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_avx2(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), vscale), vbias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), cvt_f32_f16(x));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
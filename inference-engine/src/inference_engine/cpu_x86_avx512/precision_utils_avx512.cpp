@@ -0,0 +1,103 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+
+#include <immintrin.h>  // AVX512F
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+// NOTE: the file must be compiled without the contraction of multiplication and addition into FMA,
+//       otherwise `x * scale + bias` is rounded differently from the scalar code
+
+static inline __m512 cvt_f16_f32(__m256i x16) {
+    const __m512i x = _mm512_cvtepu16_epi32(x16);
+    const __m512i abs = _mm512_and_si512(x, _mm512_set1_epi32(0x7FFF));
+    const __m512i sign = _mm512_slli_epi32(_mm512_and_si512(x, _mm512_set1_epi32(0x8000)), 16);
+    const __m512i exp = _mm512_and_si512(x, _mm512_set1_epi32(0x7C00));
+    const __m512i mant = _mm512_and_si512(x, _mm512_set1_epi32(0x03FF));
+
+    // normal values: shift mantissa and exp from f16 to f32 position and change exp bias
+    __m512i result = _mm512_add_epi32(_mm512_slli_epi32(abs, 23 - 10), _mm512_set1_epi32((127 - 15) << 23));
+
+    // zero and denormals: mantissa * 2^-24 is representable in f32 exactly
+    const __m512 denorm = _mm512_mul_ps(_mm512_cvtepi32_ps(mant), _mm512_castsi512_ps(_mm512_set1_epi32((127 - 24) << 23)));
+    const __mmask16 is_denorm = _mm512_cmpeq_epi32_mask(exp, _mm512_setzero_si512());
+    result = _mm512_mask_blend_epi32(is_denorm, result, _mm512_castps_si512(denorm));
+
+    // NAN and INF: NAN gets the quiet bit
+    const __mmask16 is_nan_inf = _mm512_cmpeq_epi32_mask(exp, _mm512_set1_epi32(0x7C00));
+    const __mmask16 is_nan = _mm512_mask_cmpneq_epi32_mask(is_nan_inf, mant, _mm512_setzero_si512());
+    const __m512i nan_inf_mant = _mm512_mask_or_epi32(mant, is_nan, mant, _mm512_set1_epi32(0x0200));
+    const __m512i nan_inf = _mm512_or_si512(_mm512_slli_epi32(nan_inf_mant, 23 - 10), _mm512_set1_epi32(0x7F800000));
+    result = _mm512_mask_blend_epi32(is_nan_inf, result, nan_inf);
+
+    return _mm512_castsi512_ps(_mm512_or_si512(result, sign));
+}
+
+static inline __m256i cvt_f32_f16(__m512 x) {
+    const __m512i exp_mask = _mm512_set1_epi32(0x7F800000);
+    const __m512i u = _mm512_castps_si512(x);
+    const __m512i sign = _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(0x8000));
+    const __m512i abs = _mm512_and_si512(u, _mm512_set1_epi32(0x7FFFFFFF));
+    const __m512i exp = _mm512_and_si512(abs, exp_mask);
+
+    // NAN and INF
+    const __mmask16 is_nan_inf = _mm512_cmpeq_epi32_mask(exp, exp_mask);
+    const __mmask16 is_nan = _mm512_mask_test_epi32_mask(is_nan_inf, abs, _mm512_set1_epi32(0x007FFFFF));
+    const __m512i inf = _mm512_and_si512(_mm512_srli_epi32(abs, 23 - 10), _mm512_set1_epi32(0x7FFF));
+    const __m512i nan_inf = _mm512_mask_or_epi32(inf, is_nan, inf, _mm512_set1_epi32(0x0200));
+
+    // round to nearest f16 by adding halfULP of f16
+    const __m512 half_ulp = _mm512_mul_ps(_mm512_castsi512_ps(exp), _mm512_castsi512_ps(_mm512_set1_epi32((127 - 11) << 23)));
+    const __m512 v = _mm512_add_ps(_mm512_castsi512_ps(abs), half_ulp);
+
+    const __m512 min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 14) << 23));
+    const __m512 half_min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 15) << 23));
+    const __m512 max16 = _mm512_castsi512_ps(_mm512_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    // change exp bias from 127 to 15 and round to f16
+    __m512i result = _mm512_srli_epi32(_mm512_sub_epi32(_mm512_castps_si512(v), _mm512_set1_epi32((127 - 15) << 23)), 23 - 10);
+    // if input value is more than maximal allowed value for f16 then return this maximal value
+    result = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, max16, _CMP_GE_OQ), result,
+                                     _mm512_set1_epi32(((15 + 15) << 10) | 0x3FF));
+    // if input value is between min16/2 and min16 then return min16
+    result = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, min16, _CMP_LT_OQ), result, _mm512_set1_epi32(1 << 10));
+    // if input value does not fit normalized f16 then return 0
+    result = _mm512_maskz_mov_epi32(_mm512_cmp_ps_mask(v, half_min16, _CMP_NLT_UQ), result);
+
+    result = _mm512_or_si512(_mm512_mask_blend_epi32(is_nan_inf, result, nan_inf), sign);
+
+    return _mm512_cvtepi32_epi16(result);
+}
+
+void f16tof32Arrays_avx512(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m512 x = cvt_f16_f32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm512_storeu_ps(dst + i, _mm512_add_ps(_mm512_mul_ps(x, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_avx512(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m512 x = _mm512_add_ps(_mm512_mul_ps(_mm512_loadu_ps(src + i), vscale), vbias);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), cvt_f32_f16(x));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
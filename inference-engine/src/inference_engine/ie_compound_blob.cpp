@@ -9,6 +9,7 @@
 
 #include "ie_compound_blob.h"
 
+#include <algorithm>
 #include <initializer_list>
 #include <memory>
 #include <utility>
@@ -189,6 +190,49 @@ void verifyI420BlobInput(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr
                            << yDims[3] << "(Y plane) and " << vDims[3] << "(V plane)";
     }
 }
+
+void verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
+    if (blobs.empty()) {
+        THROW_IE_EXCEPTION << "Cannot create a batched blob from an empty vector of blobs";
+    }
+
+    // all images must be MemoryBlob objects
+    if (!std::all_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
+            return blob->is<MemoryBlob>();
+        })) {
+        THROW_IE_EXCEPTION << "All images of a batched blob must be MemoryBlob objects";
+    }
+
+    const auto& firstDesc = blobs.front()->getTensorDesc();
+    for (const auto& blob : blobs) {
+        const auto& desc = blob->getTensorDesc();
+        const auto& dims = desc.getDims();
+
+        // check dimensions
+        if (dims.size() != 4) {
+            THROW_IE_EXCEPTION << "Images of a batched blob must be 4D, actual dimension size: " << dims.size();
+        }
+
+        // check batch size
+        if (dims[0] != 1) {
+            THROW_IE_EXCEPTION << "Images of a batched blob must have batch size 1, actual: " << dims[0];
+        }
+
+        // check precision, layout and number of channels
+        if (desc.getPrecision() != firstDesc.getPrecision()) {
+            THROW_IE_EXCEPTION << "Images of a batched blob have different precisions: " << desc.getPrecision()
+                               << " != " << firstDesc.getPrecision();
+        }
+        if (desc.getLayout() != firstDesc.getLayout()) {
+            THROW_IE_EXCEPTION << "Images of a batched blob have different layouts: " << desc.getLayout()
+                               << " != " << firstDesc.getLayout();
+        }
+        if (dims[1] != firstDesc.getDims()[1]) {
+            THROW_IE_EXCEPTION << "Images of a batched blob have different number of channels: " << dims[1]
+                               << " != " << firstDesc.getDims()[1];
+        }
+    }
+}
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(): Blob(TensorDesc(Precision::UNSPECIFIED, {}, Layout::ANY)) {}
@@ -371,4 +415,20 @@ const Blob::Ptr& I420Blob::v() const noexcept {
     return _blobs[2];
 }
 
+BatchedBlob::BatchedBlob(const std::vector<Blob::Ptr>& blobs): CompoundBlob(blobs) {
+    // verify data is correct
+    verifyBatchedBlobInput(_blobs);
+    const auto& desc = _blobs.front()->getTensorDesc();
+    tensorDesc = TensorDesc(desc.getPrecision(), {}, desc.getLayout());
+}
+
+BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs): CompoundBlob(std::move(blobs)) {
+    // verify data is correct
+    verifyBatchedBlobInput(_blobs);
+    const auto& desc = _blobs.front()->getTensorDesc();
+    tensorDesc = TensorDesc(desc.getPrecision(), {}, desc.getLayout());
+}
+
+BatchedBlob::~BatchedBlob() {}
+
 }  // namespace InferenceEngine
@@ -5,6 +5,7 @@
 #include "ie_core.hpp"
 
 #include <unordered_set>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <limits>
@@ -15,6 +16,7 @@
 #include <utility>
 #include <vector>
 #include <mutex>
+#include <thread>
 
 #include <ngraph/opsets/opset.hpp>
 #include "cpp/ie_cnn_net_reader.h"
@@ -24,6 +26,7 @@
 #include "details/ie_so_pointer.hpp"
 #include "file_utils.h"
 #include "ie_icore.hpp"
+#include "ie_network_hash.hpp"
 #include "ie_plugin.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_profiling.hpp"
@@ -225,7 +228,75 @@ class Core::Impl : public ICore {
     std::vector<IExtensionPtr> extensions;
 
     std::map<std::string, PluginDescriptor> pluginRegistry;
-    mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
+    std::string cacheDir;
+    mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry, plugins and cacheDir
+
+    /**
+     * @brief A header of a compiled network cache file, followed by the digest of the network and the exported network
+     */
+    static constexpr const char* cacheFileMagic = "IE_COMPILED_NETWORK_CACHE";
+
+    /**
+     * @brief Computes the digest of the network loaded to the device, used as the compiled network cache key
+     * @param cachePath A path to the cache file, an empty string if caching is disabled
+     * @return The digest or an empty string if the network cannot be cached
+     */
+    std::string GetCachedNetworkKey(const CNNNetwork& network, const std::string& deviceName,
+                                    const std::map<std::string, std::string>& config, std::string& cachePath) const {
+        std::string dir;
+        std::map<std::string, std::string> compileConfig;
+        std::vector<IExtensionPtr> coreExtensions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            dir = cacheDir;
+            auto itDesc = pluginRegistry.find(deviceName);
+            if (itDesc != pluginRegistry.end()) {
+                compileConfig = itDesc->second.defaultConfig;
+                // extensions from plugins.xml are loaded by the plugin only, their locations identify them
+                for (auto&& extensionLocation : itDesc->second.listOfExtentions) {
+                    compileConfig["EXTENSION " + FileUtils::fromFilePath(extensionLocation)] = "";
+                }
+            }
+            coreExtensions = extensions;
+        }
+        cachePath.clear();
+        if (dir.empty()) {
+            return {};
+        }
+        for (auto&& item : config) {
+            compileConfig[item.first] = item.second;
+        }
+        auto key = computeNetworkHash(network, deviceName, compileConfig, coreExtensions);
+        if (!key.empty()) {
+            cachePath = FileUtils::makePath(dir, key + ".blob");
+        }
+        return key;
+    }
+
+    /**
+     * @brief Imports a network from the cache file if the file was written for the same key
+     * @return false if the file is missing, was written for another key or cannot be imported
+     */
+    bool ImportCachedNetwork(const std::string& cachePath, const std::string& key, const std::string& deviceName,
+                             const std::map<std::string, std::string>& config, ExecutableNetwork& executableNetwork) {
+        std::ifstream networkModel(cachePath, std::ios::binary);
+        if (!networkModel.is_open()) {
+            return false;
+        }
+        std::string magic, storedKey;
+        std::getline(networkModel, magic);
+        std::getline(networkModel, storedKey);
+        if (!networkModel.good() || magic != cacheFileMagic || storedKey != key) {
+            return false;
+        }
+        try {
+            executableNetwork = ImportNetwork(networkModel, deviceName, config);
+            return true;
+        } catch (const std::exception&) {
+            // a stale or corrupted cache entry, the network is compiled and exported again
+        }
+        return false;
+    }
 
 public:
     Impl();
@@ -369,9 +440,55 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork)
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        std::string cachedNetworkPath;
+        auto cachedNetworkKey = GetCachedNetworkKey(network, parsed._deviceName, parsed._config, cachedNetworkPath);
+        ExecutableNetwork executableNetwork;
+        if (!cachedNetworkPath.empty() && FileUtils::fileExist(cachedNetworkPath) &&
+            ImportCachedNetwork(cachedNetworkPath, cachedNetworkKey, parsed._deviceName, parsed._config, executableNetwork)) {
+            return executableNetwork;
+        }
+
         IE_SUPPRESS_DEPRECATED_START
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        executableNetwork = GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
         IE_SUPPRESS_DEPRECATED_END
+
+        if (!cachedNetworkPath.empty()) {
+            // write to a temporary file first, so concurrent processes never import a partially written network
+            auto tmpPath = cachedNetworkPath + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+            try {
+                {
+                    std::ofstream networkModel(tmpPath, std::ios::binary);
+                    networkModel << cacheFileMagic << '\n' << cachedNetworkKey << '\n';
+                    executableNetwork.Export(networkModel);
+                    if (!networkModel.good()) {
+                        THROW_IE_EXCEPTION << "Failed to write " << tmpPath;
+                    }
+                }
+                std::remove(cachedNetworkPath.c_str());
+                if (0 != std::rename(tmpPath.c_str(), cachedNetworkPath.c_str())) {
+                    std::remove(tmpPath.c_str());
+                }
+            } catch (const std::exception&) {
+                // the device does not support export, the network is used without caching
+                std::remove(tmpPath.c_str());
+            }
+        }
+
+        return executableNetwork;
+    }
+
+    /**
+     * @brief Sets a directory to cache compiled networks in
+     * @param dir A path to existing directory or an empty string to disable caching
+     */
+    void SetCacheDir(const std::string& dir) {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        cacheDir = dir;
+    }
+
+    std::string GetCacheDir() const {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        return cacheDir;
     }
 
     IE_SUPPRESS_DEPRECATED_START
@@ -871,10 +988,25 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
+    // Core-level cache directory is not passed to plugins
+    auto config_ = config;
+    auto itCacheDir = config_.find(CONFIG_KEY(CACHE_DIR));
+    if (itCacheDir != config_.end()) {
+        if (!deviceName.empty()) {
+            THROW_IE_EXCEPTION << "SetConfig is supported for " << CONFIG_KEY(CACHE_DIR)
+                               << " only without a device name, the cache directory is shared by all devices";
+        }
+        _impl->SetCacheDir(itCacheDir->second);
+        config_.erase(itCacheDir);
+        if (config_.empty()) {
+            return;
+        }
+    }
+
     if (deviceName.empty()) {
-        _impl->SetConfigForPlugins(config, std::string());
+        _impl->SetConfigForPlugins(config_, std::string());
     } else {
-        auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        auto parsed = parseDeviceNameIntoConfig(deviceName, config_);
         _impl->SetConfigForPlugins(parsed._config, parsed._deviceName);
     }
 }
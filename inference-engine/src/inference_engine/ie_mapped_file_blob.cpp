@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mapped_file_blob.hpp"
+
+#include <memory>
+#include <string>
+
+#include "details/ie_exception.hpp"
+#include "file_utils.h"
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+
+MappedFileBlob::CPtr MappedFileBlob::create(const std::string& filePath) {
+    long long fileSize = FileUtils::fileSize(filePath);
+    if (fileSize <= 0)
+        return nullptr;
+    const size_t size = static_cast<size_t>(fileSize);
+
+#ifdef _WIN32
+# ifdef ENABLE_UNICODE_PATH_SUPPORT
+    std::wstring path = details::multiByteCharToWString(filePath.c_str());
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+# else
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+# endif
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+    HANDLE mappingHandle = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mappingHandle == nullptr)
+        return nullptr;
+    void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, size);
+    CloseHandle(mappingHandle);
+    if (data == nullptr)
+        return nullptr;
+    std::shared_ptr<void> mapping(data, [](void* ptr) { UnmapViewOfFile(ptr); });
+#else
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+    std::shared_ptr<void> mapping(data, [size](void* ptr) { munmap(ptr, size); });
+#endif
+
+    return CPtr(new MappedFileBlob(static_cast<uint8_t*>(data), size, std::move(mapping)));
+}
+
+}  // namespace InferenceEngine
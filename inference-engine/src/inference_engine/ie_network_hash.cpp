@@ -0,0 +1,366 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_network_hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/node.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/variant.hpp>
+#include <pugixml.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/primitives_priority_attribute.hpp>
+
+#include "ie_version.hpp"
+#include "network_serializer.h"
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * @brief SHA-256 of the hashed values. A strong digest is used, because a collision would silently make
+ * Core::LoadNetwork use a compiled network of another model.
+ */
+class Hasher {
+public:
+    void update(const void* data, std::size_t size) {
+        auto bytes = static_cast<const std::uint8_t*>(data);
+        _length += size;
+        if (_bufferSize > 0) {
+            auto chunk = std::min(size, _buffer.size() - _bufferSize);
+            std::memcpy(_buffer.data() + _bufferSize, bytes, chunk);
+            _bufferSize += chunk;
+            bytes += chunk;
+            size -= chunk;
+            if (_bufferSize < _buffer.size()) {
+                return;
+            }
+            compress(_buffer.data());
+            _bufferSize = 0;
+        }
+        for (; size >= _buffer.size(); bytes += _buffer.size(), size -= _buffer.size()) {
+            compress(bytes);
+        }
+        std::memcpy(_buffer.data(), bytes, size);
+        _bufferSize = size;
+    }
+
+    void update(const std::string& str) {
+        update(str.data(), str.size());
+        update(str.size());
+    }
+
+    template <typename T>
+    void update(const std::vector<T>& values) {
+        for (auto&& value : values) {
+            update(value);
+        }
+        update(values.size());
+    }
+
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    void update(T value) {
+        update(&value, sizeof(value));
+    }
+
+    std::string str() const {
+        Hasher final = *this;
+        const std::uint64_t bitLength = final._length * 8;
+        const std::uint8_t padding = 0x80;
+        final.update(&padding, 1);
+        const std::uint8_t zero = 0;
+        while (final._bufferSize != _buffer.size() - sizeof(bitLength)) {
+            final.update(&zero, 1);
+        }
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            const auto byte = static_cast<std::uint8_t>(bitLength >> shift);
+            final.update(&byte, 1);
+        }
+
+        std::stringstream strm;
+        for (auto word : final._state) {
+            strm << std::hex << std::setw(8) << std::setfill('0') << word;
+        }
+        return strm.str();
+    }
+
+private:
+    static std::uint32_t rotr(std::uint32_t value, int bits) {
+        return (value >> bits) | (value << (32 - bits));
+    }
+
+    void compress(const std::uint8_t* block) {
+        static const std::uint32_t k[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+        std::uint32_t w[64];
+        for (int i = 0; i < 16; ++i) {
+            w[i] = (static_cast<std::uint32_t>(block[4 * i]) << 24) | (static_cast<std::uint32_t>(block[4 * i + 1]) << 16) |
+                   (static_cast<std::uint32_t>(block[4 * i + 2]) << 8) | static_cast<std::uint32_t>(block[4 * i + 3]);
+        }
+        for (int i = 16; i < 64; ++i) {
+            auto s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            auto s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        auto v = _state;
+        for (int i = 0; i < 64; ++i) {
+            auto s1 = rotr(v[4], 6) ^ rotr(v[4], 11) ^ rotr(v[4], 25);
+            auto ch = (v[4] & v[5]) ^ (~v[4] & v[6]);
+            auto t1 = v[7] + s1 + ch + k[i] + w[i];
+            auto s0 = rotr(v[0], 2) ^ rotr(v[0], 13) ^ rotr(v[0], 22);
+            auto maj = (v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]);
+            auto t2 = s0 + maj;
+            v[7] = v[6];
+            v[6] = v[5];
+            v[5] = v[4];
+            v[4] = v[3] + t1;
+            v[3] = v[2];
+            v[2] = v[1];
+            v[1] = v[0];
+            v[0] = t1 + t2;
+        }
+        for (std::size_t i = 0; i < _state.size(); ++i) {
+            _state[i] += v[i];
+        }
+    }
+
+    std::array<std::uint32_t, 8> _state = {{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                            0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19}};
+    std::array<std::uint8_t, 64> _buffer = {};
+    std::size_t _bufferSize = 0;
+    std::uint64_t _length = 0;
+};
+
+/**
+ * @brief Feeds all node attributes into the hasher. Attributes which cannot be inspected mark the network as
+ * not hashable, so such networks are never taken from the cache.
+ */
+class HashVisitor : public ngraph::AttributeVisitor {
+public:
+    explicit HashVisitor(Hasher& hasher): _hasher(hasher) {}
+
+    using ngraph::AttributeVisitor::on_adapter;
+
+    bool isComplete() const {
+        return _complete;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        (void)adapter;
+        _hasher.update(name);
+        _complete = false;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        _hasher.update(name);
+        _hasher.update(adapter.get_ptr(), adapter.size());
+    }
+
+#define HASH_ATTRIBUTE(type)                                                                    \
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<type>& adapter) override {   \
+        _hasher.update(name);                                                                   \
+        _hasher.update(adapter.get());                                                          \
+    }
+
+    HASH_ATTRIBUTE(std::string)
+    HASH_ATTRIBUTE(bool)
+    HASH_ATTRIBUTE(int8_t)
+    HASH_ATTRIBUTE(int16_t)
+    HASH_ATTRIBUTE(int32_t)
+    HASH_ATTRIBUTE(int64_t)
+    HASH_ATTRIBUTE(uint8_t)
+    HASH_ATTRIBUTE(uint16_t)
+    HASH_ATTRIBUTE(uint32_t)
+    HASH_ATTRIBUTE(uint64_t)
+    HASH_ATTRIBUTE(float)
+    HASH_ATTRIBUTE(double)
+    HASH_ATTRIBUTE(std::vector<int8_t>)
+    HASH_ATTRIBUTE(std::vector<int16_t>)
+    HASH_ATTRIBUTE(std::vector<int32_t>)
+    HASH_ATTRIBUTE(std::vector<int64_t>)
+    HASH_ATTRIBUTE(std::vector<uint8_t>)
+    HASH_ATTRIBUTE(std::vector<uint16_t>)
+    HASH_ATTRIBUTE(std::vector<uint32_t>)
+    HASH_ATTRIBUTE(std::vector<uint64_t>)
+    HASH_ATTRIBUTE(std::vector<float>)
+    HASH_ATTRIBUTE(std::vector<double>)
+    HASH_ATTRIBUTE(std::vector<std::string>)
+
+#undef HASH_ATTRIBUTE
+
+private:
+    Hasher& _hasher;
+    bool _complete = true;
+};
+
+/**
+ * @brief Feeds the runtime info of a node into the hasher, it affects the compilation (e.g. the primitives
+ * priority) and the names of the compiled layers
+ * @return false if the node has an attribute of unknown type, so the network is not cached
+ */
+bool hashRuntimeInfo(Hasher& hasher, const ngraph::Node& node) {
+    for (auto&& item : node.get_rt_info()) {
+        hasher.update(item.first);
+        const auto& variant = item.second;
+        if (variant == nullptr) {
+            hasher.update(0);
+        } else if (auto str = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(variant)) {
+            hasher.update(str->get());
+        } else if (auto num = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::int64_t>>(variant)) {
+            hasher.update(num->get());
+        } else if (auto priority =
+                       std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(variant)) {
+            hasher.update(priority->get().getPrimitivesPriority());
+        } else if (auto names = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::FusedNames>>(variant)) {
+            hasher.update(names->get().getNames());
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool hashFunction(Hasher& hasher, const std::shared_ptr<const ngraph::Function>& function) {
+    std::unordered_map<const ngraph::Node*, std::size_t> nodeIds;
+    HashVisitor visitor(hasher);
+    for (auto&& node : function->get_ordered_ops()) {
+        nodeIds.emplace(node.get(), nodeIds.size());
+        const auto& typeInfo = node->get_type_info();
+        hasher.update(std::string(typeInfo.name));
+        hasher.update(typeInfo.version);
+        hasher.update(node->get_friendly_name());
+
+        for (auto&& input : node->input_values()) {
+            auto it = nodeIds.find(input.get_node());
+            if (it == nodeIds.end()) {
+                return false;
+            }
+            hasher.update(it->second);
+            hasher.update(input.get_index());
+        }
+
+        for (auto&& output : node->outputs()) {
+            hasher.update(output.get_element_type().get_type_name());
+            std::stringstream shape;
+            shape << output.get_partial_shape();
+            hasher.update(shape.str());
+        }
+
+        if (!node->visit_attributes(visitor) || !visitor.isComplete() || !hashRuntimeInfo(hasher, *node)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void hashLegacyNetwork(Hasher& hasher, const ICNNNetwork& network) {
+    pugi::xml_document doc;
+    Serialization::FillXmlDoc(network, doc);
+    std::stringstream xml;
+    doc.save(xml, nullptr, pugi::format_raw);
+    hasher.update(xml.str());
+
+    std::stringstream blobs;
+    Serialization::SerializeBlobs(blobs, network);
+    hasher.update(blobs.str());
+}
+
+void hashBlob(Hasher& hasher, const Blob::Ptr& blob) {
+    if (blob == nullptr) {
+        hasher.update(0);
+        return;
+    }
+    hasher.update(blob->getTensorDesc().getDims());
+    hasher.update(blob->cbuffer().as<const std::uint8_t*>(), blob->byteSize());
+}
+
+}  // namespace
+
+std::string computeNetworkHash(const CNNNetwork& network,
+                               const std::string& deviceName,
+                               const std::map<std::string, std::string>& config,
+                               const std::vector<IExtensionPtr>& extensions) {
+    Hasher hasher;
+    hasher.update(std::string(GetInferenceEngineVersion()->buildNumber));
+    hasher.update(deviceName);
+    for (auto&& item : config) {
+        hasher.update(item.first);
+        hasher.update(item.second);
+    }
+
+    // extensions define operations and their shape inference, so a compiled network depends on them
+    for (auto&& extension : extensions) {
+        const Version* version = nullptr;
+        extension->GetVersion(version);
+        if (version != nullptr) {
+            hasher.update(std::string(version->description ? version->description : ""));
+            hasher.update(std::string(version->buildNumber ? version->buildNumber : ""));
+            hasher.update(version->apiVersion.major);
+            hasher.update(version->apiVersion.minor);
+        }
+        for (auto&& opset : extension->getOpSets()) {
+            hasher.update(opset.first);
+            for (auto&& type : opset.second.get_types_info()) {
+                hasher.update(std::string(type.name));
+                hasher.update(type.version);
+            }
+        }
+    }
+
+    if (auto function = network.getFunction()) {
+        if (!hashFunction(hasher, function)) {
+            return {};
+        }
+    } else {
+        hashLegacyNetwork(hasher, static_cast<const ICNNNetwork&>(network));
+    }
+
+    for (auto&& input : network.getInputsInfo()) {
+        hasher.update(input.first);
+        hasher.update(static_cast<int>(input.second->getPrecision()));
+        hasher.update(static_cast<int>(input.second->getLayout()));
+        const auto& preProcess = input.second->getPreProcess();
+        hasher.update(static_cast<int>(preProcess.getResizeAlgorithm()));
+        hasher.update(static_cast<int>(preProcess.getColorFormat()));
+        hasher.update(static_cast<int>(preProcess.getMeanVariant()));
+        for (std::size_t c = 0; c < preProcess.getNumberOfChannels(); ++c) {
+            hasher.update(preProcess[c]->stdScale);
+            hasher.update(preProcess[c]->meanValue);
+            hashBlob(hasher, preProcess[c]->meanData);
+        }
+    }
+
+    for (auto&& output : network.getOutputsInfo()) {
+        hasher.update(output.first);
+        hasher.update(static_cast<int>(output.second->getPrecision()));
+        hasher.update(static_cast<int>(output.second->getLayout()));
+    }
+
+    return hasher.str();
+}
+
+}  // namespace InferenceEngine
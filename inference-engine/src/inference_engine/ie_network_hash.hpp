@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A file containing helpers to compute a stable SHA-256 digest of a network used as a compiled network cache key
+ * @file ie_network_hash.hpp
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "cpp/ie_cnn_network.h"
+#include "ie_iextension.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Computes a SHA-256 digest of network topology, weights, inputs / outputs information, device name,
+ * config and extensions
+ * @param network A network to compute hash for
+ * @param deviceName A device name the network is loaded to
+ * @param config A load configuration
+ * @param extensions Extensions registered in the Core
+ * @return A hexadecimal string or an empty string if the network contains operations which cannot be hashed reliably
+ */
+std::string computeNetworkHash(const CNNNetwork& network,
+                               const std::string& deviceName,
+                               const std::map<std::string, std::string>& config,
+                               const std::vector<IExtensionPtr>& extensions = {});
+
+}  // namespace InferenceEngine
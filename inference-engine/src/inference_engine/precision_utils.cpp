@@ -4,26 +4,103 @@
 
 #include "precision_utils.h"
 #include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+#endif
+
+#ifdef ENABLE_MKL_DNN
+# define XBYAK_NO_OP_NAMES
+# define XBYAK_UNDEF_JNL
+# include <xbyak_util.h>
+#endif
 
 #include <stdint.h>
 
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+namespace {
 
+// arrays smaller than this are converted by the calling thread
+constexpr size_t parallel_conversion_threshold = 64 * 1024;
+
+using f16tof32ArraysFunc = void (*)(float*, const ie_fp16*, size_t, float, float);
+using f32tof16ArraysFunc = void (*)(ie_fp16*, const float*, size_t, float, float);
+
+void f16tof32Arrays_ref(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
     for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
     }
 }
 
-void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+void f32tof16Arrays_ref(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
     for (size_t i = 0; i < nelem; i++) {
         dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
     }
 }
 
+// NOTE: ie_system_conf.h functions are not available here, since the file is also a part of the legacy library
+#ifdef ENABLE_MKL_DNN
+bool with_cpu(Xbyak::util::Cpu::Type type) {
+    static Xbyak::util::Cpu cpu;
+    return cpu.has(type);
+}
+#endif
+
+f16tof32ArraysFunc get_f16tof32Arrays() {
+#ifdef ENABLE_MKL_DNN
+#ifdef HAVE_AVX512
+    if (with_cpu(Xbyak::util::Cpu::tAVX512F)) return f16tof32Arrays_avx512;
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu(Xbyak::util::Cpu::tAVX2)) return f16tof32Arrays_avx2;
+#endif
+#endif
+    return f16tof32Arrays_ref;
+}
+
+f32tof16ArraysFunc get_f32tof16Arrays() {
+#ifdef ENABLE_MKL_DNN
+#ifdef HAVE_AVX512
+    if (with_cpu(Xbyak::util::Cpu::tAVX512F)) return f32tof16Arrays_avx512;
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu(Xbyak::util::Cpu::tAVX2)) return f32tof16Arrays_avx2;
+#endif
+#endif
+    return f32tof16Arrays_ref;
+}
+
+template <typename Func, typename DstT, typename SrcT>
+void convert_arrays(Func func, DstT* dst, const SrcT* src, size_t nelem, float scale, float bias) {
+    if (nelem < parallel_conversion_threshold) {
+        func(dst, src, nelem, scale, bias);
+        return;
+    }
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(nelem, nthr, ithr, start, end);
+        func(dst + start, src + start, end - start, scale, bias);
+    });
+}
+
+}  // namespace
+
+void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    static const f16tof32ArraysFunc func = get_f16tof32Arrays();
+    convert_arrays(func, dst, src, nelem, scale, bias);
+}
+
+void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    static const f32tof16ArraysFunc func = get_f32tof16Arrays();
+    convert_arrays(func, dst, src, nelem, scale, bias);
+}
+
 // Function to convert F32 into F16
 // F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
 // F16: exp_bias:15  SEEEEEMM MMMMMMMM
@@ -127,9 +204,9 @@ ie_fp16 f32tof16(float x) {
     // check NAN and INF
     if ((v.u & EXP_MASK_F32) == EXP_MASK_F32) {
         if (v.u & 0x007FFFFF) {
-            return s | (v.u >> (23 - 10)) | 0x0200;  // return NAN f16
+            return s | ((v.u >> (23 - 10)) & 0x7FFF) | 0x0200;  // return NAN f16
         } else {
-            return s | (v.u >> (23 - 10));  // return INF f16
+            return s | ((v.u >> (23 - 10)) & 0x7FFF);  // return INF f16
         }
     }
 
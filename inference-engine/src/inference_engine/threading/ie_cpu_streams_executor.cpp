@@ -1,4 +1,4 @@
-// Copyright (C) 2018-2019 Intel Corporation
+// Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -12,6 +12,8 @@
 #include <atomic>
 #include <climits>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
 #include <utility>
 #include "threading/ie_thread_local.hpp"
 #include "ie_profiling.hpp"
@@ -23,6 +25,85 @@
 #include "threading/ie_cpu_streams_executor.hpp"
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue (D. Vyukov algorithm).
+ *        Each stream thread owns one queue: any thread can push tasks into it, the owner pops them
+ *        and idle stream threads steal from it.
+ */
+class TaskQueue {
+public:
+    explicit TaskQueue(std::size_t capacity) :
+        _cells{new Cell[capacity]},
+        _mask{capacity - 1} {
+        assert((capacity & _mask) == 0);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto diff = static_cast<std::intptr_t>(cell->_sequence.load(std::memory_order_acquire)) -
+                        static_cast<std::intptr_t>(pos);
+            if (0 == diff) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_task = std::move(task);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto diff = static_cast<std::intptr_t>(cell->_sequence.load(std::memory_order_acquire)) -
+                        static_cast<std::intptr_t>(pos + 1);
+            if (0 == diff) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        task = std::move(cell->_task);
+        cell->_task = nullptr;
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        Task                        _task;
+    };
+    static constexpr std::size_t cacheLineSize = 64;
+
+    std::unique_ptr<Cell[]>     _cells;
+    const std::size_t           _mask;
+    char                        _pad0[cacheLineSize];
+    std::atomic<std::size_t>    _enqueuePos = {0};
+    char                        _pad1[cacheLineSize];
+    std::atomic<std::size_t>    _dequeuePos = {0};
+    char                        _pad2[cacheLineSize];
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -149,33 +230,84 @@ struct CPUStreamsExecutor::Impl {
                                       static_cast<std::size_t>(_config._streams)),
                              numaNodes.size()),
                     std::back_inserter(_usedNumaNodes));
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue{taskQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 annotateSetThreadName((_config._name + "_" + std::to_string(streamId)).c_str());
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
+                    if (!TryGetTask(streamId, task) && !SpinGetTask(streamId, task)) {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                        ++_sleepingThreads;
+                        _queueCondVar.wait(lock, [&] { return _pendingTasks > 0 || _isStopped; });
+                        --_sleepingThreads;
+                        stopped = _isStopped && (_pendingTasks <= 0);
+                        continue;
                     }
+                    Execute(task, *(_streams.local()));
                 }
             });
         }
     }
 
+    bool TryGetTask(int streamId, Task& task) {
+        const auto streams = static_cast<int>(_taskQueues.size());
+        // the own queue first, then steal from other streams
+        for (int i = 0; i < streams; ++i) {
+            if (_taskQueues[(streamId + i) % streams]->TryPop(task)) {
+                --_pendingTasks;
+                return true;
+            }
+        }
+        if (_overflowTasks > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                --_overflowTasks;
+                --_pendingTasks;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool SpinGetTask(int streamId, Task& task) {
+        if (0 == _config._spinWait) {
+            return false;
+        }
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds{_config._spinWait};
+        while (!_isStopped && (std::chrono::steady_clock::now() < deadline)) {
+            if (TryGetTask(streamId, task)) {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+        return false;
+    }
+
     void Enqueue(Task task) {
-        {
+        const auto streams = _taskQueues.size();
+        const auto first = _nextTaskQueue.fetch_add(1, std::memory_order_relaxed);
+        bool pushed = false;
+        for (std::size_t i = 0; (i < streams) && !pushed; ++i) {
+            pushed = _taskQueues[(first + i) % streams]->TryPush(task);
+        }
+        if (!pushed) {
+            // all stream queues are full, fall back to the shared queue
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            ++_overflowTasks;
+        }
+        ++_pendingTasks;
+        // A stream thread increments `_sleepingThreads` before it checks `_pendingTasks` under the `_mutex`,
+        // so either it sees the new task or we see it sleeping and wake it up
+        if (_sleepingThreads > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -211,10 +343,16 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    static constexpr std::size_t            taskQueueCapacity = 1024;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::atomic<std::size_t>                _nextTaskQueue = {0};
+    std::atomic<int>                        _pendingTasks = {0};
+    std::atomic<int>                        _sleepingThreads = {0};
+    std::atomic<int>                        _overflowTasks = {0};
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
     std::queue<Task>                        _taskQueue;
-    bool                                    _isStopped = false;
+    std::atomic<bool>                       _isStopped = {false};
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
 };
@@ -24,6 +24,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT),
     };
 }
 
@@ -96,6 +97,19 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                                    << ". Expected only non negative numbers (#threads)";
             }
             _threadsPerStream = val_i;
+        } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT)) {
+            int val_i;
+            try {
+                val_i = std::stoi(value);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT)
+                                   << ". Expected only non negative numbers (#microseconds)";
+            }
+            if (val_i < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT)
+                                   << ". Expected only non negative numbers (#microseconds)";
+            }
+            _spinWait = val_i;
         } else {
             THROW_IE_EXCEPTION << "Wrong value for property key " << key;
         }
@@ -120,6 +134,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {_threadsPerStream};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT)) {
+        return {_spinWait};
     } else {
         THROW_IE_EXCEPTION << "Wrong value for property key " << key;
     }
@@ -4,6 +4,7 @@
 
 #include <file_utils.h>
 #include <ie_cnn_net_reader_impl.h>
+#include <mapped_file_blob.hpp>
 
 #include <fstream>
 #include <map>
@@ -38,11 +39,7 @@ StatusCode CNNNetReaderImpl::SetWeights(const TBlob<uint8_t>::Ptr& weights, Resp
     }
     try {
         if (_version == 10) {
-            // It's time to perform actual reading of V10 network and instantiate CNNNetworkNGraphImpl
-            IRReader v10Reader(extensions);
-            std::stringstream model;
-            xmlDoc->save(model);
-            network = std::make_shared<CNNNetworkNGraphImpl>(v10Reader.read(model.str(), weights));
+            ReadV10Network(weights);
         } else if (weights) {
             _parser->SetWeights(weights);
         }
@@ -55,6 +52,16 @@ StatusCode CNNNetReaderImpl::SetWeights(const TBlob<uint8_t>::Ptr& weights, Resp
     return OK;
 }
 
+void CNNNetReaderImpl::ReadV10Network(const Blob::CPtr& weights) {
+    // It's time to perform actual reading of V10 network and instantiate CNNNetworkNGraphImpl,
+    // the stashed xmlDoc is released whatever the result is
+    auto xml = std::move(xmlDoc);
+    IRReader v10Reader(extensions);
+    std::stringstream model;
+    xml->save(model);
+    network = std::make_shared<CNNNetworkNGraphImpl>(v10Reader.read(model.str(), weights));
+}
+
 size_t CNNNetReaderImpl::GetFileVersion(pugi::xml_node& root) {
     return XMLParseUtils::GetUIntAttr(root, "version", 0);
 }
@@ -93,6 +100,14 @@ StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* res
     auto ulFileSize = static_cast<size_t>(fileSize);
 
     try {
+        // Constants of IR v10 networks refer to the read-only mapped memory directly,
+        // layers of older IRs are views of the weights which plugins may modify, so those are read
+        if (_version == 10) {
+            if (auto mappedWeights = MappedFileBlob::create(filepath)) {
+                ReadV10Network(mappedWeights);
+                return OK;
+            }
+        }
         TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(TensorDesc(Precision::U8, {ulFileSize}, Layout::C)));
         weightsPtr->allocate();
         FileUtils::readAllFile(filepath, weightsPtr->buffer(), ulFileSize);
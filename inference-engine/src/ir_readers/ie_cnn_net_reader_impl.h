@@ -86,6 +86,7 @@ private:
     std::shared_ptr<InferenceEngine::details::IFormatParser> _parser;
     size_t GetFileVersion(pugi::xml_node& root);
     StatusCode ReadNetwork();
+    void ReadV10Network(const Blob::CPtr& weights);
 
     std::string description;
     std::string name;
@@ -22,6 +22,7 @@
 #include <ngraph/opsets/opset.hpp>
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 #include <ngraph/variant.hpp>
 
 #include "cnn_network_impl.hpp"
@@ -32,6 +33,7 @@
 #include "generic_ie.hpp"
 #include "precision_utils.h"
 #include "blob_factory.hpp"
+#include "mapped_file_blob.hpp"
 
 using namespace InferenceEngine;
 using namespace XMLParseUtils;
@@ -1399,7 +1401,15 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::cre
     if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
         THROW_IE_EXCEPTION << "Cannot create Constant op " << layerParsePrms.name << " size attribute and shape size are inconsistent!";
 
-    const void * data = (weights->cbuffer().as<uint8_t *>() + offset);
+    char* data = weights->cbuffer().as<char *>() + offset;
+
+    // Weights of a memory mapped file are not copied, the constant keeps the mapping alive instead.
+    // Misaligned data is copied to avoid unaligned access to the constant elements.
+    if (std::dynamic_pointer_cast<const MappedFileBlob>(weights) &&
+        reinterpret_cast<uintptr_t>(data) % std::max<size_t>(el_type.size(), 1) == 0) {
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, size, weights);
+        return std::make_shared<ngraph::op::Constant>(port.precision, shape, buffer);
+    }
 
     return std::make_shared<ngraph::op::Constant>(port.precision, shape, data);
 }
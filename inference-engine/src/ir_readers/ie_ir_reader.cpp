@@ -3,6 +3,7 @@
 //
 
 #include <file_utils.h>
+#include <mapped_file_blob.hpp>
 #include <xml_parse_utils.h>
 
 #include <ie_ir_reader.hpp>
@@ -28,7 +29,7 @@ std::shared_ptr<ngraph::Function> IRReader::read(const std::string& modelPath, c
     std::stringstream modelBuf;
     modelBuf << modelFile.rdbuf();
 
-    Blob::Ptr weights;
+    Blob::CPtr weights;
     std::string bPath = binPath;
     if (bPath.empty()) {
         bPath = modelPath;
@@ -48,9 +49,14 @@ std::shared_ptr<ngraph::Function> IRReader::read(const std::string& modelPath, c
 
         size_t ulFileSize = static_cast<size_t>(fileSize);
 
-        weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {ulFileSize}, Layout::C));
-        weights->allocate();
-        FileUtils::readAllFile(bPath, weights->buffer(), ulFileSize);
+        // Constants of the network refer to the mapped memory directly
+        weights = MappedFileBlob::create(bPath);
+        if (!weights) {
+            auto readWeights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {ulFileSize}, Layout::C));
+            readWeights->allocate();
+            FileUtils::readAllFile(bPath, readWeights->buffer(), ulFileSize);
+            weights = readWeights;
+        }
     }
 
     return read(modelBuf.str(), weights);
@@ -78,6 +78,79 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE
+                    << ". Expected only positive integer numbers";
+            }
+            if (val_i < 1)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE
+                    << ". Expected only positive integer numbers";
+            requestsBatchSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT
+                    << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT
+                    << ". Expected only non negative integer numbers";
+            requestsBatchTimeout = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE
+                    << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE
+                    << ". Expected only non negative integer numbers";
+            traceBufferSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE
+                    << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE
+                    << ". Expected only non negative integer numbers";
+            shapesCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPES_CACHE_PADDING) {
+            if (val == PluginConfigParams::YES) shapesCachePadding = true;
+            else if (val == PluginConfigParams::NO) shapesCachePadding = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPES_CACHE_PADDING
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY) {
+            if (val == PluginConfigParams::CPU_MEMORY_REUSE_SIZE_FIRST)
+                memoryReuseStrategy = MemoryReuseStrategy::SizeFirst;
+            else if (val == PluginConfigParams::CPU_MEMORY_REUSE_LIFETIME_FIRST)
+                memoryReuseStrategy = MemoryReuseStrategy::LifetimeFirst;
+            else if (val == PluginConfigParams::CPU_MEMORY_REUSE_BEST_FIT)
+                memoryReuseStrategy = MemoryReuseStrategy::BestFit;
+            else if (val == PluginConfigParams::CPU_MEMORY_REUSE_MIN)
+                memoryReuseStrategy = MemoryReuseStrategy::Min;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY
+                    << ". Expected only CPU_MEMORY_REUSE_SIZE_FIRST/CPU_MEMORY_REUSE_LIFETIME_FIRST/"
+                    << "CPU_MEMORY_REUSE_BEST_FIT/CPU_MEMORY_REUSE_MIN";
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -122,6 +195,32 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        if (parallelBranches)
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE, std::to_string(requestsBatchSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT, std::to_string(requestsBatchTimeout) });
+        _config.insert({ PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE, std::to_string(traceBufferSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE, std::to_string(shapesCacheSize) });
+        if (shapesCachePadding)
+            _config.insert({ PluginConfigParams::KEY_CPU_SHAPES_CACHE_PADDING, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SHAPES_CACHE_PADDING, PluginConfigParams::NO });
+        switch (memoryReuseStrategy) {
+            case MemoryReuseStrategy::SizeFirst:
+                _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, PluginConfigParams::CPU_MEMORY_REUSE_SIZE_FIRST });
+            break;
+            case MemoryReuseStrategy::LifetimeFirst:
+                _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, PluginConfigParams::CPU_MEMORY_REUSE_LIFETIME_FIRST });
+            break;
+            case MemoryReuseStrategy::BestFit:
+                _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, PluginConfigParams::CPU_MEMORY_REUSE_BEST_FIT });
+            break;
+            case MemoryReuseStrategy::Min:
+                _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, PluginConfigParams::CPU_MEMORY_REUSE_MIN });
+            break;
+        }
     }
 }
 
@@ -25,6 +25,13 @@ struct Config {
         On,
     };
 
+    enum MemoryReuseStrategy {
+        SizeFirst,
+        LifetimeFirst,
+        BestFit,
+        Min,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -33,6 +40,13 @@ struct Config {
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
     bool enforceBF16 = false;
+    bool parallelBranches = false;
+    int requestsBatchSize = 1;
+    int requestsBatchTimeout = 0;
+    int traceBufferSize = 0;
+    int shapesCacheSize = 0;
+    bool shapesCachePadding = false;
+    MemoryReuseStrategy memoryReuseStrategy = MemoryReuseStrategy::SizeFirst;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
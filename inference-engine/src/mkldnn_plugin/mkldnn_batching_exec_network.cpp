@@ -0,0 +1,344 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_batching_exec_network.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <ie_memcpy.h>
+#include <blob_factory.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <cpp_interfaces/exception2status.hpp>
+#include <details/ie_exception_conversion.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+uint8_t* getSlotPtr(const Blob::Ptr& batchedBlob, const Blob::Ptr& blob, size_t slot, size_t slotsNum, const std::string& name) {
+    auto slotSize = batchedBlob->byteSize() / slotsNum;
+    if (blob->byteSize() != slotSize) {
+        THROW_IE_EXCEPTION << "Blob " << name << " size " << blob->byteSize()
+                           << " does not match the size of the network batch element " << slotSize;
+    }
+    auto batchedPtr = batchedBlob->buffer().as<uint8_t*>();
+    if (batchedPtr == nullptr) {
+        THROW_IE_EXCEPTION << "Batched blob " << name << " is not allocated";
+    }
+    return batchedPtr + slot * slotSize;
+}
+
+}  // namespace
+
+// ------------------------------MKLDNNBatchingInferRequest----------------------------
+
+MKLDNNBatchingInferRequest::MKLDNNBatchingInferRequest(const InputsDataMap&   networkInputs,
+                                                       const OutputsDataMap&  networkOutputs)
+        : InferRequestInternal(networkInputs, networkOutputs) {
+    for (const auto& it : networkInputs) {
+        _inputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _inputs[it.first]->allocate();
+    }
+    for (const auto& it : networkOutputs) {
+        _outputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _outputs[it.first]->allocate();
+    }
+}
+
+void MKLDNNBatchingInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const {
+    perfMap = _perfMap;
+}
+
+void MKLDNNBatchingInferRequest::CopyInputsTo(InferRequest& batchedRequest, size_t slot, size_t slotsNum) {
+    // this request is already in BUSY state, so using the internal functions safely
+    for (auto&& input : _inputs) {
+        auto batchedBlob = batchedRequest.GetBlob(input.first);
+        auto dstPtr = getSlotPtr(batchedBlob, input.second, slot, slotsNum, input.first);
+        if (_preProcData.find(input.first) != _preProcData.end()) {
+            // pre-processing writes its result directly into the slot, the blob of this request is not used
+            BlobMap slotInputs = {{input.first, make_blob_with_precision(input.second->getTensorDesc(), dstPtr)}};
+            execDataPreprocessing(slotInputs);
+            continue;
+        }
+        auto srcPtr = input.second->cbuffer().as<const uint8_t*>();
+        if (srcPtr == nullptr) {
+            THROW_IE_EXCEPTION << "Input blob " << input.first << " is not allocated or has unsupported type";
+        }
+        ie_memcpy(dstPtr, input.second->byteSize(), srcPtr, input.second->byteSize());
+    }
+}
+
+void MKLDNNBatchingInferRequest::CopyOutputsFrom(InferRequest& batchedRequest, size_t slot, size_t slotsNum) {
+    for (auto&& output : _outputs) {
+        auto dstPtr = output.second->buffer().as<uint8_t*>();
+        if (dstPtr == nullptr) {
+            THROW_IE_EXCEPTION << "Output blob " << output.first << " is not allocated or has unsupported type";
+        }
+        auto batchedBlob = batchedRequest.GetBlob(output.first);
+        auto srcPtr = getSlotPtr(batchedBlob, output.second, slot, slotsNum, output.first);
+        ie_memcpy(dstPtr, output.second->byteSize(), srcPtr, output.second->byteSize());
+    }
+}
+
+// ------------------------------MKLDNNBatchingAsyncInferRequest----------------------------
+
+MKLDNNBatchingAsyncInferRequest::MKLDNNBatchingAsyncInferRequest(const MKLDNNBatchingInferRequest::Ptr&  inferRequest,
+                                                                 const MKLDNNBatchingExecNetwork::Ptr&   batchingExecNetwork,
+                                                                 const ITaskExecutor::Ptr&               callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _inferRequest{inferRequest},
+    _batchingExecNetwork{batchingExecNetwork} {
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(MKLDNNBatchingAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_exception = nullptr;
+            _this->_batchingExecNetwork->Enqueue({_this, std::move(task), MKLDNNBatchingExecNetwork::Clock::now()});
+        }
+        MKLDNNBatchingAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        {std::make_shared<ThisRequestExecutor>(this), [this] {
+            if (nullptr != _exception) {
+                std::rethrow_exception(_exception);
+            }
+        }}
+    };
+}
+
+void MKLDNNBatchingAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+MKLDNNBatchingAsyncInferRequest::~MKLDNNBatchingAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------MKLDNNBatchingExecNetwork----------------------------
+
+MKLDNNBatchingExecNetwork::MKLDNNBatchingExecNetwork(const ExecutableNetworkInternal::Ptr&  network,
+                                                     int                                    batchSize,
+                                                     int                                    networkBatchSize,
+                                                     std::chrono::microseconds              timeout,
+                                                     bool                                   needPerfCounters) :
+    ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<ImmediateExecutor>()),
+    _network{network},
+    _batchSize{batchSize},
+    _networkBatchSize{networkBatchSize},
+    _timeout{timeout},
+    _needPerfCounters{needPerfCounters},
+    _batchSizeHistogram{new std::atomic<unsigned int>[batchSize]} {
+    for (int i = 0; i < _batchSize; i++) {
+        _batchSizeHistogram[i] = 0;
+    }
+
+    Parameter optimalNumberOfRequests;
+    _network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS), optimalNumberOfRequests, nullptr);
+    auto numRequests = std::max(optimalNumberOfRequests.as<unsigned int>(), 1u);
+    for (unsigned int i = 0; i < numRequests; i++) {
+        std::unique_ptr<WorkerInferRequest> workerRequest{new WorkerInferRequest};
+        IInferRequest::Ptr inferRequest;
+        _network->CreateInferRequest(inferRequest);
+        workerRequest->_inferRequest = InferRequest{inferRequest};
+        auto workerRequestPtr = workerRequest.get();
+        workerRequest->_inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [this, workerRequestPtr] (InferRequest, StatusCode status) {
+                OnBatchCompleted(workerRequestPtr, status);
+            });
+        _idleWorkerRequests.push_back(workerRequestPtr);
+        _workerRequests.emplace_back(std::move(workerRequest));
+    }
+
+    if (_timeout.count() > 0) {
+        _timeoutThread = std::thread{[this] { FlushOnTimeout(); }};
+    }
+}
+
+MKLDNNBatchingExecNetwork::~MKLDNNBatchingExecNetwork() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _terminate = true;
+    }
+    _timeoutCondVar.notify_all();
+    if (_timeoutThread.joinable()) {
+        _timeoutThread.join();
+    }
+    /* NOTE: Batching infer requests hold the network, so there are no pending requests at this point.
+     *       Worker infer request destructors wait for the batches in flight.
+     */
+    _workerRequests.clear();
+}
+
+void MKLDNNBatchingExecNetwork::Enqueue(PendingRequest pendingRequest) {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _pendingRequests.push_back(std::move(pendingRequest));
+    ScheduleBatches(lock);
+}
+
+void MKLDNNBatchingExecNetwork::ScheduleBatches(std::unique_lock<std::mutex>& lock) {
+    while (!_idleWorkerRequests.empty() && !_pendingRequests.empty()) {
+        bool batchIsReady = _timeout.count() == 0 ||
+                            _pendingRequests.size() >= static_cast<size_t>(_batchSize) ||
+                            Clock::now() - _pendingRequests.front()._arrivalTime >= _timeout;
+        if (!batchIsReady) {
+            _timeoutCondVar.notify_one();
+            break;
+        }
+
+        auto workerRequest = _idleWorkerRequests.back();
+        _idleWorkerRequests.pop_back();
+        auto batchEnd = _pendingRequests.begin() + std::min(_pendingRequests.size(), static_cast<size_t>(_batchSize));
+        std::vector<PendingRequest> batch{std::make_move_iterator(_pendingRequests.begin()),
+                                          std::make_move_iterator(batchEnd)};
+        _pendingRequests.erase(_pendingRequests.begin(), batchEnd);
+
+        lock.unlock();
+        bool started = RunBatch(workerRequest, std::move(batch));
+        lock.lock();
+
+        if (!started) {
+            _idleWorkerRequests.push_back(workerRequest);
+        }
+    }
+}
+
+bool MKLDNNBatchingExecNetwork::RunBatch(WorkerInferRequest* workerRequest, std::vector<PendingRequest> batch) {
+    std::exception_ptr exception;
+    try {
+        for (size_t slot = 0; slot < batch.size(); slot++) {
+            batch[slot]._request->_inferRequest->CopyInputsTo(workerRequest->_inferRequest, slot, _batchSize);
+        }
+        workerRequest->_inferRequest.SetBatch(static_cast<int>(batch.size()) * _networkBatchSize);
+        _batchSizeHistogram[batch.size() - 1]++;
+        workerRequest->_batch = std::move(batch);
+        workerRequest->_inferRequest.StartAsync();
+        return true;
+    } catch (...) {
+        exception = std::current_exception();
+    }
+
+    if (!workerRequest->_batch.empty()) {
+        batch = std::move(workerRequest->_batch);
+        workerRequest->_batch.clear();
+    }
+    for (auto&& pendingRequest : batch) {
+        pendingRequest._request->_exception = exception;
+        pendingRequest._task();
+    }
+    return false;
+}
+
+void MKLDNNBatchingExecNetwork::OnBatchCompleted(WorkerInferRequest* workerRequest, StatusCode status) {
+    auto batch = std::move(workerRequest->_batch);
+    workerRequest->_batch.clear();
+
+    std::exception_ptr exception;
+    if (StatusCode::OK != status) {
+        exception = InferenceEngine::CurrentException();
+        if (nullptr == exception) {
+            try {
+                THROW_IE_EXCEPTION << details::as_status << status;
+            } catch (...) {
+                exception = std::current_exception();
+            }
+        }
+    } else {
+        try {
+            std::map<std::string, InferenceEngineProfileInfo> perfMap;
+            if (_needPerfCounters) {
+                perfMap = workerRequest->_inferRequest.GetPerformanceCounts();
+            }
+            for (size_t slot = 0; slot < batch.size(); slot++) {
+                auto& inferRequest = batch[slot]._request->_inferRequest;
+                inferRequest->CopyOutputsFrom(workerRequest->_inferRequest, slot, _batchSize);
+                inferRequest->_perfMap = perfMap;
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+
+    for (auto&& pendingRequest : batch) {
+        pendingRequest._request->_exception = exception;
+        pendingRequest._task();
+    }
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    _idleWorkerRequests.push_back(workerRequest);
+    if (!_terminate) {
+        ScheduleBatches(lock);
+    }
+}
+
+void MKLDNNBatchingExecNetwork::FlushOnTimeout() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    while (!_terminate) {
+        if (_pendingRequests.empty() || _idleWorkerRequests.empty()) {
+            _timeoutCondVar.wait(lock);
+            continue;
+        }
+        auto deadline = _pendingRequests.front()._arrivalTime + _timeout;
+        if (Clock::now() < deadline) {
+            _timeoutCondVar.wait_until(lock, deadline);
+            continue;
+        }
+        ScheduleBatches(lock);
+    }
+}
+
+InferRequestInternal::Ptr MKLDNNBatchingExecNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                            OutputsDataMap networkOutputs) {
+    return std::make_shared<MKLDNNBatchingInferRequest>(networkInputs, networkOutputs);
+}
+
+void MKLDNNBatchingExecNetwork::CreateInferRequest(IInferRequest::Ptr& asyncRequest) {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncRequestImpl = std::make_shared<MKLDNNBatchingAsyncInferRequest>(
+        std::static_pointer_cast<MKLDNNBatchingInferRequest>(syncRequestImpl),
+        std::static_pointer_cast<MKLDNNBatchingExecNetwork>(shared_from_this()),
+        _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<MKLDNNBatchingAsyncInferRequest>(asyncRequestImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
+}
+
+void MKLDNNBatchingExecNetwork::GetConfig(const std::string& name, Parameter& result, ResponseDesc* resp) const {
+    _network->GetConfig(name, result, resp);
+}
+
+void MKLDNNBatchingExecNetwork::GetMetric(const std::string& name, Parameter& result, ResponseDesc* resp) const {
+    if (name == METRIC_KEY(CPU_REQUESTS_BATCH_SIZE_HISTOGRAM)) {
+        std::vector<unsigned int> histogram;
+        for (int i = 0; i < _batchSize; i++) {
+            histogram.push_back(_batchSizeHistogram[i].load());
+        }
+        result = IE_SET_METRIC(CPU_REQUESTS_BATCH_SIZE_HISTOGRAM, histogram);
+    } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        // enough requests to fill batches of all worker requests
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS,
+                               static_cast<unsigned int>(_workerRequests.size() * _batchSize));
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        _network->GetMetric(name, result, resp);
+        auto metrics = result.as<std::vector<std::string>>();
+        metrics.push_back(METRIC_KEY(CPU_REQUESTS_BATCH_SIZE_HISTOGRAM));
+        result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
+    } else {
+        _network->GetMetric(name, result, resp);
+    }
+}
+
+void MKLDNNBatchingExecNetwork::GetExecGraphInfo(ICNNNetwork::Ptr& graphPtr) {
+    _network->GetExecGraphInfo(graphPtr);
+}
@@ -0,0 +1,152 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp/ie_infer_request.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Infer request of the batching network. Holds blobs of a single (not batched) request,
+ * the data is gathered to and scattered from a batched worker infer request.
+ */
+class MKLDNNBatchingInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<MKLDNNBatchingInferRequest>;
+    MKLDNNBatchingInferRequest(const InferenceEngine::InputsDataMap&  networkInputs,
+                               const InferenceEngine::OutputsDataMap& networkOutputs);
+
+    void InferImpl() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const override;
+
+    /* NOTE: Request blobs cannot be views of slots of the worker request blobs, so the data is copied:
+     *       - a request gets a worker request and a slot only when a batch is formed, in the order of arrival,
+     *         while the user fills the input blobs and keeps the output blobs outside of any batch;
+     *       - the dynamic batch executes the first elements of the batched blobs only, so the slots of a batch
+     *         are filled from the first one on, whichever requests make the batch;
+     *       - the worker request starts the next batch as soon as outputs of the previous one are copied,
+     *         while the user may read them later.
+     *       The pre-processing output is the exception, it is written directly into the slot.
+     */
+    // copies input data into `slot` element of the worker request input blobs which hold `slotsNum` requests
+    void CopyInputsTo(InferenceEngine::InferRequest& batchedRequest, size_t slot, size_t slotsNum);
+    // copies `slot` element of the worker request output blobs which hold `slotsNum` requests into the output blobs
+    void CopyOutputsFrom(InferenceEngine::InferRequest& batchedRequest, size_t slot, size_t slotsNum);
+
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> _perfMap;
+};
+
+class MKLDNNBatchingAsyncInferRequest;
+
+/**
+ * @brief Executable network which collects incoming infer requests into batches up to the given size or timeout
+ * and executes them as a single batched request of the underlying network using the dynamic batch feature.
+ */
+class MKLDNNBatchingExecNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<MKLDNNBatchingExecNetwork>;
+    using Clock = std::chrono::steady_clock;
+
+    struct PendingRequest {
+        MKLDNNBatchingAsyncInferRequest*    _request;
+        InferenceEngine::Task               _task;
+        Clock::time_point                   _arrivalTime;
+    };
+
+    struct WorkerInferRequest {
+        InferenceEngine::InferRequest       _inferRequest;
+        std::vector<PendingRequest>         _batch;
+    };
+
+    /**
+     * @param network A network loaded with `batchSize * networkBatchSize` batch and enabled dynamic batch
+     * @param batchSize A maximal number of infer requests combined into one batch
+     * @param networkBatchSize A batch size of the original network
+     * @param timeout A time to wait for a batch to be filled. If zero, requests are executed as soon as
+     *                a worker request is available with the batch of all the requests waiting at this moment.
+     */
+    MKLDNNBatchingExecNetwork(const InferenceEngine::ExecutableNetworkInternal::Ptr& network,
+                              int                                                    batchSize,
+                              int                                                    networkBatchSize,
+                              std::chrono::microseconds                              timeout,
+                              bool                                                   needPerfCounters);
+
+    ~MKLDNNBatchingExecNetwork() override;
+
+    InferenceEngine::InferRequestInternal::Ptr
+    CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                           InferenceEngine::OutputsDataMap networkOutputs) override;
+
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr& asyncRequest) override;
+
+    void GetConfig(const std::string& name, InferenceEngine::Parameter& result, InferenceEngine::ResponseDesc* resp) const override;
+
+    void GetMetric(const std::string& name, InferenceEngine::Parameter& result, InferenceEngine::ResponseDesc* resp) const override;
+
+    void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr& graphPtr) override;
+
+    void Enqueue(PendingRequest pendingRequest);
+
+private:
+    void ScheduleBatches(std::unique_lock<std::mutex>& lock);
+    bool RunBatch(WorkerInferRequest* workerRequest, std::vector<PendingRequest> batch);
+    void OnBatchCompleted(WorkerInferRequest* workerRequest, InferenceEngine::StatusCode status);
+    void FlushOnTimeout();
+
+    InferenceEngine::ExecutableNetworkInternal::Ptr     _network;
+    const int                                           _batchSize;
+    const int                                           _networkBatchSize;
+    const std::chrono::microseconds                     _timeout;
+    const bool                                          _needPerfCounters;
+
+    std::mutex                                          _mutex;
+    std::condition_variable                             _timeoutCondVar;
+    bool                                                _terminate = false;
+    std::deque<PendingRequest>                          _pendingRequests;
+    std::vector<WorkerInferRequest*>                    _idleWorkerRequests;
+    std::vector<std::unique_ptr<WorkerInferRequest>>    _workerRequests;
+    std::thread                                         _timeoutThread;
+
+    // i-th element is a number of executed batches of `i + 1` requests
+    std::unique_ptr<std::atomic<unsigned int>[]>        _batchSizeHistogram;
+};
+
+class MKLDNNBatchingAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<MKLDNNBatchingAsyncInferRequest>;
+
+    MKLDNNBatchingAsyncInferRequest(const MKLDNNBatchingInferRequest::Ptr&      inferRequest,
+                                    const MKLDNNBatchingExecNetwork::Ptr&       batchingExecNetwork,
+                                    const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+
+    void Infer_ThreadUnsafe() override;
+
+    ~MKLDNNBatchingAsyncInferRequest() override;
+
+    MKLDNNBatchingInferRequest::Ptr     _inferRequest;
+    std::exception_ptr                  _exception;
+
+protected:
+    MKLDNNBatchingExecNetwork::Ptr      _batchingExecNetwork;
+};
+
+}  // namespace MKLDNNPlugin
@@ -23,9 +23,18 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
+#include <network_serializer.h>
+#include <xml_parse_utils.h>
+#include <pugixml.hpp>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
 #include <unordered_set>
 #include <utility>
+#include <sstream>
+#include <string>
+#include <vector>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -41,15 +50,26 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     bool isTransformed,
+                                     const MKLDNNGraphState::Ptr &graphState) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _graphState{graphState} {
+    _clonedNetwork = cloneNet(network);
+    // an imported network was exported after the transformations, so they are not applied twice
+    if (!isTransformed) {
+        TransformClonedNetwork(network);
+    }
+
+    CreateGraphs(numaNodesWeights);
+}
+
+void MKLDNNExecNetwork::TransformClonedNetwork(const InferenceEngine::ICNNNetwork &network) {
     ICNNNetworkStats* pstats = nullptr;
     StatusCode s = network.getStats(&pstats, nullptr);
-    // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNet(network);
 
     IE_SUPPRESS_DEPRECATED_START
     if (Precision::FP16 == network.getPrecision()) {
@@ -101,7 +121,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             if (with_cpu_x86_bfloat16() && isFloatModel) {
                 BF16Transformer bf16Transformer;
                 CNNNetwork cnnetwork(_clonedNetwork);
-                if (cfg.enforceBF16 == true) {
+                if (_cfg.enforceBF16 == true) {
                     bf16Transformer.convertToBFloat16(cnnetwork);
                 } else {
                     bf16Transformer.optimizeToFloat(cnnetwork);
@@ -115,7 +135,265 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     }
 
     MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*_clonedNetwork));
+}
+
+// Reads the graph state written by ExportImpl, the weights are stored after their memory descriptors in graphData
+static MKLDNNGraphState::Ptr ReadGraphState(const pugi::xml_node &graphNode, const std::vector<char> &graphData) {
+    using namespace XMLParseUtils;
+
+    auto graphState = std::make_shared<MKLDNNGraphState>();
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    std::map<std::uint64_t, MKLDNNMemoryPtr> weights;
+    for (auto node = graphNode.child("node"); !node.empty(); node = node.next_sibling("node")) {
+        auto& nodeState = graphState->nodes[GetStrAttr(node, "name")];
+        nodeState.primitiveDescriptor = GetIntAttr(node, "descriptor");
+        std::stringstream implementations(GetStrAttr(node, "implementations", ""));
+        for (std::string type; std::getline(implementations, type, ',');) {
+            nodeState.implementationTypes.push_back(static_cast<impl_desc_type>(std::stoi(type)));
+        }
+        for (auto layout = node.child("layout"); !layout.empty(); layout = layout.next_sibling("layout")) {
+            nodeState.layouts.push_back(GetStrAttr(layout, "value", ""));
+        }
+        for (auto weightsNode = node.child("weights"); !weightsNode.empty();
+                weightsNode = weightsNode.next_sibling("weights")) {
+            auto index = GetUInt64Attr(weightsNode, "index");
+            auto offset = GetUInt64Attr(weightsNode, "offset");
+            auto size = GetUInt64Attr(weightsNode, "size");
+            if (offset > graphData.size() || graphData.size() - offset < sizeof(mkldnn_memory_desc_t) + size) {
+                THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: weights of node "
+                                   << GetStrAttr(node, "name") << " are out of the data";
+            }
+            // the weights shared by several nodes are stored once
+            auto& memory = weights[offset];
+            if (memory == nullptr) {
+                mkldnn_memory_desc_t desc;
+                std::memcpy(&desc, &graphData[offset], sizeof(desc));
+                memory = std::make_shared<MKLDNNMemory>(eng);
+                memory->Create(mkldnn::memory::desc(desc));
+                if (memory->GetPrimitiveDescriptor().get_size() != size) {
+                    THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: weights of node "
+                                       << GetStrAttr(node, "name") << " do not match their descriptor";
+                }
+                std::memcpy(memory->GetData(), &graphData[offset + sizeof(desc)], size);
+            }
+            if (nodeState.weights.size() <= index) {
+                nodeState.weights.resize(index + 1);
+            }
+            nodeState.weights[index] = memory;
+        }
+    }
+    return graphState;
+}
+
+InferenceEngine::details::CNNNetworkImplPtr
+MKLDNNExecNetwork::ReadExportedNetwork(std::istream &networkModel,
+                                       Config &cfg,
+                                       MKLDNNGraphState::Ptr &graphState,
+                                       const std::map<std::string, std::string> &config,
+                                       ICore *core) {
+    std::string cpuXmlStr;
+    std::getline(networkModel, cpuXmlStr);
+
+    pugi::xml_document cpuXmlDoc;
+    pugi::xml_parse_result res = cpuXmlDoc.load(cpuXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+
+    pugi::xml_node cpuNode = cpuXmlDoc.document_element();
+
+    std::map<std::string, std::string> importedConfigs;
+    auto configsNode = cpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty();
+            configNode = configNode.next_sibling("config")) {
+        importedConfigs.emplace(GetStrAttr(configNode, "key"), GetStrAttr(configNode, "value"));
+    }
+    for (auto&& c : config) {
+        importedConfigs[c.first] = c.second;
+    }
+    cfg.readProperties(importedConfigs);
+
+    // read XML content
+    std::string xmlString;
+    std::getline(networkModel, xmlString);
+    std::uint64_t dataSize = 0;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+
+    // read blob content
+    Blob::Ptr dataBlob;
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        networkModel.read(dataBlob->buffer(), dataSize);
+    }
+
+    // the reordered weights of the graph follow the network weights
+    auto graphNode = cpuNode.child("graph");
+    std::vector<char> graphData;
+    if (!graphNode.empty()) {
+        std::uint64_t graphDataSize = 0;
+        networkModel.read(reinterpret_cast<char*>(&graphDataSize), sizeof(graphDataSize));
+        if (networkModel.good()) {
+            graphData.resize(static_cast<std::size_t>(graphDataSize));
+            networkModel.read(graphData.data(), graphDataSize);
+        }
+    }
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin exported network: unexpected end of stream";
+    }
+
+    graphState = graphNode.empty() ? nullptr : ReadGraphState(graphNode, graphData);
+
+    // The exported network is already transformed, so low precision, BF16 and unroll passes are not run again
+    CNNNetwork cnnnetwork = core->ReadNetwork(xmlString, std::move(dataBlob));
+
+    auto outputsNode = cpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        cnnnetwork.addOutput(GetStrAttr(outputNode, "creatorName"), GetUInt64Attr(outputNode, "index"));
+    }
+    auto network = cloneNet(static_cast<ICNNNetwork&>(cnnnetwork));
+    network->setName(GetStrAttr(cpuNode, "name"));
+
+    InputsDataMap inputs;
+    network->getInputsInfo(inputs);
+    auto inputsNode = cpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto itInput = inputs.find(GetStrAttr(inputNode, "name"));
+        if (itInput == inputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network does not contain input " << GetStrAttr(inputNode, "name");
+        }
+        itInput->second->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        itInput->second->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+        auto& preProcess = itInput->second->getPreProcess();
+        preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(GetIntAttr(inputNode, "resize")));
+        preProcess.setColorFormat(static_cast<ColorFormat>(GetIntAttr(inputNode, "color")));
+    }
+
+    OutputsDataMap outputs;
+    network->getOutputsInfo(outputs);
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto itOutput = outputs.find(GetStrAttr(outputNode, "name"));
+        if (itOutput == outputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network does not contain output " << GetStrAttr(outputNode, "name");
+        }
+        itOutput->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        itOutput->second->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+
+    return network;
+}
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+    cpuNode.append_attribute("name").set_value(_name.c_str());
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& networkInput : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(networkInput.first.c_str());
+        inputNode.append_attribute("precision").set_value(networkInput.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(networkInput.second->getLayout()));
+        const auto& preProcess = networkInput.second->getPreProcess();
+        if (preProcess.getMeanVariant() != MeanVariant::NONE) {
+            THROW_IE_EXCEPTION << "Cannot export CPU network: mean pre-processing of input " << networkInput.first
+                               << " is not supported";
+        }
+        inputNode.append_attribute("resize").set_value(static_cast<int>(preProcess.getResizeAlgorithm()));
+        inputNode.append_attribute("color").set_value(static_cast<int>(preProcess.getColorFormat()));
+    }
+
+    OutputsDataMap clonedOutputs;
+    _clonedNetwork->getOutputsInfo(clonedOutputs);
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& networkOutput : _networkOutputs) {
+        auto itOutput = clonedOutputs.find(networkOutput.first);
+        if (itOutput == clonedOutputs.end()) {
+            THROW_IE_EXCEPTION << "Cannot export CPU network: output " << networkOutput.first << " is not found";
+        }
+        auto outputNode = outputsNode.append_child("output");
+        auto& data = itOutput->second;
+        auto creator = data->getCreatorLayer().lock();
+        auto& outDatas = creator->outData;
+        auto itData = std::find(std::begin(outDatas), std::end(outDatas), data);
+        IE_ASSERT(outDatas.end() != itData);
+        std::uint64_t index = std::distance(std::begin(outDatas), itData);
+        outputNode.append_attribute("creatorName").set_value(creator->name.c_str());
+        outputNode.append_attribute("index").set_value(std::to_string(index).c_str());
+        outputNode.append_attribute("name").set_value(networkOutput.first.c_str());
+        outputNode.append_attribute("precision").set_value(networkOutput.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(networkOutput.second->getLayout()));
+    }
 
+    // the selected descriptors and the reordered weights, so the import does not select and reorder them again
+    auto graphNode = cpuNode.append_child("graph");
+    auto graphState = _graphs.begin()->get()->GetState();
+    std::vector<MKLDNNMemoryPtr> weights;
+    std::map<const MKLDNNMemory*, std::uint64_t> weightsOffsets;
+    std::uint64_t graphDataSize = 0;
+    for (auto&& nodeState : graphState->nodes) {
+        auto node = graphNode.append_child("node");
+        node.append_attribute("name").set_value(nodeState.first.c_str());
+        node.append_attribute("descriptor").set_value(nodeState.second.primitiveDescriptor);
+        std::string implementations;
+        for (auto type : nodeState.second.implementationTypes) {
+            implementations += (implementations.empty() ? "" : ",") + std::to_string(static_cast<int>(type));
+        }
+        node.append_attribute("implementations").set_value(implementations.c_str());
+        for (auto&& layout : nodeState.second.layouts) {
+            node.append_child("layout").append_attribute("value").set_value(layout.c_str());
+        }
+        for (std::size_t index = 0; index < nodeState.second.weights.size(); index++) {
+            auto& memory = nodeState.second.weights[index];
+            // Winograd weights have no blocking descriptor to compare with on import
+            if (memory == nullptr || memory->GetFormat() == mkldnn::memory::wino_fmt) {
+                continue;
+            }
+            auto size = static_cast<std::uint64_t>(memory->GetPrimitiveDescriptor().get_size());
+            auto itOffset = weightsOffsets.find(memory.get());
+            if (itOffset == weightsOffsets.end()) {
+                itOffset = weightsOffsets.emplace(memory.get(), graphDataSize).first;
+                weights.push_back(memory);
+                graphDataSize += sizeof(mkldnn_memory_desc_t) + size;
+            }
+            auto weightsNode = node.append_child("weights");
+            weightsNode.append_attribute("index").set_value(std::to_string(index).c_str());
+            weightsNode.append_attribute("offset").set_value(std::to_string(itOffset->second).c_str());
+            weightsNode.append_attribute("size").set_value(std::to_string(size).c_str());
+        }
+    }
+
+    auto configsNode = cpuNode.append_child("configs");
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        for (auto&& config : _cfg._config) {
+            auto configNode = configsNode.append_child("config");
+            configNode.append_attribute("key").set_value(config.first.c_str());
+            configNode.append_attribute("value").set_value(config.second.c_str());
+        }
+    }
+
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+
+    pugi::xml_document networkDoc;
+    auto dataSize = static_cast<std::uint64_t>(Serialization::FillXmlDoc(*_clonedNetwork, networkDoc));
+    networkDoc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+    networkModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    Serialization::SerializeBlobs(networkModel, *_clonedNetwork);
+
+    networkModel.write(reinterpret_cast<char*>(&graphDataSize), sizeof(graphDataSize));
+    for (auto&& memory : weights) {
+        auto desc = memory->GetDescriptor().data;
+        networkModel.write(reinterpret_cast<const char*>(&desc), sizeof(desc));
+        networkModel.write(static_cast<const char*>(memory->GetData()), memory->GetPrimitiveDescriptor().get_size());
+    }
+}
+
+void MKLDNNExecNetwork::CreateGraphs(NumaNodesWeights &numaNodesWeights) {
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
         if (!CanProcessDynBatch(*_clonedNetwork)) {
@@ -123,14 +401,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
     }
 
-    if (cfg.exclusiveAsyncRequests) {
+    if (_cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
         const int env_threads = parallel_get_env_threads();
         const auto& numa_nodes = getAvailableNUMANodes();
         const auto numa_nodes_num = numa_nodes.size();
-        auto streamExecutorConfig = cfg.streamExecutorConfig;
+        auto streamExecutorConfig = _cfg.streamExecutorConfig;
         // use logical cores only for single-socket targets in throughput mode
         const int hw_cores = streamExecutorConfig._streams > 1 && numa_nodes_num == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
         const int threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (env_threads ? env_threads : hw_cores);
@@ -140,7 +418,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         streamExecutorConfig._name = "CPUStreamsExecutor";
         _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamExecutorConfig);
     }
-    if (0 != cfg.streamExecutorConfig._streams) {
+    if (0 != _cfg.streamExecutorConfig._streams) {
         _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
             IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
     } else {
@@ -156,6 +434,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             std::unique_lock<std::mutex> lock{_cfgMutex};
             graph->setConfig(_cfg);
         }
+        graph->setRestoredState(_graphState);
         int numaNode = 0;
         auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
         if (nullptr != streamExecutor) {
@@ -240,6 +519,8 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_TRACE));
+        metrics.push_back(METRIC_KEY(CPU_MEMORY_REUSE_REPORT));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -254,6 +535,17 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto streams = std::stoi(option->second);
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_TRACE)) {
+        std::vector<MKLDNNTraceEvent> events;
+        int streamId = 0;
+        for (auto&& graph : _graphs) {
+            graph->GetTraceEvents(events, std::to_string(streamId++));
+        }
+        std::ostringstream trace;
+        WriteChromeTrace(trace, events);
+        result = IE_SET_METRIC(CPU_TRACE, trace.str());
+    } else if (name == METRIC_KEY(CPU_MEMORY_REUSE_REPORT)) {
+        result = IE_SET_METRIC(CPU_MEMORY_REUSE_REPORT, _graphs.begin()->get()->getMemoryReuseReport());
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
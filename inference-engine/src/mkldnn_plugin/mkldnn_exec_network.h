@@ -9,11 +9,14 @@
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
+#include <ie_icore.hpp>
 
 #include <vector>
 #include <memory>
 #include <map>
 #include <string>
+#include <istream>
+#include <ostream>
 #include <cnn_network_impl.hpp>
 #include <unordered_map>
 
@@ -29,8 +32,24 @@ public:
 
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
 
+    /**
+     * @param isTransformed true if the network is read by ReadExportedNetwork, so the precision, low precision,
+     *        BF16 and unroll transformations are already applied to it
+     * @param graphState The state of the exported graphs read by ReadExportedNetwork or nullptr
+     */
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      bool isTransformed = false, const MKLDNNGraphState::Ptr &graphState = nullptr);
+
+    /**
+     * Reads the network written by ExportImpl.
+     * @param cfg Is updated with the exported config, which is overridden by config
+     * @param graphState Is set to the primitive descriptors and the weights of the exported graph
+     * @return The transformed network with the exported inputs and outputs information
+     */
+    static InferenceEngine::details::CNNNetworkImplPtr
+    ReadExportedNetwork(std::istream &networkModel, Config &cfg, MKLDNNGraphState::Ptr &graphState,
+                        const std::map<std::string, std::string> &config, InferenceEngine::ICore *core);
 
     ~MKLDNNExecNetwork() override = default;
 
@@ -44,6 +63,8 @@ public:
 
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
+    void ExportImpl(std::ostream &networkModel) override;
+
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
 protected:
@@ -55,9 +76,14 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    MKLDNNGraphState::Ptr                       _graphState;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
+
+    void TransformClonedNetwork(const InferenceEngine::ICNNNetwork &network);
+
+    void CreateGraphs(NumaNodesWeights &numaNodesWeights);
 };
 
 }  // namespace MKLDNNPlugin
@@ -12,6 +12,12 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <numeric>
+#include <atomic>
+#include <functional>
+#include <set>
+#include <sstream>
+#include <thread>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -37,6 +43,10 @@
 
 #include "utils/blob_dump.h"
 
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/task_group.h>
+#endif
+
 /*****************************************************
  * Debug capability
  *  - BLOB_DUMP_PATH : Specify with existing folder name
@@ -90,11 +100,12 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
         MKLDNNWeightsSharing::Ptr &w_cache) {
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    weightsCache = w_cache;
 
     Replicate(net, extMgr);
     InitGraph();
+    if (config.traceBufferSize > 0)
+        traceBuffer = std::make_shared<MKLDNNTraceBuffer>(config.traceBufferSize);
     status = Ready;
 }
 
@@ -336,6 +347,25 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
     }
 }
 
+// The order and the sizes of the blocked dimensions of the ports, e.g. "0,1,2,3,1/1,2,8,8,8" for nChw8c
+static std::vector<std::string> getLayouts(const PrimitiveDescInfo &descriptor) {
+    auto toString = [](const SizeVector &values) {
+        std::stringstream str;
+        for (size_t i = 0; i < values.size(); i++)
+            str << (i == 0 ? "" : ",") << values[i];
+        return str.str();
+    };
+    std::vector<std::string> layouts;
+    auto config = descriptor.getConfig();
+    for (auto &confs : {config.inConfs, config.outConfs}) {
+        for (auto &data : confs) {
+            const auto &blocking = data.desc.getBlockingDesc();
+            layouts.push_back(toString(blocking.getOrder()) + "/" + toString(blocking.getBlockDims()));
+        }
+    }
+    return layouts;
+}
+
 void MKLDNNGraph::InitGraph() {
     MKLDNNGraphOptimizer optimizer;
 
@@ -349,6 +379,16 @@ void MKLDNNGraph::InitGraph() {
     for (auto &node : graphNodes) {
         node->initOptimalPrimitiveDescriptor();
     }
+    // the restored descriptors resolve to the exported layouts unless the graph differs from the exported one
+    for (auto &node : graphNodes) {
+        if (node->getSelectedPrimitiveDescriptor() == nullptr)
+            continue;
+        auto layouts = getLayouts(*node->getSelectedPrimitiveDescriptor());
+        auto nodeState = GetRestoredState(node);
+        if (nodeState != nullptr && nodeState->layouts != layouts)
+            THROW_IE_EXCEPTION << "Layouts of node " << node->getName() << " differ from the exported network.";
+        selectedLayouts[node->getName()] = std::move(layouts);
+    }
     InitEdges();
 
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
@@ -412,6 +452,8 @@ void MKLDNNGraph::InitGraph() {
             continue;
         graphNode->execute(stream);
     }
+
+    InitExecutionDAG();
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -436,8 +478,51 @@ void MKLDNNGraph::InitDescriptors() {
     }
 
     for (auto &node : graphNodes) {
-        node->selectOptimalPrimitiveDescriptor();
+        auto nodeState = GetRestoredState(node);
+        if (nodeState != nullptr) {
+            node->selectPrimitiveDescriptorByIndex(nodeState->primitiveDescriptor);
+            node->restoredWeights = nodeState->weights;
+        } else {
+            node->selectOptimalPrimitiveDescriptor();
+        }
+    }
+}
+
+const MKLDNNGraphState::NodeState* MKLDNNGraph::GetRestoredState(const MKLDNNNodePtr &node) const {
+    if (restoredState == nullptr)
+        return nullptr;
+    auto itNode = restoredState->nodes.find(node->getName());
+    if (itNode == restoredState->nodes.end())
+        return nullptr;
+
+    // the supported descriptors depend on the instruction set of the CPU, so the index is valid for the same ones only
+    const auto &nodeState = itNode->second;
+    const auto &supported = node->getSupportedPrimitiveDescriptors();
+    if (nodeState.primitiveDescriptor < 0 || supported.size() != nodeState.implementationTypes.size())
+        return nullptr;
+    for (size_t i = 0; i < supported.size(); i++) {
+        if (supported[i].getImplementationType() != nodeState.implementationTypes[i])
+            return nullptr;
+    }
+    return &nodeState;
+}
+
+MKLDNNGraphState::Ptr MKLDNNGraph::GetState() const {
+    auto state = std::make_shared<MKLDNNGraphState>();
+    for (auto &node : graphNodes) {
+        // reorders are inserted again for the restored descriptors
+        auto itLayouts = selectedLayouts.find(node->getName());
+        if (node->getType() == Reorder || itLayouts == selectedLayouts.end())
+            continue;
+
+        auto &nodeState = state->nodes[node->getName()];
+        nodeState.primitiveDescriptor = node->selectedPrimitiveDescriptorIndex;
+        for (auto &descriptor : node->getSupportedPrimitiveDescriptors())
+            nodeState.implementationTypes.push_back(descriptor.getImplementationType());
+        nodeState.layouts = itLayouts->second;
+        nodeState.weights = node->preparedWeights;
     }
+    return state;
 }
 
 void MKLDNNGraph::InitEdges() {
@@ -526,72 +611,54 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
 }
 
 void MKLDNNGraph::AllocateWithReuse() {
-    std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
+    // detect edge clusters which are view on one. Edges sharing the memory are joined with
+    // a disjoint set union, so the clustering is nearly linear in the number of edges.
+    std::unordered_map<MKLDNNEdge*, size_t> edge_ids;
+    std::vector<MKLDNNEdgePtr> edges;
+    auto edge_id = [&](const MKLDNNEdgePtr &edge) {
+        auto it = edge_ids.emplace(edge.get(), edges.size());
+        if (it.second)
+            edges.push_back(edge);
+        return it.first->second;
+    };
+    for (auto &edge : graphEdges)
+        edge_id(edge);
+
+    std::vector<size_t> parents(edges.size());
+    std::iota(parents.begin(), parents.end(), 0);
+    auto find_root = [&](size_t id) {
+        while (parents[id] != id) {
+            parents[id] = parents[parents[id]];
+            id = parents[id];
+        }
+        return id;
+    };
 
-    // detect edge clusters which are view on one.
     for (auto &edge : graphEdges) {
         MKLDNNEdgePtr par = (edge->getStatus() == MKLDNNEdge::Status::NotAllocated)
                             ? edge->getSharedEdge()
                             : nullptr;
         if (par) {
-            bool found = false;
-            for (auto &claster : edge_clasters) {
-                for (auto &element : claster) {
-                    if (element == par) {
-                        if (std::find(claster.begin(), claster.end(), edge) == claster.end())
-                            claster.push_back(edge);
-                        found = true;
-                        break;
-                    }
-                }
-            }
-            if (!found)
-                edge_clasters.push_back({par, edge});
-        } else {
-            bool found = false;
-            for (auto &claster : edge_clasters) {
-                for (auto &element : claster) {
-                    if (element == edge) {
-                        found = true;
-                        break;
-                    }
-                }
-            }
-            if (!found)
-                edge_clasters.push_back({edge});
+            size_t par_id = edge_id(par);
+            if (par_id == parents.size())
+                parents.push_back(par_id);
+            size_t a = find_root(edge_ids[edge.get()]), b = find_root(par_id);
+            // the smaller root stays, so the clusters keep the order of their first edge
+            if (a != b)
+                parents[std::max(a, b)] = std::min(a, b);
         }
     }
 
-    //======= WA. getSharedEdge() returns not identical edges ============
-    //  Will try to merge clasters with matched edges
-    for (auto &edge : graphEdges) {
-        std::vector<decltype(&edge_clasters[0])> to_merge;
-
-        for (auto &claster : edge_clasters)
-            if (std::find(claster.begin(), claster.end(), edge) != claster.end())
-                to_merge.push_back(&claster);
-
-        if (to_merge.size() > 1) {
-            // Merge clasters
-            auto base_classter = to_merge[0];
-            for (int i = 1; i < to_merge.size(); i++) {
-                base_classter->insert(base_classter->end(),
-                                      to_merge[i]->begin(), to_merge[i]->end());
-                to_merge[i]->clear();
-            }
-
-            // remove duplicates in merged claster
-            std::sort(base_classter->begin(), base_classter->end());
-            base_classter->erase(std::unique(base_classter->begin(), base_classter->end()),
-                                 base_classter->end() );
-
-            // remove empty clasters
-            edge_clasters.erase(std::remove_if(edge_clasters.begin(), edge_clasters.end(),
-                                               [] ( std::vector<MKLDNNEdgePtr> &cls) { return cls.empty(); }),
-                                edge_clasters.end());
+    std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
+    std::vector<size_t> claster_ids(edges.size(), edges.size());
+    for (size_t i = 0; i < edges.size(); i++) {
+        size_t root = find_root(i);
+        if (claster_ids[root] == edges.size()) {
+            claster_ids[root] = edge_clasters.size();
+            edge_clasters.emplace_back();
         }
+        edge_clasters[claster_ids[root]].push_back(edges[i]);
     }
-    //======= End of WA ============
 
     const int64_t alignment = 32;  // 32 bytes
 
@@ -652,8 +719,67 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    static const std::vector<std::pair<Config::MemoryReuseStrategy, std::string>> strategies = {
+        { Config::MemoryReuseStrategy::SizeFirst, PluginConfigParams::CPU_MEMORY_REUSE_SIZE_FIRST },
+        { Config::MemoryReuseStrategy::LifetimeFirst, PluginConfigParams::CPU_MEMORY_REUSE_LIFETIME_FIRST },
+        { Config::MemoryReuseStrategy::BestFit, PluginConfigParams::CPU_MEMORY_REUSE_BEST_FIT },
+    };
+    auto solverStrategy = [](Config::MemoryReuseStrategy strategy) {
+        switch (strategy) {
+            case Config::MemoryReuseStrategy::LifetimeFirst: return MemorySolver::Strategy::LifetimeFirst;
+            case Config::MemoryReuseStrategy::BestFit: return MemorySolver::Strategy::BestFit;
+            default: return MemorySolver::Strategy::SizeFirst;
+        }
+    };
+
+    memoryReuseReport.clear();
+    std::unique_ptr<MemorySolver> bestSolver;
+    int64_t best_size = 0;
+    for (auto &strategy : strategies) {
+        if (config.memoryReuseStrategy != Config::MemoryReuseStrategy::Min && config.memoryReuseStrategy != strategy.first)
+            continue;
+
+        std::unique_ptr<MemorySolver> solver(new MemorySolver(boxes, solverStrategy(strategy.first)));
+        int64_t size = solver->solve();
+        memoryReuseReport[strategy.second] = static_cast<uint64_t>(size * alignment);
+        if (!bestSolver || size < best_size) {
+            best_size = size;
+            bestSolver = std::move(solver);
+        }
+    }
+    IE_ASSERT(bestSolver != nullptr);
+    MemorySolver &memSolver = *bestSolver;
+    memoryReuseReport["LOWER_BOUND"] = static_cast<uint64_t>(memSolver.maxDepth() * alignment);
+    size_t total_size = static_cast<size_t>(best_size) * alignment;
+
+    memoryHazards.clear();
+    if (config.parallelBranches) {
+        // Memory reuse relies on the sequential execution order. Boxes with overlapped memory regions
+        // have disjoint live times, so all users of the earlier box must complete before the later
+        // box is produced. Collect such pairs to keep this order in the parallel execution mode.
+        std::vector<int> byOffset(boxes.size());
+        std::iota(byOffset.begin(), byOffset.end(), 0);
+        std::sort(byOffset.begin(), byOffset.end(), [&](int a, int b) {
+            return memSolver.getOffset(a) < memSolver.getOffset(b);
+        });
+
+        for (size_t a = 0; a < byOffset.size(); a++) {
+            const int64_t end = memSolver.getOffset(byOffset[a]) + boxes[byOffset[a]].size;
+            for (size_t b = a + 1; b < byOffset.size() && memSolver.getOffset(byOffset[b]) < end; b++) {
+                int before = byOffset[a], after = byOffset[b];
+                if (boxes[after].start < boxes[before].start)
+                    std::swap(before, after);
+
+                for (auto &prev : edge_clasters[before]) {
+                    for (auto &next : edge_clasters[after]) {
+                        const int writer = next->getParent()->execIndex;
+                        memoryHazards.emplace_back(prev->getParent()->execIndex, writer);
+                        memoryHazards.emplace_back(prev->getChild()->execIndex, writer);
+                    }
+                }
+            }
+        }
+    }
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
@@ -736,6 +862,22 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
+InferenceEngine::Blob::Ptr MKLDNNGraph::getNormalizedInputBlob(const std::string& name) {
+    if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
+
+    auto input = inputNodes.find(name);
+    if (input == inputNodes.end()) {
+        THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' doesn't correspond to input in network";
+    }
+
+    auto blob = input->second->getChildEdgeAt(0)->getBlob();
+    const auto& desc = blob->getTensorDesc();
+    if (desc.getPrecision() != Precision::FP32 || (desc.getLayout() != NCHW && desc.getLayout() != NHWC)) {
+        return nullptr;
+    }
+    return blob;
+}
+
 void MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
@@ -781,26 +923,172 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
-void MKLDNNGraph::Infer(int batch) {
-    if (!IsReady()) {
-        THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
+void MKLDNNGraph::InitExecutionDAG() {
+    execDAG = ExecDAG();
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches)
+        return;
+
+    const size_t nodesNum = graphNodes.size();
+    for (size_t i = 0; i < nodesNum; i++) {
+        // Memory layers communicate through the state which is not expressed by edges
+        auto type = graphNodes[i]->getType();
+        if (type == MemoryInput || type == MemoryOutput)
+            return;
+        if (static_cast<size_t>(graphNodes[i]->getExecIndex()) != i)
+            return;
     }
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    execDAG.successors.resize(nodesNum);
+    execDAG.predecessorsCount.resize(nodesNum, 0);
+
+    auto addDependency = [&](int from, int to) {
+        // graphNodes are sorted topologically, so a valid dependency always points forward
+        if (from < to)
+            execDAG.successors[from].push_back(to);
+    };
+    for (auto &edge : graphEdges)
+        addDependency(edge->getParent()->getExecIndex(), edge->getChild()->getExecIndex());
+    for (auto &hazard : memoryHazards)
+        addDependency(hazard.first, hazard.second);
+
+    for (auto &successors : execDAG.successors) {
+        std::sort(successors.begin(), successors.end());
+        successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+        for (auto successor : successors)
+            execDAG.predecessorsCount[successor]++;
+    }
+
+    // Nodes with the same distance from the graph inputs are likely to be executed simultaneously,
+    // so the threads of the stream are split between them.
+    std::vector<size_t> level(nodesNum, 0);
+    for (size_t i = 0; i < nodesNum; i++) {
+        for (auto successor : execDAG.successors[i])
+            level[successor] = std::max(level[successor], level[i] + 1);
+    }
+    std::vector<int> levelWidth(nodesNum, 0);
+    for (size_t i = 0; i < nodesNum; i++) {
+        if (!graphNodes[i]->isConstant())
+            levelWidth[level[i]]++;
+    }
+    if (*std::max_element(levelWidth.begin(), levelWidth.end()) < 2)
+        return;  // there is nothing to execute in parallel
+
+    // Nodes of the same level get different arenas, so they do not compete for the arena slots
+    const int threads = parallel_get_max_threads();
+    std::map<std::pair<int, int>, std::shared_ptr<tbb::task_arena>> arenas;
+    std::vector<int> levelSlot(nodesNum, 0);
+    execDAG.arenas.resize(nodesNum);
+    for (size_t i = 0; i < nodesNum; i++) {
+        const int budget = std::max(1, threads / std::max(1, levelWidth[level[i]]));
+        if (budget >= threads || graphNodes[i]->isConstant())
+            continue;
+        auto &arena = arenas[{budget, levelSlot[level[i]]++}];
+        if (!arena) {
+            arena = std::make_shared<tbb::task_arena>(budget);
+            arena->initialize();
+        }
+        execDAG.arenas[i] = arena;
+    }
+
+    for (size_t i = 0; i < nodesNum; i++) {
+        if (execDAG.predecessorsCount[i] == 0)
+            execDAG.roots.push_back(i);
+    }
+    execDAG.enabled = true;
+#endif
+}
+
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch) {
+    {
+        PERF(node);
 
         if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+            node->setDynamicBatchLim(batch);
+
+        ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+        if (!node->isConstant()) {
+            IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+            node->execute(stream);
+        }
+
+        ENABLE_DUMP(do_after(DUMP_DIR, node));
+    }
+
+    if (traceBuffer && !node->isConstant()) {
+        auto &perf = node->PerfCounter();
+        traceBuffer->Push({traceInferId, node->getExecIndex(), perf.lastStart(), perf.lastFinish(),
+                           std::this_thread::get_id(), batch});
+    }
+}
+
+void MKLDNNGraph::InferParallel(int batch) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    const size_t nodesNum = graphNodes.size();
+    std::unique_ptr<std::atomic<size_t>[]> pending(new std::atomic<size_t>[nodesNum]);
+    for (size_t i = 0; i < nodesNum; i++)
+        pending[i] = execDAG.predecessorsCount[i];
+
+    tbb::task_group taskGroup;
+    std::function<void(size_t)> executeFrom = [&](size_t idx) {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        while (true) {
+            auto &arena = execDAG.arenas[idx];
+            if (arena) {
+                arena->execute([&] { ExecuteNode(graphNodes[idx], stream, batch); });
+            } else {
+                ExecuteNode(graphNodes[idx], stream, batch);
+            }
+
+            // The first ready successor continues in the current task, the others are spawned
+            bool hasNext = false;
+            size_t next = 0;
+            for (auto successor : execDAG.successors[idx]) {
+                if (--pending[successor] != 0)
+                    continue;
+                if (!hasNext) {
+                    next = successor;
+                    hasNext = true;
+                } else {
+                    taskGroup.run([&executeFrom, successor] { executeFrom(successor); });
+                }
+            }
+            if (!hasNext)
+                break;
+            idx = next;
+        }
+    };
+
+    for (auto root : execDAG.roots)
+        taskGroup.run([&executeFrom, root] { executeFrom(root); });
+    taskGroup.wait();
+#else
+    THROW_IE_EXCEPTION << "Parallel execution of graph branches is supported only with TBB threading";
+#endif
+}
+
+void MKLDNNGraph::Infer(int batch) {
+    if (!IsReady()) {
+        THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
+    }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+    lastInferStart = std::chrono::high_resolution_clock::now();
+    if (traceBuffer)
+        traceInferId = traceBuffer->NextInferId();
 
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+    if (execDAG.enabled) {
+        InferParallel(batch);
+    } else {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (int i = 0; i < graphNodes.size(); i++) {
+            ExecuteNode(graphNodes[i], stream, batch);
         }
+    }
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+    if (traceBuffer) {
+        traceBuffer->Push({traceInferId, MKLDNNTraceBuffer::inferRecord, lastInferStart,
+                           std::chrono::high_resolution_clock::now(), std::this_thread::get_id(), batch});
     }
 
     if (infer_count != -1) infer_count++;
@@ -922,6 +1210,136 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
 }
 
+void MKLDNNGraph::GetTraceEvents(std::vector<MKLDNNTraceEvent> &events, const std::string &streamName) const {
+    if (!traceBuffer)
+        return;
+
+    const size_t nodesNum = graphNodes.size();
+    std::unordered_map<int, size_t> execIndexToNode;
+    for (size_t i = 0; i < nodesNum; i++)
+        execIndexToNode[graphNodes[i]->getExecIndex()] = i;
+
+    // Nodes which have to be finished before the node is started: data and memory reuse dependencies
+    // in the parallel mode and the previous executed node in the sequential one
+    std::vector<std::vector<size_t>> predecessors(nodesNum);
+    if (execDAG.enabled) {
+        for (size_t i = 0; i < nodesNum; i++) {
+            for (auto successor : execDAG.successors[i])
+                predecessors[successor].push_back(i);
+        }
+    } else {
+        for (size_t i = 0, prev = nodesNum; i < nodesNum; i++) {
+            if (graphNodes[i]->isConstant())
+                continue;
+            if (prev != nodesNum)
+                predecessors[i].push_back(prev);
+            prev = i;
+        }
+    }
+
+    // Sizes of the node inputs and outputs, the memory shared by several edges is counted once
+    std::vector<size_t> bytesTouched(nodesNum, 0);
+    for (size_t i = 0; i < nodesNum; i++) {
+        std::set<void*> counted;
+        auto count = [&](const std::vector<MKLDNNEdgeWeakPtr> &edges) {
+            for (auto &&weakEdge : edges) {
+                auto edge = weakEdge.lock();
+                if (!edge || !edge->getMemoryPtr() || !edge->getMemoryPtr()->GetData())
+                    continue;
+                if (counted.insert(edge->getMemoryPtr()->GetData()).second)
+                    bytesTouched[i] += edge->getMemoryPtr()->GetSize();
+            }
+        };
+        count(graphNodes[i]->getParentEdges());
+        count(graphNodes[i]->getChildEdges());
+    }
+
+    auto toUs = [](std::chrono::high_resolution_clock::duration d) {
+        return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+    };
+
+    auto records = traceBuffer->Snapshot();
+    std::map<uint64_t, std::vector<const MKLDNNTraceBuffer::Record*>> inferences;
+    for (auto &&record : records)
+        inferences[record.inferId].push_back(&record);
+
+    for (auto &&inference : inferences) {
+        // The oldest inference may be partially overwritten, absent nodes are skipped
+        const MKLDNNTraceBuffer::Record* inferRecord = nullptr;
+        std::vector<const MKLDNNTraceBuffer::Record*> nodeRecords(nodesNum, nullptr);
+        for (auto record : inference.second) {
+            if (record->execIndex == MKLDNNTraceBuffer::inferRecord) {
+                inferRecord = record;
+                continue;
+            }
+            auto node = execIndexToNode.find(record->execIndex);
+            if (node != execIndexToNode.end())
+                nodeRecords[node->second] = record;
+        }
+
+        // The critical path goes back from the last finished node through the latest finished predecessors
+        std::vector<bool> critical(nodesNum, false);
+        size_t last = nodesNum;
+        for (size_t i = 0; i < nodesNum; i++) {
+            if (nodeRecords[i] && (last == nodesNum || nodeRecords[i]->finish > nodeRecords[last]->finish))
+                last = i;
+        }
+        std::vector<size_t> latestPredecessor(nodesNum, nodesNum);
+        for (size_t i = 0; i < nodesNum; i++) {
+            for (auto predecessor : predecessors[i]) {
+                auto &latest = latestPredecessor[i];
+                if (nodeRecords[predecessor] &&
+                    (latest == nodesNum || nodeRecords[predecessor]->finish > nodeRecords[latest]->finish))
+                    latest = predecessor;
+            }
+        }
+        for (size_t i = last; i != nodesNum; i = latestPredecessor[i])
+            critical[i] = true;
+
+        for (size_t i = 0; i < nodesNum; i++) {
+            auto record = nodeRecords[i];
+            if (!record)
+                continue;
+            auto &node = graphNodes[i];
+            auto readyTime = latestPredecessor[i] != nodesNum ? nodeRecords[latestPredecessor[i]]->finish
+                                                              : (inferRecord ? inferRecord->start : record->start);
+            MKLDNNTraceEvent event;
+            event.name = node->getName();
+            event.category = critical[i] ? "node,critical_path" : "node";
+            event.start = record->start;
+            event.finish = record->finish;
+            event.threadId = record->threadId;
+            event.args = {
+                {"stream", streamName},
+                {"infer", std::to_string(record->inferId)},
+                {"exec_index", std::to_string(record->execIndex)},
+                {"type", node->getTypeStr()},
+                {"impl", node->getPrimitiveDescriptorType()},
+                {"bytes", std::to_string(bytesTouched[i])},
+                {"wait_us", toUs(std::max(record->start - readyTime, std::chrono::high_resolution_clock::duration::zero()))},
+                {"critical_path", critical[i] ? "1" : "0"},
+            };
+            if (record->batch > 0)
+                event.args["batch"] = std::to_string(record->batch);
+            events.push_back(std::move(event));
+        }
+
+        if (inferRecord) {
+            MKLDNNTraceEvent event;
+            event.name = "Infer";
+            event.category = "infer";
+            event.start = inferRecord->start;
+            event.finish = inferRecord->finish;
+            event.threadId = inferRecord->threadId;
+            event.args = {
+                {"stream", streamName},
+                {"infer", std::to_string(inferRecord->inferId)},
+            };
+            events.push_back(std::move(event));
+        }
+    }
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -11,14 +11,37 @@
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_trace.h"
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
+#include <chrono>
 
 namespace MKLDNNPlugin {
 
+/**
+ * The primitive descriptors and the reordered weights selected for the nodes of a compiled graph.
+ * A graph created with the state of an exported one takes them instead of selecting and reordering again.
+ */
+struct MKLDNNGraphState {
+    typedef std::shared_ptr<MKLDNNGraphState> Ptr;
+
+    struct NodeState {
+        int primitiveDescriptor = -1;
+        // the implementations of all supported descriptors, the index is restored only if they are the same
+        std::vector<impl_desc_type> implementationTypes;
+        // the layouts of the inputs and the outputs of the selected descriptor after they are resolved
+        std::vector<std::string> layouts;
+        // the reordered internal blobs, nullptr for the ones which are not exported
+        std::vector<MKLDNNMemoryPtr> weights;
+    };
+
+    std::map<std::string, NodeState> nodes;
+};
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -43,6 +66,14 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty();
 
+    // Makes CreateGraph take the primitive descriptors and the weights of the nodes from the exported graph
+    void setRestoredState(const MKLDNNGraphState::Ptr &state) {
+        restoredState = state;
+    }
+
+    // Collects the primitive descriptors and the weights selected for the nodes, see MKLDNNGraphState
+    MKLDNNGraphState::Ptr GetState() const;
+
     void getInputBlobs(InferenceEngine::BlobMap &in_map);
     void getOutputBlobs(InferenceEngine::BlobMap &out_map);
 
@@ -56,6 +87,11 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @brief Returns an FP32 blob sharing memory with the graph's input, so input pre-processing can write
+     * normalized data directly into it, or nullptr if the input memory is not FP32 NCHW/NHWC
+     */
+    InferenceEngine::Blob::Ptr getNormalizedInputBlob(const std::string& name);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(int batch = -1);
@@ -78,6 +114,26 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    // Start time of the last Infer() call. Used as a reference point for per-node timestamps.
+    std::chrono::high_resolution_clock::time_point GetLastInferStart() const {
+        return lastInferStart;
+    }
+
+    /**
+     * Appends per-node execution events of the inferences kept in the trace buffer.
+     * Each event has the time the node waited for its predecessors after they had been finished
+     * and is marked if it belongs to the critical path of the inference.
+     */
+    void GetTraceEvents(std::vector<MKLDNNTraceEvent> &events, const std::string &streamName) const;
+
+    /**
+     * Returns the size in bytes of the memory shared by the intermediate blobs for every tried placement
+     * strategy and the "LOWER_BOUND" size, the maximal total size of the blobs alive at the same time.
+     */
+    const std::map<std::string, uint64_t> &getMemoryReuseReport() const {
+        return memoryReuseReport;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -104,6 +160,10 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        execDAG = ExecDAG();
+        memoryHazards.clear();
+        traceBuffer.reset();
+        selectedLayouts.clear();
     }
     Status status;
     Config config;
@@ -126,15 +186,54 @@ protected:
 
     mkldnn::engine eng;
 
+    std::chrono::high_resolution_clock::time_point lastInferStart = {};
+
+    // Keeps node executions if tracing is enabled by the config, nullptr otherwise
+    MKLDNNTraceBuffer::Ptr traceBuffer;
+    uint64_t traceInferId = 0;
+
+    /**
+     * Dependencies between nodes used for the parallel execution of independent branches.
+     * Indexes correspond to the position of the node in graphNodes (execIndex).
+     */
+    struct ExecDAG {
+        bool enabled = false;
+        std::vector<std::vector<size_t>> successors;
+        std::vector<size_t> predecessorsCount;
+        std::vector<size_t> roots;
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        // Arena limiting the number of threads available for a node, nullptr means no limitation
+        std::vector<std::shared_ptr<tbb::task_arena>> arenas;
+#endif
+    } execDAG;
+
+    // Pairs of execIndex (writer before, reader after) of nodes whose outputs share the same memory
+    // due to memory reuse. Sequential order between them has to be kept in parallel execution mode.
+    std::vector<std::pair<int, int>> memoryHazards;
+
+    // Sizes of the shared memory computed by the placement strategies, see getMemoryReuseReport()
+    std::map<std::string, uint64_t> memoryReuseReport;
+
+    // The state of the exported graph, nullptr if the graph is not imported
+    MKLDNNGraphState::Ptr restoredState;
+    // The layouts of the selected descriptors before the graph optimizations which follow their initialization
+    std::map<std::string, std::vector<std::string>> selectedLayouts;
+
     void Replicate(const InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const InferenceEngine::TensorIterator::Body &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    // Returns the exported state of the node if its descriptor can be restored, nullptr otherwise
+    const MKLDNNGraphState::NodeState* GetRestoredState(const MKLDNNNodePtr &node) const;
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void InitExecutionDAG();
+
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch);
+    void InferParallel(int batch);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
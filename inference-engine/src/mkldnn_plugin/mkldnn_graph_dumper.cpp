@@ -12,17 +12,20 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <chrono>
 
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
-static void copy_node_metadata(const MKLDNNNodePtr &, CNNLayer::Ptr &);
+using time_point = std::chrono::high_resolution_clock::time_point;
+
+static void copy_node_metadata(const MKLDNNNodePtr &, CNNLayer::Ptr &, time_point);
 static void drawer_callback(const InferenceEngine::CNNLayerPtr, ordered_properties &, ordered_properties &);
 
-CNNLayer::Ptr convert_node(const MKLDNNNodePtr &node) {
+CNNLayer::Ptr convert_node(const MKLDNNNodePtr &node, time_point inferStart) {
     CNNLayer::Ptr layer(new CNNLayer({"name", "type", Precision::FP32}));
-    copy_node_metadata(node, layer);
+    copy_node_metadata(node, layer, inferStart);
 
     auto &cfg = node->getSelectedPrimitiveDescriptor()->getConfig();
     layer->insData.resize(cfg.inConfs.size());
@@ -40,7 +43,7 @@ std::shared_ptr<ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph) {
 
     // Copy all nodes to network
     for (auto &node : graph.graphNodes) {
-        auto layer = convert_node(node);
+        auto layer = convert_node(node, graph.GetLastInferStart());
         node2layer[node] = layer;
         net->addLayer(layer);
     }
@@ -99,7 +102,7 @@ void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out) {
 static const char BLUE[]  = "#D8D9F1";
 static const char GREEN[] = "#D9EAD3";
 
-void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
+void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer, time_point inferStart) {
     if (node->getType() == Input && node->isConstant()) {
         // We need to separate Input and Const layers
         layer->type = "Const";
@@ -173,6 +176,16 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     }
 
     layer->params[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
+
+    // Timestamps of the last execution, allow to check which primitives were executed simultaneously
+    auto &perf = node->PerfCounter();
+    if (perf.avg() != 0 && perf.lastStart() >= inferStart) {
+        auto toMcs = [&](time_point t) {
+            return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(t - inferStart).count());
+        };
+        layer->params[ExecGraphInfoSerialization::EXEC_START_TIME] = toMcs(perf.lastStart());
+        layer->params[ExecGraphInfoSerialization::EXEC_END_TIME] = toMcs(perf.lastFinish());
+    }
 }
 
 void drawer_callback(const InferenceEngine::CNNLayerPtr layer,
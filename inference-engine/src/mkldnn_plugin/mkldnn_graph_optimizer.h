@@ -44,6 +44,7 @@ private:
     void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
     void FuseResampleAndSimpleOperation(MKLDNNGraph &graph);
     void FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph);
+    void FuseReduceAndSimpleOperation(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
 
     void RemoveIOScaleShifts(MKLDNNGraph& graph);
@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <set>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -81,10 +82,21 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     IE_PROFILING_AUTO_SCOPE_TASK(profilingTask)
     graph = execNetwork->_graphs.local().get();
     {
-        execDataPreprocessing(_inputs);
-
         changeDefaultPtr();
 
+        // inputs requiring mean subtraction or conversion to FP32 are pre-processed and normalized
+        // in a single pass writing directly into the graph's memory, other inputs are pushed as is
+        std::set<std::string> normalizedInputs;
+        InferenceEngine::BlobMap notNormalizedInputs;
+        for (auto& input : _inputs) {
+            if (pushNormalizedInput(input.first)) {
+                normalizedInputs.insert(input.first);
+            } else {
+                notNormalizedInputs.insert(input);
+            }
+        }
+        execDataPreprocessing(notNormalizedInputs);
+
         // need to retain converted blobs until infer finish
         std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
         for (auto input : _inputs) {
@@ -94,6 +106,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                                     << input.first;
             }
 
+            if (normalizedInputs.count(input.first) != 0) {
+                continue;
+            }
+
             InferenceEngine::Blob::Ptr iconv;
             InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->getTensorDesc().getPrecision()) {
@@ -167,6 +183,52 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     graph->PullOutputData(_outputs);
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::pushNormalizedInput(const std::string& inputName) {
+    auto networkInput = _networkInputs.find(inputName);
+    if (networkInput == _networkInputs.end() || !networkInput->second) {
+        return false;
+    }
+
+    // U16 is unsupported by mkldnn, so it is always converted to FP32 as well as inputs with a mean
+    const auto& input = _inputs[inputName];
+    if (!graph->hasMeanImageFor(inputName) && input->getTensorDesc().getPrecision() != InferenceEngine::Precision::U16) {
+        return false;
+    }
+
+    auto graphInput = graph->getNormalizedInputBlob(inputName);
+    if (!graphInput) {
+        return false;
+    }
+
+    InferenceEngine::PreProcessInfo info = networkInput->second->getPreProcess();
+    const InferenceEngine::PreProcessDataPtr* preProcData = nullptr;
+    auto roiPreProcData = _preProcData.find(inputName);
+    if (roiPreProcData != _preProcData.end()) {
+        preProcData = &roiPreProcData->second;
+    } else {
+        auto it = normalizeData.find(inputName);
+        if (it == normalizeData.end()) {
+            InferenceEngine::PreProcessDataPtr data;
+            try {
+                data = InferenceEngine::CreatePreprocDataHelper();
+            } catch (const InferenceEngine::details::InferenceEngineException&) {
+                // pre-processing library is not available, the input is converted by the plugin
+            }
+            it = normalizeData.emplace(inputName, data).first;
+        }
+        if (!it->second) {
+            return false;
+        }
+        preProcData = &it->second;
+        (*preProcData)->setRoiBlob(input);
+        // the input blob is not a ROI blob set for pre-processing, so it is only normalized
+        info.setResizeAlgorithm(InferenceEngine::NO_RESIZE);
+        info.setColorFormat(InferenceEngine::ColorFormat::RAW);
+    }
+
+    return (*preProcData)->executeNormalized(graphInput, info, false, m_curBatch);
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     if (!graph || !graph->IsReady())
@@ -45,11 +45,13 @@ public:
 
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
+    bool pushNormalizedInput(const std::string& inputName);
 
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
+    std::map<std::string, InferenceEngine::PreProcessDataPtr> normalizeData;
     InferenceEngine::ProfilingTask      profilingTask;
 };
 }  // namespace MKLDNNPlugin
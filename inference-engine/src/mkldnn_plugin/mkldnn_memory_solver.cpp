@@ -7,12 +7,13 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, Strategy strategy) : _boxes(boxes), _strategy(strategy) {
     int max_ts = 0;
     // TODO: add validation of data correctness:
     // 1. Box.start >= 0 and Box.finish >= -1
@@ -45,44 +46,59 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
-    }
-}
-
 int64_t MemorySolver::solve() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
-    // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
-        { return l.size > r.size; });
+    if (_strategy == Strategy::LifetimeFirst) {
+        // Sort by live time. First is the longest, the biggest one goes first among equal ones
+        std::stable_sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
+            return l.finish - l.start > r.finish - r.start ||
+                   (l.finish - l.start == r.finish - r.start && l.size > r.size);
+        });
+    } else {
+        // Sort be box size. First is biggest
+        std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
+            { return l.size > r.size; });
+    }
 
     int64_t _min_required = 0;
 
+    // [offset, offset + size) of the already stored boxes which live time intersects with the current one
+    std::vector<std::pair<int64_t, int64_t>> busy;
+    std::vector<const Box*> last_seen(_boxes.size(), nullptr);
+
     for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int64_t id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
+        // collect the already stored boxes for all covered time slots, each one only once
+        busy.clear();
+        for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
+            for (auto *box_in_slot : time_slots[i_slot]) {
+                auto &seen = last_seen[box_in_slot - _boxes.data()];
+                if (seen != &box) {
+                    seen = &box;
+                    busy.emplace_back(box_in_slot->id, box_in_slot->id + box_in_slot->size);
                 }
             }
-        } while (popped_up);
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // Walk through the gaps between the busy intervals from the bottom. The first fitting gap is
+        // the position where the box would be lifted from the bottom until it has no intersections.
+        int64_t offset = -1, best_gap = -1, top = 0;
+        for (const auto &interval : busy) {
+            const int64_t gap = interval.first - top;
+            if (gap >= box.size && (best_gap == -1 || gap < best_gap)) {
+                offset = top;
+                best_gap = gap;
+                if (_strategy != Strategy::BestFit || gap == box.size) break;
+            }
+            top = std::max(top, interval.second);
+        }
+        if (offset == -1) offset = top;
+
+        int64_t id = box.id;
+        box.id = offset;  // id will be used as a offset storage
 
         // add current box to covered time slot
         for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
@@ -10,6 +10,7 @@
 
 #include "ie_api.h"
 
+#include <cstdint>
 #include <vector>
 #include <map>
 
@@ -40,6 +41,9 @@ namespace MKLDNNPlugin {
  *
  *  NOTE!
  *  Exec order is predefined.
+ *
+ *  The problem is NP-hard, so the solver is a greedy heuristic selected by the Strategy. maxDepth() is
+ *  a lower bound of the solution of any strategy.
  */
 
 class MemorySolver {
@@ -63,7 +67,17 @@ public:
         int64_t id;
     };
 
-    explicit MemorySolver(const std::vector<Box>& boxes);
+    /** @brief The order of box placement and the choice of the position for a box */
+    enum class Strategy {
+        /** Biggest boxes first, each box is put to the lowest free position */
+        SizeFirst,
+        /** Boxes with the longest live time first, each box is put to the lowest free position */
+        LifetimeFirst,
+        /** Biggest boxes first, each box is put to the smallest free gap it fits in */
+        BestFit
+    };
+
+    explicit MemorySolver(const std::vector<Box>& boxes, Strategy strategy = Strategy::SizeFirst);
 
     /**
      * @brief Solve memory location with maximal reuse.
@@ -81,6 +95,7 @@ public:
 
 private:
     std::vector<Box> _boxes;
+    Strategy _strategy;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
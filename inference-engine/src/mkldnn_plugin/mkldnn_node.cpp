@@ -42,6 +42,7 @@
 #include <nodes/mkldnn_mvn_node.h>
 #include <nodes/mkldnn_resample_node.h>
 #include <nodes/mkldnn_normalize_node.h>
+#include <nodes/mkldnn_reduce_node.h>
 #include <nodes/mkldnn_tensoriterator_node.h>
 #include <mkldnn_types.h>
 #include "mkldnn_extension_utils.h"
@@ -115,6 +116,18 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "MVN", MVN},
         { "Resample", Resample},
         { "Normalize", Normalize},
+        { "ReduceAnd", Reduce},
+        { "ReduceL1", Reduce},
+        { "ReduceL2", Reduce},
+        { "ReduceLogSum", Reduce},
+        { "ReduceLogSumExp", Reduce},
+        { "ReduceMax", Reduce},
+        { "ReduceMean", Reduce},
+        { "ReduceMin", Reduce},
+        { "ReduceOr", Reduce},
+        { "ReduceProd", Reduce},
+        { "ReduceSum", Reduce},
+        { "ReduceSumSquare", Reduce},
 };
 
 Type TypeFromName(const std::string type) {
@@ -766,21 +779,19 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
         };
 
         MKLDNNMemoryPtr ptr;
-        if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
-
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
-
-            ptr = weightCache->findOrCreate(string_hash, create);
+        if (i < restoredWeights.size() && restoredWeights[i] != nullptr &&
+                MKLDNNMemoryDesc(restoredWeights[i]->GetDescriptor()) == intDescs[i]) {
+            ptr = restoredWeights[i];
+        } else if (weightCache != nullptr) {
+            const auto key = MKLDNNWeightsSharing::GetKey(internalBlob, intDescs[i]);
+            ptr = weightCache->findOrCreate(key, create);
         } else {
             ptr = create();
         }
 
         internalBlobMemory.push_back(ptr);
     }
+    preparedWeights = internalBlobMemory;
 }
 
 bool MKLDNNNode::isInplace() const {
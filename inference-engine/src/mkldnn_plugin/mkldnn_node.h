@@ -75,7 +75,8 @@ enum Type {
     Convert,
     MVN,
     Resample,
-    Normalize
+    Normalize,
+    Reduce
 };
 
 Type TypeFromName(const std::string type);
@@ -158,6 +159,8 @@ static std::string NameFromType(Type type) {
             return "Resample";
         case Normalize:
             return "Normalize";
+        case Reduce:
+            return "Reduce";
         default:
             return "Unknown";
     }
@@ -560,6 +563,11 @@ private:
     }
 
     void prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::primitive_desc_iterator& itpd);
+
+    // The internal blobs reordered by prepareMemory, they are exported with the network
+    std::vector<MKLDNNMemoryPtr> preparedWeights;
+    // The reordered internal blobs of the exported network, prepareMemory takes them instead of the reorder
+    std::vector<MKLDNNMemoryPtr> restoredWeights;
     enum LOOK { LOOK_UP = 1, LOOK_DOWN = 2 };
     ConstantType checkConstant(LOOK look, std::vector<MKLDNNNodePtr>& checkNodes);
 };
@@ -6,6 +6,8 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_batching_exec_network.h"
+#include "mkldnn_shapes_cache_exec_network.h"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
@@ -39,6 +41,37 @@
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+size_t getBatchOfRequestsBatching(const InputsDataMap& inputs, const OutputsDataMap& outputs) {
+    size_t batch = 0;
+    auto checkData = [&batch] (const std::string& name, const TensorDesc& desc) {
+        switch (desc.getLayout()) {
+            case Layout::NC: case Layout::NCHW: case Layout::NHWC: case Layout::NCDHW: case Layout::NDHWC: break;
+            default:
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE
+                                   << " requires the batch as the first dimension, but " << name
+                                   << " has " << desc.getLayout() << " layout";
+        }
+        auto dataBatch = desc.getDims()[0];
+        if (batch != 0 && batch != dataBatch) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE
+                               << " requires the same batch for all inputs and outputs, but " << name
+                               << " has batch " << dataBatch << " while " << batch << " is expected";
+        }
+        batch = dataBatch;
+    };
+    for (auto&& input : inputs) {
+        checkData(input.first, input.second->getTensorDesc());
+    }
+    for (auto&& output : outputs) {
+        checkData(output.first, output.second->getTensorDesc());
+    }
+    return batch;
+}
+
+}  // namespace
+
 Engine::Engine() {
     _pluginName = "CPU";
     extensionManager->AddExtension(std::make_shared<Extensions::Cpu::MKLDNNExtensions>());
@@ -47,6 +80,7 @@ Engine::Engine() {
 Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUStreamsExecutor");
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
+    ExecutorManager::getInstance()->clear("CPUShapesCacheCompiler");
 }
 
 InferenceEngine::ExecutableNetworkInternal::Ptr
@@ -74,13 +108,90 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
     Config conf = engConfig;
     conf.readProperties(config);
 
+    return CreateExecNetwork(network, conf, false);
+}
+
+InferenceEngine::ExecutableNetworkInternal::Ptr
+Engine::CreateExecNetwork(const InferenceEngine::ICNNNetwork &network, Config conf, bool isTransformed,
+                          const MKLDNNGraphState::Ptr &graphState) {
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    // the shapes cache compiles the network for the shapes of infer request inputs on demand
+    if (conf.shapesCacheSize > 0) {
+        if (conf.requestsBatchSize > 1) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE
+                               << " is not supported together with " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE;
+        }
+        auto plugin = shared_from_this();
+        // the networks are compiled for other shapes than the exported one, so the graph state is not used
+        auto compile = [this, plugin, conf, isTransformed] (const ICNNNetwork& reshapedNetwork) {
+            auto execNetwork = CompileNetwork(reshapedNetwork, conf, isTransformed);
+            InputsDataMap inputs, reshapedInputs;
+            OutputsDataMap outputs, reshapedOutputs;
+            reshapedNetwork.getInputsInfo(reshapedInputs);
+            reshapedNetwork.getOutputsInfo(reshapedOutputs);
+            copyInputOutputInfo(reshapedInputs, reshapedOutputs, inputs, outputs);
+            execNetwork->setNetworkInputs(inputs);
+            execNetwork->setNetworkOutputs(outputs);
+            execNetwork->SetPointerToPluginInternal(plugin);
+            return execNetwork;
+        };
+        return std::make_shared<MKLDNNShapesCacheExecNetwork>(network, compile, static_cast<size_t>(conf.shapesCacheSize),
+                                                              conf.shapesCachePadding, conf.collectPerfCounters,
+                                                              ExecutorManager::getInstance()->getExecutor("CPUShapesCacheCompiler"));
+    }
+
+    return CompileNetwork(network, conf, isTransformed, graphState);
+}
+
+InferenceEngine::ExecutableNetworkInternal::Ptr
+Engine::CompileNetwork(const InferenceEngine::ICNNNetwork &network, Config conf, bool isTransformed,
+                       const MKLDNNGraphState::Ptr &graphState) {
     std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
 
-    if (clonedNetwork->getFunction()) {
+    // requests batching executes up to requestsBatchSize requests at once using the dynamic batch
+    // of the network which batch is multiplied by requestsBatchSize
+    size_t networkBatch = 0;
+    InputsDataMap batchedInputs;
+    OutputsDataMap batchedOutputs;
+    if (conf.requestsBatchSize > 1) {
+        InputsDataMap networkInputs;
+        OutputsDataMap networkOutputs;
+        network.getInputsInfo(networkInputs);
+        network.getOutputsInfo(networkOutputs);
+        networkBatch = getBatchOfRequestsBatching(networkInputs, networkOutputs);
+        auto batchedSize = networkBatch * conf.requestsBatchSize;
+
+        ICNNNetwork::InputShapes shapes;
+        for (auto&& input : networkInputs) {
+            auto dims = input.second->getTensorDesc().getDims();
+            dims[0] = batchedSize;
+            shapes[input.first] = dims;
+        }
+        ResponseDesc resp;
+        if (StatusCode::OK != clonedNetwork->reshape(shapes, &resp)) {
+            THROW_IE_EXCEPTION << "Failed to reshape the network to the batch " << batchedSize
+                               << " required by " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE << ": " << resp.msg;
+        }
+
+        InputsDataMap reshapedInputs;
+        OutputsDataMap reshapedOutputs;
+        clonedNetwork->getInputsInfo(reshapedInputs);
+        clonedNetwork->getOutputsInfo(reshapedOutputs);
+        copyInputOutputInfo(reshapedInputs, reshapedOutputs, batchedInputs, batchedOutputs);
+        for (auto&& input : batchedInputs) {
+            // pre-processing is done by the batching infer requests before the data is gathered
+            input.second->getPreProcess().setResizeAlgorithm(ResizeAlgorithm::NO_RESIZE);
+            input.second->getPreProcess().setColorFormat(ColorFormat::RAW);
+        }
+
+        conf.enableDynamicBatch = true;
+        conf.batchLimit = static_cast<int>(batchedSize);
+    }
+
+    if (!isTransformed && clonedNetwork->getFunction()) {
         const auto transformations_callback = [](const std::shared_ptr<const ::ngraph::Node> &node) -> bool {
             return std::dynamic_pointer_cast<const ::ngraph::opset2::Gelu>(node) ||
                 std::dynamic_pointer_cast<const ::ngraph::opset2::BatchToSpace>(node) ||
@@ -100,13 +211,53 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
     }
 
     auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
-    if (implNetwork) {
+    if (!isTransformed && implNetwork) {
         // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
         ConstTransformer transformator(implNetwork.get());
         transformator.fullTrim();
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    // the batched network is reshaped, so the state of the exported graph does not apply to it
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, *weightsSharing,
+                                                           isTransformed,
+                                                           conf.requestsBatchSize > 1 ? nullptr : graphState);
+    if (conf.requestsBatchSize > 1) {
+        execNetwork->setNetworkInputs(batchedInputs);
+        execNetwork->setNetworkOutputs(batchedOutputs);
+        execNetwork->SetPointerToPluginInternal(shared_from_this());
+        return std::make_shared<MKLDNNBatchingExecNetwork>(execNetwork, conf.requestsBatchSize, static_cast<int>(networkBatch),
+                                                           std::chrono::microseconds(conf.requestsBatchTimeout),
+                                                           conf.collectPerfCounters);
+    }
+    return execNetwork;
+}
+
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream &networkModel, const std::map<std::string, std::string> &config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+
+    Config conf = engConfig;
+    MKLDNNGraphState::Ptr graphState;
+    auto network = MKLDNNExecNetwork::ReadExportedNetwork(networkModel, conf, graphState, config, GetCore());
+
+    // the same wrappers as for a loaded network, so an imported network behaves as the loaded one
+    auto execNetwork = CreateExecNetwork(*network, conf, true, graphState);
+    InputsDataMap inputs, networkInputs;
+    OutputsDataMap outputs, networkOutputs;
+    network->getInputsInfo(inputs);
+    network->getOutputsInfo(outputs);
+    copyInputOutputInfo(inputs, outputs, networkInputs, networkOutputs);
+    execNetwork->setNetworkInputs(networkInputs);
+    execNetwork->setNetworkOutputs(networkOutputs);
+    execNetwork->SetPointerToPluginInternal(shared_from_this());
+
+    IExecutableNetwork::Ptr executableNetwork;
+    executableNetwork.reset(new ExecutableNetworkBase<ExecutableNetworkInternal>(execNetwork),
+                            [](InferenceEngine::details::IRelease *p) {p->Release();});
+
+    return ExecutableNetwork{executableNetwork};
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -149,6 +300,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(CPU_WEIGHTS_SHARING_BYTES_SAVED));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -193,6 +345,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(CPU_WEIGHTS_SHARING_BYTES_SAVED)) {
+        IE_SET_METRIC_RETURN(CPU_WEIGHTS_SHARING_BYTES_SAVED, weightsSharing->GetBytesSaved());
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -25,6 +25,10 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::ExecutableNetwork
+    ImportNetworkImpl(std::istream &networkModel,
+                      const std::map<std::string, std::string> &config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
@@ -37,8 +41,18 @@ public:
                       const std::map<std::string, std::string>& config, InferenceEngine::QueryNetworkResult& res) const override;
 
 private:
+    // creates the executable network, wrapped by the shapes cache or the requests batching if they are enabled
+    InferenceEngine::ExecutableNetworkInternal::Ptr
+    CreateExecNetwork(const InferenceEngine::ICNNNetwork &network, Config conf, bool isTransformed,
+                      const MKLDNNGraphState::Ptr &graphState = nullptr);
+
+    // applies the transformations to the network clone, unless it is imported, and compiles it
+    InferenceEngine::ExecutableNetworkInternal::Ptr
+    CompileNetwork(const InferenceEngine::ICNNNetwork &network, Config conf, bool isTransformed,
+                   const MKLDNNGraphState::Ptr &graphState = nullptr);
+
     Config engConfig;
-    NumaNodesWeights weightsSharing;
+    NumaNodesWeights::Ptr weightsSharing = NumaNodesWeights::GetShared();
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
 };
 
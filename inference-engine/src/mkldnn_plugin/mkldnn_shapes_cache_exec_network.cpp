@@ -0,0 +1,781 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_shapes_cache_exec_network.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ie_compound_blob.h>
+#include <ie_metric_helpers.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_util_internal.hpp>
+#include <blob_factory.hpp>
+#include <debug.h>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <cpp_interfaces/exception2status.hpp>
+#include <details/ie_exception_conversion.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/arithmetic_reductions_keep_dims.hpp>
+#include <ngraph/op/util/logical_reduction_keep_dims.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+std::string getShapesKey(const ICNNNetwork::InputShapes& shapes) {
+    // std::map keeps the inputs sorted by names
+    std::string key;
+    for (auto&& shape : shapes) {
+        key += shape.first + ":";
+        for (size_t i = 0; i < shape.second.size(); i++) {
+            key += (i == 0 ? "" : ",") + std::to_string(shape.second[i]);
+        }
+        key += ";";
+    }
+    return key;
+}
+
+bool isPlanar(const TensorDesc& desc) {
+    const auto& order = desc.getBlockingDesc().getOrder();
+    for (size_t i = 0; i < order.size(); i++) {
+        if (order[i] != i) {
+            return false;
+        }
+    }
+    return order.size() == desc.getDims().size();
+}
+
+// returns whether the zeros appended to the spatial dimensions of the inputs keep the leading region of the outputs,
+// the operations which reduce or normalize the spatial dimensions (e.g. global pooling, softmax or reductions over them)
+// and the windows which read the padded area beyond the original input are refused
+bool isPaddingSafe(const ngraph::Function& function) {
+    using Port = std::pair<const ngraph::Node*, size_t>;
+    // the outputs which padded area holds zeros, as the padded inputs do
+    std::set<Port> zeroPadded;
+    auto isZeroPadded = [&] (const ngraph::Output<ngraph::Node>& output) {
+        return zeroPadded.count(Port{output.get_node(), output.get_index()}) != 0;
+    };
+    auto allInputsZeroPadded = [&] (const ngraph::Node& op) {
+        for (auto&& input : op.input_values()) {
+            if (!isZeroPadded(input)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto isChannelsOrBatch = [] (int64_t axis, size_t rank) {
+        return (axis < 0 ? axis + static_cast<int64_t>(rank) : axis) < 2;
+    };
+    // the window ends before the padded area, or the padded area is read as zeros of the explicit padding
+    auto isWindowSafe = [&] (const ngraph::Node& op, const std::vector<size_t>& padsEnd, ngraph::op::PadType autoPad, bool zerosAreExact) {
+        if (autoPad != ngraph::op::PadType::EXPLICIT && autoPad != ngraph::op::PadType::VALID) {
+            return false;
+        }
+        bool noPadsEnd = autoPad == ngraph::op::PadType::VALID ||
+            std::all_of(padsEnd.begin(), padsEnd.end(), [] (size_t pad) { return pad == 0; });
+        return noPadsEnd || (zerosAreExact && isZeroPadded(op.input_value(0)));
+    };
+    // elementwise operations which map zeros to zeros
+    static const std::set<std::string> zeroPreserving = {
+        "Relu", "Abs", "Negative", "Sqrt", "Tanh", "Elu", "Gelu", "Swish", "HSwish", "Convert", "Multiply", "PRelu"
+    };
+    static const std::set<std::string> elementwise = {
+        "Relu", "Abs", "Negative", "Sqrt", "Tanh", "Elu", "Gelu", "Swish", "HSwish", "Convert", "Multiply", "PRelu",
+        "Sigmoid", "Exp", "Clamp", "Floor", "Ceiling", "Erf", "Add", "Subtract", "Divide", "Maximum", "Minimum",
+        "Power", "SquaredDifference", "FakeQuantize", "BatchNormInference"
+    };
+
+    for (auto&& op : function.get_ordered_ops()) {
+        const std::string type = op->get_type_name();
+        bool safe = false;
+        bool zeros = false;
+        if (ngraph::is_type<ngraph::opset1::Parameter>(op)) {
+            safe = zeros = true;
+        } else if (ngraph::is_type<ngraph::opset1::Constant>(op) || ngraph::is_type<ngraph::opset1::Result>(op)) {
+            safe = true;
+        } else if (elementwise.count(type) != 0) {
+            safe = true;
+            // the multiplication keeps zeros of any of its inputs, the rest keep zeros of all data inputs
+            if (type == "Multiply") {
+                zeros = isZeroPadded(op->input_value(0)) || isZeroPadded(op->input_value(1));
+            } else {
+                zeros = zeroPreserving.count(type) != 0 && isZeroPadded(op->input_value(0));
+            }
+        } else if (auto conv = ngraph::as_type_ptr<ngraph::opset1::Convolution>(op)) {
+            safe = isWindowSafe(*op, std::vector<size_t>(conv->get_pads_end().begin(), conv->get_pads_end().end()),
+                                conv->get_auto_pad(), true);
+        } else if (auto conv = ngraph::as_type_ptr<ngraph::opset1::GroupConvolution>(op)) {
+            safe = isWindowSafe(*op, std::vector<size_t>(conv->get_pads_end().begin(), conv->get_pads_end().end()),
+                                conv->get_auto_pad(), true);
+        } else if (auto pool = ngraph::as_type_ptr<ngraph::opset1::AvgPool>(op)) {
+            // the excluded padding changes the divisor near the original border,
+            // the last window of the ceil rounding is cut by the original border, but not by the padded one
+            safe = pool->get_rounding_type() != ngraph::op::RoundingType::CEIL &&
+                isWindowSafe(*op, pool->get_pads_end(), pool->get_auto_pad(), !pool->get_exclude_pad());
+        } else if (auto pool = ngraph::as_type_ptr<ngraph::opset1::MaxPool>(op)) {
+            // the explicit padding of the max pooling is not zeros
+            safe = pool->get_rounding_type() != ngraph::op::RoundingType::CEIL &&
+                isWindowSafe(*op, pool->get_pads_end(), pool->get_auto_pad(), false);
+        } else if (auto softmax = ngraph::as_type_ptr<ngraph::opset1::Softmax>(op)) {
+            safe = softmax->get_axis() < 2;
+        } else if (auto concat = ngraph::as_type_ptr<ngraph::opset1::Concat>(op)) {
+            safe = isChannelsOrBatch(concat->get_axis(), op->get_output_partial_shape(0).rank().get_length());
+            zeros = allInputsZeroPadded(*op);
+        } else if (auto reduce = std::dynamic_pointer_cast<ngraph::op::util::ArithmeticReductionKeepDims>(op)) {
+            safe = reduce->reduction_axes_constant();
+            for (auto axis : safe ? reduce->get_reduction_axes() : ngraph::AxisSet{}) {
+                safe = safe && axis < 2;
+            }
+        } else if (auto reduce = std::dynamic_pointer_cast<ngraph::op::util::LogicalReductionKeepDims>(op)) {
+            safe = reduce->reduction_axes_constant();
+            for (auto axis : safe ? reduce->get_reduction_axes() : ngraph::AxisSet{}) {
+                safe = safe && axis < 2;
+            }
+        }
+        if (!safe) {
+            return false;
+        }
+        if (zeros) {
+            for (size_t i = 0; i < op->get_output_size(); i++) {
+                zeroPadded.insert(Port{op.get(), i});
+            }
+        }
+    }
+    return true;
+}
+
+// the padding is valid for planar layouts with the batch and channels in the first two dimensions only
+bool isPaddingSupported(const ICNNNetwork& network) {
+    // the layers of the networks without nGraph functions are not checked, so they are never padded
+    auto function = network.getFunction();
+    if (!function || !isPaddingSafe(*function)) {
+        return false;
+    }
+    InputsDataMap inputs;
+    OutputsDataMap outputs;
+    network.getInputsInfo(inputs);
+    network.getOutputsInfo(outputs);
+    for (auto&& input : inputs) {
+        const auto& desc = input.second->getTensorDesc();
+        if (desc.getDims().size() < 3 || !isPlanar(desc)) {
+            return false;
+        }
+    }
+    for (auto&& output : outputs) {
+        if (!isPlanar(output.second->getTensorDesc())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Blob::Ptr makeBlob(const TensorDesc& desc, const SizeVector& dims) {
+    auto blob = make_blob_with_precision(TensorDesc{desc.getPrecision(), dims, desc.getLayout()});
+    blob->allocate();
+    return blob;
+}
+
+// copies the leading region common for both blobs, the rest of the destination blob is not changed
+void copyRegion(const Blob::Ptr& src, const Blob::Ptr& dst, const std::string& name) {
+    auto srcPtr = src->cbuffer().as<const uint8_t*>();
+    auto dstPtr = dst->buffer().as<uint8_t*>();
+    if (srcPtr == nullptr || dstPtr == nullptr) {
+        THROW_IE_EXCEPTION << "Blob " << name << " is not allocated or has unsupported type";
+    }
+    const auto& srcDims = src->getTensorDesc().getDims();
+    const auto& dstDims = dst->getTensorDesc().getDims();
+    if (srcDims.empty() || srcDims.size() != dstDims.size()) {
+        THROW_IE_EXCEPTION << "Blob " << name << " has unexpected rank " << srcDims.size();
+    }
+    const size_t rank = srcDims.size();
+    const size_t elemSize = src->getTensorDesc().getPrecision().size();
+    SizeVector region(rank), srcStrides(rank, elemSize), dstStrides(rank, elemSize);
+    for (size_t i = rank; i-- > 0;) {
+        region[i] = std::min(srcDims[i], dstDims[i]);
+        if (i + 1 < rank) {
+            srcStrides[i] = srcStrides[i + 1] * srcDims[i + 1];
+            dstStrides[i] = dstStrides[i + 1] * dstDims[i + 1];
+        }
+    }
+    const size_t rowSize = region[rank - 1] * elemSize;
+    size_t rows = 1;
+    for (size_t i = 0; i + 1 < rank; i++) {
+        rows *= region[i];
+    }
+    SizeVector index(rank, 0);
+    for (size_t row = 0; row < rows; row++) {
+        size_t srcOffset = 0, dstOffset = 0;
+        for (size_t i = 0; i + 1 < rank; i++) {
+            srcOffset += index[i] * srcStrides[i];
+            dstOffset += index[i] * dstStrides[i];
+        }
+        std::memcpy(dstPtr + dstOffset, srcPtr + srcOffset, rowSize);
+        for (size_t i = rank - 1; i-- > 0;) {
+            if (++index[i] < region[i]) {
+                break;
+            }
+            index[i] = 0;
+        }
+    }
+}
+
+}  // namespace
+
+// ------------------------------MKLDNNShapesCacheInferRequest----------------------------
+
+MKLDNNShapesCacheInferRequest::MKLDNNShapesCacheInferRequest(const InputsDataMap&   networkInputs,
+                                                             const OutputsDataMap&  networkOutputs)
+        : InferRequestInternal(networkInputs, networkOutputs) {
+    for (const auto& it : networkInputs) {
+        _inputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _inputs[it.first]->allocate();
+    }
+    for (const auto& it : networkOutputs) {
+        _outputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _outputs[it.first]->allocate();
+    }
+}
+
+void MKLDNNShapesCacheInferRequest::SetBlob(const char* name, const Blob::Ptr& data) {
+    if (name == nullptr) {
+        THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set blob with empty name";
+    }
+    if (!data) {
+        THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty blob with name: \'" << name << "\'";
+    }
+    if (data->is<CompoundBlob>()) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Compound blobs are not supported together with "
+                           << PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE;
+    }
+    if (data->buffer() == nullptr) {
+        THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << name << "\'";
+    }
+
+    InputInfo::Ptr foundInput;
+    DataPtr foundOutput;
+    const bool isInput = findInputAndOutputBlobByName(name, foundInput, foundOutput);
+    const auto& desc = isInput ? foundInput->getTensorDesc() : foundOutput->getTensorDesc();
+    if (desc.getPrecision() != data->getTensorDesc().getPrecision()) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set Blob with precision "
+                           << data->getTensorDesc().getPrecision() << " while " << desc.getPrecision() << " is expected";
+    }
+    // the shapes are checked when the network for them is compiled
+    if (desc.getDims().size() != data->getTensorDesc().getDims().size()) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set Blob " << name << " of rank "
+                           << data->getTensorDesc().getDims().size() << " while " << desc.getDims().size() << " is expected";
+    }
+    if (isInput) {
+        _inputs[name] = data;
+    } else {
+        _outputs[name] = data;
+        _userOutputs.insert(name);
+    }
+}
+
+void MKLDNNShapesCacheInferRequest::GetBlob(const char* name, Blob::Ptr& data) {
+    InputInfo::Ptr foundInput;
+    DataPtr foundOutput;
+    if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
+        data = _inputs[name];
+    } else {
+        data = _outputs[name];
+    }
+    if (!data) {
+        THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Blob " << name << " is not allocated";
+    }
+}
+
+void MKLDNNShapesCacheInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const {
+    perfMap = _perfMap;
+}
+
+ICNNNetwork::InputShapes MKLDNNShapesCacheInferRequest::GetInputShapes() const {
+    ICNNNetwork::InputShapes shapes;
+    for (auto&& input : _inputs) {
+        shapes[input.first] = input.second->getTensorDesc().getDims();
+    }
+    return shapes;
+}
+
+void MKLDNNShapesCacheInferRequest::PrepareOutput(const std::string& name, const SizeVector& dims) {
+    auto& output = _outputs[name];
+    if (output->getTensorDesc().getDims() == dims) {
+        return;
+    }
+    if (_userOutputs.count(name) != 0) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Output blob " << name << " has dims "
+                           << details::dumpVec(output->getTensorDesc().getDims())
+                           << " while the network produces " << details::dumpVec(dims) << " for the input shapes";
+    }
+    output = makeBlob(output->getTensorDesc(), dims);
+}
+
+void MKLDNNShapesCacheInferRequest::BindTo(InferRequest& workerRequest, const std::map<std::string, SizeVector>& outputDims) {
+    // this request is already in BUSY state, so using the internal functions safely
+    for (auto&& input : _inputs) {
+        workerRequest.SetBlob(input.first, input.second);
+    }
+    for (auto&& output : outputDims) {
+        PrepareOutput(output.first, output.second);
+        workerRequest.SetBlob(output.first, _outputs[output.first]);
+    }
+}
+
+void MKLDNNShapesCacheInferRequest::BindPaddedTo(InferRequest& workerRequest,
+                                                 const ICNNNetwork::InputShapes& paddedInputDims,
+                                                 const std::map<std::string, SizeVector>& paddedOutputDims,
+                                                 const std::map<std::string, SizeVector>& outputDims) {
+    for (auto&& input : _inputs) {
+        const auto& dims = paddedInputDims.at(input.first);
+        auto& padded = _paddedInputs[input.first];
+        if (!padded || padded->getTensorDesc().getDims() != dims) {
+            padded = makeBlob(input.second->getTensorDesc(), dims);
+        }
+        std::memset(padded->buffer().as<uint8_t*>(), 0, padded->byteSize());
+        copyRegion(input.second, padded, input.first);
+        workerRequest.SetBlob(input.first, padded);
+    }
+    for (auto&& output : paddedOutputDims) {
+        auto& padded = _paddedOutputs[output.first];
+        if (!padded || padded->getTensorDesc().getDims() != output.second) {
+            padded = makeBlob(_outputs[output.first]->getTensorDesc(), output.second);
+        }
+        PrepareOutput(output.first, outputDims.at(output.first));
+        workerRequest.SetBlob(output.first, padded);
+    }
+}
+
+void MKLDNNShapesCacheInferRequest::CropOutputs() {
+    for (auto&& output : _outputs) {
+        copyRegion(_paddedOutputs.at(output.first), output.second, output.first);
+    }
+}
+
+// ------------------------------MKLDNNShapesCacheAsyncInferRequest----------------------------
+
+MKLDNNShapesCacheAsyncInferRequest::MKLDNNShapesCacheAsyncInferRequest(const MKLDNNShapesCacheInferRequest::Ptr&  inferRequest,
+                                                                       const MKLDNNShapesCacheExecNetwork::Ptr&   shapesCacheExecNetwork,
+                                                                       const ITaskExecutor::Ptr&                  callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _inferRequest{inferRequest},
+    _shapesCacheExecNetwork{shapesCacheExecNetwork} {
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(MKLDNNShapesCacheAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_exception = nullptr;
+            _this->_shapesCacheExecNetwork->Dispatch({_this, std::move(task)});
+        }
+        MKLDNNShapesCacheAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        {std::make_shared<ThisRequestExecutor>(this), [this] {
+            if (nullptr != _exception) {
+                std::rethrow_exception(_exception);
+            }
+        }}
+    };
+}
+
+void MKLDNNShapesCacheAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+MKLDNNShapesCacheAsyncInferRequest::~MKLDNNShapesCacheAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------MKLDNNShapesCacheExecNetwork----------------------------
+
+MKLDNNShapesCacheExecNetwork::MKLDNNShapesCacheExecNetwork(const ICNNNetwork&          network,
+                                                           CompileFunction             compile,
+                                                           size_t                      cacheSize,
+                                                           bool                        padding,
+                                                           bool                        needPerfCounters,
+                                                           const ITaskExecutor::Ptr&   compileExecutor) :
+    ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<ImmediateExecutor>()),
+    _network{cloneNetwork(network)},
+    _compile{std::move(compile)},
+    _cacheSize{std::max<size_t>(cacheSize, 1)},
+    _padding{padding && isPaddingSupported(network)},
+    _needPerfCounters{needPerfCounters},
+    _compileExecutor{compileExecutor} {
+    InputsDataMap inputs;
+    OutputsDataMap outputs;
+    network.getInputsInfo(inputs);
+    network.getOutputsInfo(outputs);
+
+    auto entry = std::make_shared<Entry>();
+    for (auto&& input : inputs) {
+        entry->_inputDims[input.first] = input.second->getTensorDesc().getDims();
+    }
+    for (auto&& output : outputs) {
+        entry->_outputDims[output.first] = output.second->getTensorDesc().getDims();
+    }
+    entry->_key = getShapesKey(entry->_inputDims);
+
+    auto start = Clock::now();
+    _defaultNetwork = _compile(network);
+    _compileTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    entry->_network = _defaultNetwork;
+
+    _lru.push_front(entry);
+    _entries[entry->_key] = _lru.begin();
+}
+
+MKLDNNShapesCacheExecNetwork::~MKLDNNShapesCacheExecNetwork() {
+    /* NOTE: Shapes cache infer requests and compilation tasks hold the network, so there are no pending requests
+     *       at this point. Worker infer request destructors wait for the requests in flight.
+     */
+    _entries.clear();
+    _lru.clear();
+    _evicted.clear();
+}
+
+std::shared_ptr<MKLDNNShapesCacheExecNetwork::Entry>
+MKLDNNShapesCacheExecNetwork::CreateEntry(const std::string& key, const ICNNNetwork::InputShapes& shapes,
+                                          std::shared_ptr<ICNNNetwork>& reshapedNetwork) {
+    {
+        // the original network is not guarded against concurrent access, so it is cloned by one request at a time
+        std::lock_guard<std::mutex> lock{_reshapeMutex};
+        reshapedNetwork = cloneNetwork(*_network);
+    }
+    ResponseDesc resp;
+    if (StatusCode::OK != reshapedNetwork->reshape(shapes, &resp)) {
+        THROW_IE_EXCEPTION << "Failed to reshape the network to the input shapes " << key << ": " << resp.msg;
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->_key = key;
+    entry->_inputDims = shapes;
+    OutputsDataMap outputs;
+    reshapedNetwork->getOutputsInfo(outputs);
+    for (auto&& output : outputs) {
+        entry->_outputDims[output.first] = output.second->getTensorDesc().getDims();
+    }
+    return entry;
+}
+
+std::shared_ptr<MKLDNNShapesCacheExecNetwork::Entry> MKLDNNShapesCacheExecNetwork::FindPaddedEntry(const Entry& entry) const {
+    if (!_padding) {
+        return nullptr;
+    }
+    auto covers = [] (const SizeVector& padded, const SizeVector& dims, size_t exactDims) {
+        if (padded.size() != dims.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < dims.size(); i++) {
+            if (i < exactDims ? padded[i] != dims[i] : padded[i] < dims[i]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::shared_ptr<Entry> nearest;
+    size_t nearestSize = std::numeric_limits<size_t>::max();
+    for (auto&& candidate : _lru) {
+        if (!candidate->_network) {
+            continue;
+        }
+        bool fits = true;
+        size_t size = 0;
+        for (auto&& input : entry._inputDims) {
+            const auto& padded = candidate->_inputDims.at(input.first);
+            // the batch and channels must match, the spatial dimensions are padded
+            fits = fits && covers(padded, input.second, 2);
+            size += details::product(padded);
+        }
+        for (auto&& output : entry._outputDims) {
+            fits = fits && covers(candidate->_outputDims.at(output.first), output.second, 0);
+        }
+        if (fits && size < nearestSize) {
+            nearest = candidate;
+            nearestSize = size;
+        }
+    }
+    return nearest;
+}
+
+MKLDNNShapesCacheExecNetwork::WorkerInferRequest* MKLDNNShapesCacheExecNetwork::Acquire(Entry& entry) {
+    // called under the lock, the entry is not purged until the request is completed
+    entry._busyRequests++;
+    if (entry._idleWorkerRequests.empty()) {
+        return nullptr;
+    }
+    auto workerRequest = entry._idleWorkerRequests.back();
+    entry._idleWorkerRequests.pop_back();
+    return workerRequest;
+}
+
+void MKLDNNShapesCacheExecNetwork::Dispatch(PendingRequest pendingRequest) {
+    std::exception_ptr exception;
+    try {
+        auto shapes = pendingRequest._request->_inferRequest->GetInputShapes();
+        auto key = getShapesKey(shapes);
+        std::shared_ptr<ICNNNetwork> reshapedNetwork;
+        std::shared_ptr<Entry> newEntry;
+        while (true) {
+            std::unique_lock<std::mutex> lock{_mutex};
+            auto found = _entries.find(key);
+            if (found == _entries.end() && newEntry) {
+                _lru.push_front(newEntry);
+                _entries[key] = _lru.begin();
+                _misses++;
+                found = _entries.find(key);
+            }
+
+            if (found != _entries.end()) {
+                _lru.splice(_lru.begin(), _lru, found->second);
+                auto entry = _lru.front();
+                if (entry->_network) {
+                    _hits++;
+                    auto workerRequest = Acquire(*entry);
+                    Evict();
+                    lock.unlock();
+                    Run(entry, workerRequest, std::move(pendingRequest), nullptr);
+                    return;
+                }
+
+                auto paddedEntry = FindPaddedEntry(*entry);
+                WorkerInferRequest* workerRequest = nullptr;
+                std::map<std::string, SizeVector> outputDims;
+                if (paddedEntry) {
+                    _paddedHits++;
+                    workerRequest = Acquire(*paddedEntry);
+                    outputDims = entry->_outputDims;
+                } else {
+                    entry->_waitingRequests.push_back(std::move(pendingRequest));
+                }
+                lock.unlock();
+
+                if (entry == newEntry) {
+                    auto self = std::static_pointer_cast<MKLDNNShapesCacheExecNetwork>(shared_from_this());
+                    _compileExecutor->run([self, newEntry, reshapedNetwork] {
+                        self->Compile(newEntry, reshapedNetwork);
+                    });
+                }
+                if (paddedEntry) {
+                    Run(paddedEntry, workerRequest, std::move(pendingRequest), &outputDims);
+                }
+                return;
+            }
+            lock.unlock();
+
+            // the network is reshaped out of the lock, the entry is inserted on the next iteration
+            // unless another request inserted it meanwhile
+            newEntry = CreateEntry(key, shapes, reshapedNetwork);
+        }
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    Fail(pendingRequest, exception);
+}
+
+void MKLDNNShapesCacheExecNetwork::Compile(const std::shared_ptr<Entry>& entry, const std::shared_ptr<ICNNNetwork>& reshapedNetwork) {
+    std::exception_ptr exception;
+    ExecutableNetworkInternal::Ptr network;
+    auto start = Clock::now();
+    try {
+        network = _compile(*reshapedNetwork);
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    _compileTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+    std::vector<PendingRequest> waitingRequests;
+    std::vector<WorkerInferRequest*> workerRequests;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        waitingRequests = std::move(entry->_waitingRequests);
+        entry->_waitingRequests.clear();
+        if (nullptr == exception) {
+            entry->_network = network;
+            for (size_t i = 0; i < waitingRequests.size(); i++) {
+                workerRequests.push_back(Acquire(*entry));
+            }
+        } else {
+            // the next request with the same shapes tries to compile the network again
+            auto found = _entries.find(entry->_key);
+            if (found != _entries.end() && *found->second == entry) {
+                _lru.erase(found->second);
+                _entries.erase(found);
+            }
+        }
+        Evict();
+    }
+
+    for (size_t i = 0; i < waitingRequests.size(); i++) {
+        if (nullptr == exception) {
+            Run(entry, workerRequests[i], std::move(waitingRequests[i]), nullptr);
+        } else {
+            Fail(waitingRequests[i], exception);
+        }
+    }
+}
+
+void MKLDNNShapesCacheExecNetwork::Run(const std::shared_ptr<Entry>& entry, WorkerInferRequest* workerRequest,
+                                       PendingRequest pendingRequest, const std::map<std::string, SizeVector>* outputDims) {
+    std::exception_ptr exception;
+    try {
+        if (workerRequest == nullptr) {
+            std::unique_ptr<WorkerInferRequest> newWorkerRequest{new WorkerInferRequest};
+            IInferRequest::Ptr inferRequest;
+            entry->_network->CreateInferRequest(inferRequest);
+            newWorkerRequest->_inferRequest = InferRequest{inferRequest};
+            newWorkerRequest->_entry = entry.get();
+            auto workerRequestPtr = newWorkerRequest.get();
+            newWorkerRequest->_inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [this, workerRequestPtr] (InferRequest, StatusCode status) {
+                    OnWorkerCompleted(workerRequestPtr, status);
+                });
+            std::lock_guard<std::mutex> lock{_mutex};
+            entry->_workerRequests.emplace_back(std::move(newWorkerRequest));
+            workerRequest = workerRequestPtr;
+        }
+
+        auto& inferRequest = pendingRequest._request->_inferRequest;
+        workerRequest->_padded = outputDims != nullptr;
+        if (workerRequest->_padded) {
+            inferRequest->BindPaddedTo(workerRequest->_inferRequest, entry->_inputDims, entry->_outputDims, *outputDims);
+        } else {
+            inferRequest->BindTo(workerRequest->_inferRequest, entry->_outputDims);
+        }
+        workerRequest->_pending = std::move(pendingRequest);
+        workerRequest->_inferRequest.StartAsync();
+        return;
+    } catch (...) {
+        exception = std::current_exception();
+    }
+
+    if (workerRequest != nullptr && workerRequest->_pending._task) {
+        pendingRequest = std::move(workerRequest->_pending);
+        workerRequest->_pending = {};
+    }
+    Fail(pendingRequest, exception);
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (workerRequest != nullptr) {
+        entry->_idleWorkerRequests.push_back(workerRequest);
+    }
+    entry->_busyRequests--;
+}
+
+void MKLDNNShapesCacheExecNetwork::OnWorkerCompleted(WorkerInferRequest* workerRequest, StatusCode status) {
+    auto pendingRequest = std::move(workerRequest->_pending);
+    workerRequest->_pending = {};
+
+    std::exception_ptr exception;
+    if (StatusCode::OK != status) {
+        exception = InferenceEngine::CurrentException();
+        if (nullptr == exception) {
+            try {
+                THROW_IE_EXCEPTION << details::as_status << status;
+            } catch (...) {
+                exception = std::current_exception();
+            }
+        }
+    } else {
+        try {
+            auto& inferRequest = pendingRequest._request->_inferRequest;
+            if (workerRequest->_padded) {
+                inferRequest->CropOutputs();
+            }
+            if (_needPerfCounters) {
+                inferRequest->_perfMap = workerRequest->_inferRequest.GetPerformanceCounts();
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+
+    pendingRequest._request->_exception = exception;
+    pendingRequest._task();
+
+    // evicted entries are purged by Dispatch and Compile, so the worker request is not destroyed here
+    std::lock_guard<std::mutex> lock{_mutex};
+    workerRequest->_entry->_idleWorkerRequests.push_back(workerRequest);
+    workerRequest->_entry->_busyRequests--;
+}
+
+void MKLDNNShapesCacheExecNetwork::Evict() {
+    // called under the lock, networks which are being compiled are never evicted
+    for (auto it = _lru.end(); _lru.size() > _cacheSize && it != _lru.begin();) {
+        --it;
+        if ((*it)->_network) {
+            _entries.erase((*it)->_key);
+            _evicted.push_back(*it);
+            it = _lru.erase(it);
+        }
+    }
+    _evicted.erase(std::remove_if(_evicted.begin(), _evicted.end(), [] (const std::shared_ptr<Entry>& entry) {
+        return entry->_busyRequests == 0;
+    }), _evicted.end());
+}
+
+void MKLDNNShapesCacheExecNetwork::Fail(PendingRequest& pendingRequest, std::exception_ptr exception) {
+    if (!pendingRequest._task) {
+        // the request is already passed to a network entry
+        return;
+    }
+    pendingRequest._request->_exception = exception;
+    pendingRequest._task();
+}
+
+InferRequestInternal::Ptr MKLDNNShapesCacheExecNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                               OutputsDataMap networkOutputs) {
+    return std::make_shared<MKLDNNShapesCacheInferRequest>(networkInputs, networkOutputs);
+}
+
+void MKLDNNShapesCacheExecNetwork::CreateInferRequest(IInferRequest::Ptr& asyncRequest) {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncRequestImpl = std::make_shared<MKLDNNShapesCacheAsyncInferRequest>(
+        std::static_pointer_cast<MKLDNNShapesCacheInferRequest>(syncRequestImpl),
+        std::static_pointer_cast<MKLDNNShapesCacheExecNetwork>(shared_from_this()),
+        _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<MKLDNNShapesCacheAsyncInferRequest>(asyncRequestImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
+}
+
+void MKLDNNShapesCacheExecNetwork::GetConfig(const std::string& name, Parameter& result, ResponseDesc* resp) const {
+    _defaultNetwork->GetConfig(name, result, resp);
+}
+
+void MKLDNNShapesCacheExecNetwork::GetMetric(const std::string& name, Parameter& result, ResponseDesc* resp) const {
+    if (name == METRIC_KEY(CPU_SHAPES_CACHE_HITS)) {
+        result = IE_SET_METRIC(CPU_SHAPES_CACHE_HITS, _hits.load());
+    } else if (name == METRIC_KEY(CPU_SHAPES_CACHE_PADDED_HITS)) {
+        result = IE_SET_METRIC(CPU_SHAPES_CACHE_PADDED_HITS, _paddedHits.load());
+    } else if (name == METRIC_KEY(CPU_SHAPES_CACHE_MISSES)) {
+        result = IE_SET_METRIC(CPU_SHAPES_CACHE_MISSES, _misses.load());
+    } else if (name == METRIC_KEY(CPU_SHAPES_CACHE_COMPILE_TIME)) {
+        result = IE_SET_METRIC(CPU_SHAPES_CACHE_COMPILE_TIME, _compileTimeUs.load() / 1000.f);
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        _defaultNetwork->GetMetric(name, result, resp);
+        auto metrics = result.as<std::vector<std::string>>();
+        metrics.push_back(METRIC_KEY(CPU_SHAPES_CACHE_HITS));
+        metrics.push_back(METRIC_KEY(CPU_SHAPES_CACHE_PADDED_HITS));
+        metrics.push_back(METRIC_KEY(CPU_SHAPES_CACHE_MISSES));
+        metrics.push_back(METRIC_KEY(CPU_SHAPES_CACHE_COMPILE_TIME));
+        result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
+    } else {
+        _defaultNetwork->GetMetric(name, result, resp);
+    }
+}
+
+void MKLDNNShapesCacheExecNetwork::GetExecGraphInfo(ICNNNetwork::Ptr& graphPtr) {
+    _defaultNetwork->GetExecGraphInfo(graphPtr);
+}
@@ -0,0 +1,202 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp/ie_infer_request.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Infer request of the shapes cache network. Accepts input blobs of any spatial size,
+ * the inference is executed by a worker request of the network compiled for the input shapes.
+ */
+class MKLDNNShapesCacheInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<MKLDNNShapesCacheInferRequest>;
+    MKLDNNShapesCacheInferRequest(const InferenceEngine::InputsDataMap&  networkInputs,
+                                  const InferenceEngine::OutputsDataMap& networkOutputs);
+
+    void InferImpl() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    void SetBlob(const char* name, const InferenceEngine::Blob::Ptr& data) override;
+
+    void GetBlob(const char* name, InferenceEngine::Blob::Ptr& data) override;
+
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const override;
+
+    // returns the shapes of the current input blobs
+    InferenceEngine::ICNNNetwork::InputShapes GetInputShapes() const;
+
+    // sets the input and output blobs of the request to the worker request compiled for the same shapes
+    void BindTo(InferenceEngine::InferRequest& workerRequest,
+                const std::map<std::string, InferenceEngine::SizeVector>& outputDims);
+
+    // copies the inputs to the worker request compiled for greater spatial dimensions, the rest is filled by zeros
+    void BindPaddedTo(InferenceEngine::InferRequest& workerRequest,
+                      const InferenceEngine::ICNNNetwork::InputShapes& paddedInputDims,
+                      const std::map<std::string, InferenceEngine::SizeVector>& paddedOutputDims,
+                      const std::map<std::string, InferenceEngine::SizeVector>& outputDims);
+
+    // copies the leading part of the padded worker outputs to the output blobs
+    void CropOutputs();
+
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> _perfMap;
+
+private:
+    void PrepareOutput(const std::string& name, const InferenceEngine::SizeVector& dims);
+
+    std::set<std::string>                                   _userOutputs;
+    std::map<std::string, InferenceEngine::Blob::Ptr>       _paddedInputs;
+    std::map<std::string, InferenceEngine::Blob::Ptr>       _paddedOutputs;
+};
+
+class MKLDNNShapesCacheAsyncInferRequest;
+
+/**
+ * @brief Executable network which keeps up to the given number of networks compiled for different input shapes.
+ *
+ * Infer requests are executed by the network compiled for the shapes of their input blobs. A network for new shapes
+ * is compiled in the background, the requests wait for it or, if the padding is enabled, are executed by the cached
+ * network with the nearest greater spatial dimensions of the inputs. The padding is disabled for the networks which
+ * results depend on it. The least recently used networks are evicted.
+ */
+class MKLDNNShapesCacheExecNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<MKLDNNShapesCacheExecNetwork>;
+    using Clock = std::chrono::steady_clock;
+    // compiles a network reshaped to the cached shapes and sets its inputs and outputs info
+    using CompileFunction = std::function<InferenceEngine::ExecutableNetworkInternal::Ptr(const InferenceEngine::ICNNNetwork&)>;
+
+    struct PendingRequest {
+        MKLDNNShapesCacheAsyncInferRequest* _request;
+        InferenceEngine::Task               _task;
+    };
+
+    struct Entry;
+
+    struct WorkerInferRequest {
+        InferenceEngine::InferRequest       _inferRequest;
+        Entry*                              _entry = nullptr;
+        PendingRequest                      _pending;
+        bool                                _padded = false;
+    };
+
+    struct Entry {
+        std::string                                             _key;
+        InferenceEngine::ICNNNetwork::InputShapes               _inputDims;
+        std::map<std::string, InferenceEngine::SizeVector>      _outputDims;
+        // nullptr while the network is compiled
+        InferenceEngine::ExecutableNetworkInternal::Ptr         _network;
+        std::vector<PendingRequest>                             _waitingRequests;
+        std::vector<std::unique_ptr<WorkerInferRequest>>        _workerRequests;
+        std::vector<WorkerInferRequest*>                        _idleWorkerRequests;
+        // infer requests dispatched to the entry, the entry is not destroyed until they are completed
+        size_t                                                  _busyRequests = 0;
+    };
+
+    /**
+     * @param network A network with the original shapes, it is reshaped for the shapes of infer requests inputs
+     * @param compile A function which compiles a network
+     * @param cacheSize A maximal number of compiled networks
+     * @param padding Whether infer requests may be executed by a network compiled for greater spatial dimensions
+     * @param compileExecutor An executor of the background compilation
+     */
+    MKLDNNShapesCacheExecNetwork(const InferenceEngine::ICNNNetwork&             network,
+                                 CompileFunction                                 compile,
+                                 size_t                                          cacheSize,
+                                 bool                                            padding,
+                                 bool                                            needPerfCounters,
+                                 const InferenceEngine::ITaskExecutor::Ptr&      compileExecutor);
+
+    ~MKLDNNShapesCacheExecNetwork() override;
+
+    InferenceEngine::InferRequestInternal::Ptr
+    CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                           InferenceEngine::OutputsDataMap networkOutputs) override;
+
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr& asyncRequest) override;
+
+    void GetConfig(const std::string& name, InferenceEngine::Parameter& result, InferenceEngine::ResponseDesc* resp) const override;
+
+    void GetMetric(const std::string& name, InferenceEngine::Parameter& result, InferenceEngine::ResponseDesc* resp) const override;
+
+    void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr& graphPtr) override;
+
+    void Dispatch(PendingRequest pendingRequest);
+
+private:
+    using LRUList = std::list<std::shared_ptr<Entry>>;
+
+    std::shared_ptr<Entry> CreateEntry(const std::string& key, const InferenceEngine::ICNNNetwork::InputShapes& shapes,
+                                       std::shared_ptr<InferenceEngine::ICNNNetwork>& reshapedNetwork);
+    std::shared_ptr<Entry> FindPaddedEntry(const Entry& entry) const;
+    WorkerInferRequest* Acquire(Entry& entry);
+    void Compile(const std::shared_ptr<Entry>& entry, const std::shared_ptr<InferenceEngine::ICNNNetwork>& reshapedNetwork);
+    void Run(const std::shared_ptr<Entry>& entry, WorkerInferRequest* workerRequest, PendingRequest pendingRequest,
+             const std::map<std::string, InferenceEngine::SizeVector>* outputDims);
+    void OnWorkerCompleted(WorkerInferRequest* workerRequest, InferenceEngine::StatusCode status);
+    void Evict();
+    void Fail(PendingRequest& pendingRequest, std::exception_ptr exception);
+
+    std::shared_ptr<InferenceEngine::ICNNNetwork>   _network;
+    CompileFunction                                 _compile;
+    const size_t                                    _cacheSize;
+    const bool                                      _padding;
+    const bool                                      _needPerfCounters;
+    InferenceEngine::ITaskExecutor::Ptr             _compileExecutor;
+
+    // a network compiled for the original shapes, used to get metrics and the execution graph
+    InferenceEngine::ExecutableNetworkInternal::Ptr _defaultNetwork;
+
+    std::mutex                                      _reshapeMutex;
+    mutable std::mutex                              _mutex;
+    // the most recently used entry is the first
+    LRUList                                         _lru;
+    std::unordered_map<std::string, LRUList::iterator> _entries;
+    // evicted entries which have infer requests in flight
+    std::vector<std::shared_ptr<Entry>>             _evicted;
+
+    std::atomic<uint64_t>                           _hits = {0};
+    std::atomic<uint64_t>                           _paddedHits = {0};
+    std::atomic<uint64_t>                           _misses = {0};
+    std::atomic<uint64_t>                           _compileTimeUs = {0};
+};
+
+class MKLDNNShapesCacheAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<MKLDNNShapesCacheAsyncInferRequest>;
+
+    MKLDNNShapesCacheAsyncInferRequest(const MKLDNNShapesCacheInferRequest::Ptr&      inferRequest,
+                                       const MKLDNNShapesCacheExecNetwork::Ptr&       shapesCacheExecNetwork,
+                                       const InferenceEngine::ITaskExecutor::Ptr&     callbackExecutor);
+
+    void Infer_ThreadUnsafe() override;
+
+    ~MKLDNNShapesCacheAsyncInferRequest() override;
+
+    MKLDNNShapesCacheInferRequest::Ptr      _inferRequest;
+    std::exception_ptr                      _exception;
+
+protected:
+    MKLDNNShapesCacheExecNetwork::Ptr       _shapesCacheExecNetwork;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,115 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_trace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+
+using namespace MKLDNNPlugin;
+
+constexpr int MKLDNNTraceBuffer::inferRecord;
+constexpr uint64_t MKLDNNTraceBuffer::busy;
+
+MKLDNNTraceBuffer::MKLDNNTraceBuffer(size_t capacity_) :
+    capacity(std::max<size_t>(capacity_, 1)), slots(new Slot[capacity]) {}
+
+void MKLDNNTraceBuffer::Push(const Record& record) {
+    auto index = writeIndex.fetch_add(1, std::memory_order_relaxed);
+    auto& slot = slots[index % capacity];
+    // a writer which is a whole ring behind still writes this slot, the record is dropped
+    if (slot.sequence.exchange(busy, std::memory_order_relaxed) == busy)
+        return;
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record = record;
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+std::vector<MKLDNNTraceBuffer::Record> MKLDNNTraceBuffer::Snapshot() const {
+    auto end = writeIndex.load(std::memory_order_acquire);
+    auto begin = end > capacity ? end - capacity : 0;
+    std::vector<Record> result;
+    result.reserve(end - begin);
+    for (auto index = begin; index < end; index++) {
+        auto& slot = slots[index % capacity];
+        if (slot.sequence.load(std::memory_order_acquire) != index + 1)
+            continue;
+        Record record = slot.record;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // the slot is reused by a newer record while it is copied
+        if (slot.sequence.load(std::memory_order_relaxed) != index + 1)
+            continue;
+        result.push_back(record);
+    }
+    return result;
+}
+
+namespace {
+
+void writeJsonString(std::ostream& out, const std::string& str) {
+    out << '"';
+    for (auto c : str) {
+        switch (c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out << buf;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+}  // namespace
+
+void MKLDNNPlugin::WriteChromeTrace(std::ostream& out, const std::vector<MKLDNNTraceEvent>& events) {
+    MKLDNNTraceBuffer::time_point origin = MKLDNNTraceBuffer::time_point::max();
+    for (auto&& event : events) {
+        origin = std::min(origin, event.start);
+    }
+    auto toUs = [](MKLDNNTraceBuffer::time_point::duration d) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count() / 1000.0;
+    };
+
+    std::map<std::thread::id, int> threadIds;
+    const auto flags = out.flags();
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (auto&& event : events) {
+        auto tid = threadIds.emplace(event.threadId, static_cast<int>(threadIds.size())).first->second;
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "{\"name\":";
+        writeJsonString(out, event.name);
+        out << ",\"cat\":";
+        writeJsonString(out, event.category);
+        out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid
+            << ",\"ts\":" << toUs(event.start - origin)
+            << ",\"dur\":" << toUs(event.finish - event.start);
+        if (!event.args.empty()) {
+            out << ",\"args\":{";
+            bool firstArg = true;
+            for (auto&& arg : event.args) {
+                if (!firstArg) out << ',';
+                firstArg = false;
+                writeJsonString(out, arg.first);
+                out << ':';
+                writeJsonString(out, arg.second);
+            }
+            out << '}';
+        }
+        out << '}';
+    }
+    out << "\n]}\n";
+    out.flags(flags);
+}
@@ -0,0 +1,92 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Fixed size ring buffer of node executions. Keeps the last `capacity` records of a graph,
+ * the older ones are overwritten. Filled by graph infer threads, read on a trace export.
+ * A writer takes a slot with an atomic increment of the write index and publishes the record with
+ * the slot sequence number, so node executions never wait for each other on a lock.
+ */
+class MKLDNNTraceBuffer {
+public:
+    using Ptr = std::shared_ptr<MKLDNNTraceBuffer>;
+    using time_point = std::chrono::high_resolution_clock::time_point;
+
+    // node index of a record which covers the whole graph inference
+    static constexpr int inferRecord = -1;
+
+    struct Record {
+        uint64_t        inferId;
+        int             execIndex;
+        time_point      start;
+        time_point      finish;
+        std::thread::id threadId;
+        int             batch;
+    };
+
+    explicit MKLDNNTraceBuffer(size_t capacity);
+
+    uint64_t NextInferId() {
+        return inferCounter++;
+    }
+
+    void Push(const Record& record);
+
+    // Returns the records from the oldest to the newest one, the records being written at the moment are skipped
+    std::vector<Record> Snapshot() const;
+
+private:
+    // sequence of a slot which record is being written
+    static constexpr uint64_t busy = std::numeric_limits<uint64_t>::max();
+
+    /* NOTE: A reader copies the record and validates the copy by the sequence number read before and after
+     *       the copy (a seqlock), so a record overwritten during the copy is skipped rather than exported torn.
+     */
+    struct Slot {
+        // 1 + index of the published record, 0 for an empty slot
+        std::atomic<uint64_t>   sequence = {0};
+        Record                  record;
+    };
+
+    const size_t                capacity;
+    std::unique_ptr<Slot[]>     slots;
+    std::atomic<uint64_t>       writeIndex = {0};
+    std::atomic<uint64_t>       inferCounter = {0};
+};
+
+/**
+ * @brief Complete ("ph":"X") event of the Chrome trace format.
+ * The trace can be opened in chrome://tracing or https://ui.perfetto.dev
+ */
+struct MKLDNNTraceEvent {
+    std::string                         name;
+    std::string                         category;
+    MKLDNNTraceBuffer::time_point       start;
+    MKLDNNTraceBuffer::time_point       finish;
+    std::thread::id                     threadId;
+    std::map<std::string, std::string>  args;
+};
+
+/**
+ * @brief Writes the events in the Chrome trace JSON format.
+ * Timestamps are written in microseconds relative to the earliest event, threads are numbered
+ * in the order of their first appearance.
+ */
+void WriteChromeTrace(std::ostream& out, const std::vector<MKLDNNTraceEvent>& events);
+
+}  // namespace MKLDNNPlugin
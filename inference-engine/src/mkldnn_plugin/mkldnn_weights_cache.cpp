@@ -4,13 +4,219 @@
 
 #include "mkldnn_weights_cache.hpp"
 
+#include <ie_parallel.hpp>
 #include <ie_system_conf.h>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <sstream>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+namespace {
+
+// XXH64 algorithm: https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+constexpr uint64_t prime1 = 11400714785074694791ULL;
+constexpr uint64_t prime2 = 14029467366897019727ULL;
+constexpr uint64_t prime3 = 1609587929392839161ULL;
+constexpr uint64_t prime4 = 9650029242287828579ULL;
+constexpr uint64_t prime5 = 2870177450012600261ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t xxhRound(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+    acc ^= xxhRound(0, val);
+    return acc * prime1 + prime4;
+}
+
+uint64_t xxh64(const unsigned char* data, size_t size, uint64_t seed) {
+    const unsigned char* p = data;
+    const unsigned char* const end = data + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        // four independent lanes are processed in parallel by the CPU pipeline
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+        const unsigned char* const limit = end - 32;
+        do {
+            v1 = xxhRound(v1, read64(p));
+            v2 = xxhRound(v2, read64(p + 8));
+            v3 = xxhRound(v3, read64(p + 16));
+            v4 = xxhRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + prime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= xxhRound(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= (*p) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+// Size of independently hashed parts of the data
+constexpr size_t hashChunkSize = 256 * 1024;
+
+void print(std::ostream& out, const InferenceEngine::SizeVector& values) {
+    for (auto value : values)
+        out << value << ',';
+    out << ';';
+}
+
+void describe(std::ostream& out, const InferenceEngine::TensorDesc& desc) {
+    const auto& blockingDesc = desc.getBlockingDesc();
+    out << '_' << desc.getPrecision().name() << '_' << desc.getLayout() << '_';
+    print(out, desc.getDims());
+    print(out, blockingDesc.getBlockDims());
+    print(out, blockingDesc.getOrder());
+    print(out, blockingDesc.getStrides());
+    print(out, blockingDesc.getOffsetPaddingToData());
+    out << blockingDesc.getOffsetPadding();
+}
+
+void describe(std::ostream& out, const MKLDNNMemoryDesc& desc) {
+    out << '_' << static_cast<int>(desc.getDataType()) << '_' << static_cast<int>(desc.getFormat()) << '_';
+    print(out, desc.getDims().ToSizeVector());
+    // layout of named formats is defined by the format itself
+    if (desc.getFormat() == mkldnn::memory::blocked) {
+        const mkldnn::memory::desc mkldnnDesc = desc;
+        const auto& blocking = mkldnnDesc.data.layout_desc.blocking;
+        for (int i = 0; i < mkldnnDesc.data.ndims; i++) {
+            out << blocking.block_dims[i] << ',' << blocking.strides[0][i] << ',' << blocking.strides[1][i] << ','
+                << blocking.padding_dims[i] << ',' << blocking.offset_padding_to_data[i] << ';';
+        }
+        out << blocking.offset_padding;
+    }
+}
+
+// Seed of the second hash of the weights content in cache keys
+constexpr uint64_t secondHashSeed = prime3;
+
+}  // namespace
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size, uint64_t seed) const {
+    if (size <= hashChunkSize)
+        return xxh64(data, size, seed);
+
+    const size_t chunksNum = (size + hashChunkSize - 1) / hashChunkSize;
+    std::vector<uint64_t> chunkHashes(chunksNum);
+    InferenceEngine::parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * hashChunkSize;
+        chunkHashes[i] = xxh64(data + offset, std::min(hashChunkSize, size - offset), seed);
+    });
+    return xxh64(reinterpret_cast<const unsigned char*>(chunkHashes.data()),
+                 chunkHashes.size() * sizeof(uint64_t), size ^ seed);
+}
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreate(const std::string& key,
+                                                   std::function<MKLDNNMemoryPtr(void)> create) {
+    auto findCached = [&] () -> MKLDNNMemoryPtr {
+        auto found = sharedWeights.find(key);
+        return found == sharedWeights.end() ? nullptr : found->second.memory.lock();
+    };
+
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        if (auto cached = findCached())
+            return cached;
+    }
+
+    // the memory is created out of the lock, since reorders of big weights are long
+    auto ptr = create();
+
+    std::unique_lock<std::mutex> lock(guard);
+    // another thread may have created the memory for the same key meanwhile
+    if (auto cached = findCached())
+        return cached;
+
+    sharedWeights[key] = {ptr, ptr->GetSize()};
+
+    // The store outlives networks, so entries of released memory are removed periodically
+    if (sharedWeights.size() >= 2 * sizeAfterCleanup) {
+        for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+            if (it->second.memory.expired())
+                it = sharedWeights.erase(it);
+            else
+                ++it;
+        }
+        sizeAfterCleanup = std::max<size_t>(sharedWeights.size(), 64);
+    }
+    return ptr;
+}
+
+std::string MKLDNNWeightsSharing::GetKey(const InferenceEngine::Blob::Ptr& weights,
+                                         const MKLDNNMemoryDesc& desc) {
+    const auto data = weights->cbuffer().as<const unsigned char*>();
+    std::ostringstream key;
+    key << GetHashFunc().hash(data, weights->byteSize()) << '_'
+        << GetHashFunc().hash(data, weights->byteSize(), secondHashSeed) << '_' << weights->byteSize();
+    describe(key, weights->getTensorDesc());
+    describe(key, desc);
+    return key.str();
+}
+
+uint64_t MKLDNNWeightsSharing::GetBytesSaved() const {
+    std::unique_lock<std::mutex> lock(guard);
+    uint64_t bytesSaved = 0;
+    for (auto&& shared : sharedWeights) {
+        auto users = shared.second.memory.use_count();
+        if (users > 1)
+            bytesSaved += static_cast<uint64_t>(users - 1) * shared.second.size;
+    }
+    return bytesSaved;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
@@ -30,4 +236,23 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+uint64_t NumaNodesWeights::GetBytesSaved() const {
+    uint64_t bytesSaved = 0;
+    for (auto&& cache : _cache_map)
+        bytesSaved += cache.second->GetBytesSaved();
+    return bytesSaved;
+}
+
+NumaNodesWeights::Ptr NumaNodesWeights::GetShared() {
+    static std::mutex mutex;
+    static std::weak_ptr<NumaNodesWeights> shared;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto result = shared.lock();
+    if (!result) {
+        result = std::make_shared<NumaNodesWeights>();
+        shared = result;
+    }
+    return result;
+}
+
 }  // namespace MKLDNNPlugin
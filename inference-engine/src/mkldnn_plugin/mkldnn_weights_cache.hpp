@@ -5,7 +5,9 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include <ie_blob.h>
 
+#include <cstdint>
 #include <unordered_map>
 #include <functional>
 #include <string>
@@ -13,64 +15,58 @@
 #include <mutex>
 #include <map>
 
-// TODO: While CPU plugin has no ease way to clone graph object we use weight
-//       caching in global Engine context to avoid tensor memory duplication.
-//       For same cases it may be switched of (like for single stream execution)
-//       When MKLDNNGraph clone function will be ready you may removed this
-//       classes at all.
+// Weights caching in the process wide context avoids tensor memory duplication
+// between graphs of different streams, identical layers and networks loaded
+// several times or sharing a part of weights (like fine-tuned variants of the same model).
 
 namespace MKLDNNPlugin {
 
+/**
+ * Hash of a weights content. XXH64 algorithm is applied to fixed size chunks of the data in parallel
+ * and then to the array of chunk hashes, so the result does not depend on the number of threads.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    uint64_t hash(const unsigned char* data, size_t size, uint64_t seed = 0) const;
 };
 
 /**
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
  *
+ * The objects are addressed by the content of the original weights and the descriptor of the memory,
+ * so identical weights of different layers and networks share the same memory.
+ *
  * Is a thread safe
  */
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
-    MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
-                             std::function<MKLDNNMemoryPtr(void)> create) {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(name_hash);
-
-        MKLDNNMemoryPtr ptr;
-        if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
-            ptr = create();
-            sharedWeights[name_hash] = ptr;
-        }
-        return ptr;
-    }
+
+    /**
+     * Returns the cached memory for the key, `create` is called only if there is no such memory.
+     * The content of the weights is not compared, the key has to be unique for it (see GetKey).
+     */
+    MKLDNNMemoryPtr findOrCreate(const std::string& key,
+                                 std::function<MKLDNNMemoryPtr(void)> create);
+
+    // Builds a key for the memory created from `weights` with the memory descriptor `desc`,
+    // the key contains two independently seeded 64-bit hashes of the weights content
+    static std::string GetKey(const InferenceEngine::Blob::Ptr& weights, const MKLDNNMemoryDesc& desc);
+
+    // Memory which would be allocated for every user of the shared objects in case of no sharing
+    uint64_t GetBytesSaved() const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
-    std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
-    std::mutex guard;
+    struct SharedMemory {
+        std::weak_ptr<MKLDNNMemory> memory;
+        size_t size;
+    };
+    std::unordered_map<std::string, SharedMemory> sharedWeights;
+    size_t sizeAfterCleanup = 64;
+    mutable std::mutex guard;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -81,11 +77,18 @@ protected:
  */
 class NumaNodesWeights {
 public:
+    using Ptr = std::shared_ptr<NumaNodesWeights>;
+
     NumaNodesWeights();
 
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    uint64_t GetBytesSaved() const;
+
+    // Returns the instance shared by all the plugin objects of the process
+    static Ptr GetShared();
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
 };
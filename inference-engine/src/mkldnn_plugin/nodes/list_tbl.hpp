@@ -72,18 +72,6 @@ MKLDNN_EXTENSION_NODE(GatherImpl, Gather);
 MKLDNN_EXTENSION_NODE(ProposalImpl, Proposal);
 MKLDNN_EXTENSION_NODE(RangeImpl, Range);
 MKLDNN_EXTENSION_NODE(SelectImpl, Select);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceAnd);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceL1);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceL2);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceLogSum);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceLogSumExp);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceMax);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceMean);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceMin);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceOr);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceProd);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceSum);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceSumSquare);
 MKLDNN_EXTENSION_NODE(GatherTreeImpl, GatherTree);
 MKLDNN_EXTENSION_NODE(PriorBoxClusteredImpl, PriorBoxClustered);
 MKLDNN_EXTENSION_NODE(SpaceToBatchImpl, SpaceToBatch);
@@ -5,6 +5,7 @@
 #include "mkldnn_depthwise_node.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <mkldnn_types.h>
@@ -49,15 +50,26 @@ void MKLDNNDepthwiseNode::getSupportedDescriptors() {
     if (wLayer == nullptr)
         THROW_IE_EXCEPTION << "Cannot get weightable layer for node " << getName() << ".";
 
+    // The internal blobs are copied to the memory shared by the weights cache (see MKLDNNNode::prepareMemory),
+    // so the broadcast value is expanded here rather than in the shared memory
+    auto expandBroadcast = [&](const InferenceEngine::Blob::Ptr& internalBlob, size_t realSize) {
+        if (!isBroadcast() || realSize == size)
+            return;
+        auto data = internalBlob->buffer().as<float*>();
+        std::fill(data + 1, data + size, data[0]);
+    };
+
     InferenceEngine::Blob::Ptr blb = wLayer->_weights;
     if (blb)
         realWeightSize = blb->size();
     internalBlobs.push_back(createInternalBlob(weightDims, true));
+    expandBroadcast(internalBlobs.back(), realWeightSize);
     if (isWithBiases()) {
         InferenceEngine::Blob::Ptr blb = wLayer->_biases;
         if (blb)
             realBiasSize = blb->size();
         internalBlobs.push_back(createInternalBlob(weightDims, false));
+        expandBroadcast(internalBlobs.back(), realBiasSize);
     }
 
     for (auto format : getAvailableFormatsForDims(parentOutDims)) {
@@ -81,21 +93,8 @@ void MKLDNNDepthwiseNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<depthwise_forward::primitive_desc, depthwise_forward::desc>();
 
-    if (isBroadcast()) {
-        float broadcastValue = static_cast<float*>(internalBlobMemory[0]->GetData())[0];
-        size_t blbSize = internalBlobMemory[0]->GetPrimitiveDescriptor().desc().data.dims[0];
-        for (int i = 1; i < blbSize && realWeightSize != blbSize; i++) {
-            static_cast<float*>(internalBlobMemory[0]->GetData())[i] = broadcastValue;
-        }
-
-        if (isWithBiases()) {
-            blbSize = internalBlobMemory[1]->GetPrimitiveDescriptor().desc().data.dims[0];
-            broadcastValue = static_cast<float*>(internalBlobMemory[1]->GetData())[0];
-            for (int i = 1; i < blbSize && realBiasSize != blbSize; i++) {
-                static_cast<float*>(internalBlobMemory[1]->GetData())[i] = broadcastValue;
-            }
-        }
-    } else {
+    // the memory is shared by the weights cache, the broadcast values are expanded in getSupportedDescriptors
+    if (!isBroadcast()) {
         size_t blbSize = internalBlobMemory[0]->GetPrimitiveDescriptor().desc().data.dims[0];
         if (realWeightSize != blbSize)
             THROW_IE_EXCEPTION << "Cannot create layer " << getName() << ": Incorrect weights!";
@@ -0,0 +1,1463 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_quantize_node.h"
+#include "mkldnn_depthwise_node.h"
+#include "mkldnn_activation_node.h"
+#include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
+#include "jit_uni_eltwise.hpp"
+#include "jit_uni_depthwise.hpp"
+#include "jit_uni_quantization.hpp"
+
+#include "mkldnn_reduce_node.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_reduce_call_args, field)
+#define GET_OFF_POST(field) offsetof(jit_reduce_post_call_args, field)
+
+namespace {
+
+constexpr size_t REDUCE_DATA = 0;
+constexpr size_t REDUCE_INDEXES = 1;
+
+// Column blocks and row chunks processed by a thread are multiples of the widest vector
+constexpr size_t minColumnBlock = 16;
+// Reductions of less elements are not split between threads as the merge of partial results costs more
+constexpr size_t minSplitWork = 32 * 1024;
+
+template <typename T>
+T reduce_init_value(ReduceMode mode) {
+    switch (mode) {
+        case ReduceMode::And:
+        case ReduceMode::Prod:
+            return static_cast<T>(1);
+        case ReduceMode::Max:
+            return std::numeric_limits<T>::lowest();
+        case ReduceMode::Min:
+            return (std::numeric_limits<T>::max)();
+        default:
+            return static_cast<T>(0);
+    }
+}
+
+// Combines two partial results of the same output element
+template <typename T>
+T reduce_combine(ReduceMode mode, T x, T y) {
+    switch (mode) {
+        case ReduceMode::And:
+            return static_cast<T>(x && y);
+        case ReduceMode::Or:
+            return static_cast<T>(x || y);
+        case ReduceMode::Max:
+            return x > y ? x : y;
+        case ReduceMode::Min:
+            return x < y ? x : y;
+        case ReduceMode::Prod:
+            return x * y;
+        default:
+            return x + y;
+    }
+}
+
+}  // namespace
+
+// dst = combine(dst, prepare(src)) over the rows, all modes accumulate in f32
+template <cpu_isa_t isa>
+struct jit_uni_reduce_kernel_f32 : public jit_uni_reduce_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduce_kernel_f32)
+
+    explicit jit_uni_reduce_kernel_f32(jit_reduce_config_params jcp) : jit_uni_reduce_kernel(jcp), jit_generator() {
+        if (jcp_.reduce_mode == ReduceMode::LogSumExp)
+            exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, alg_kind::eltwise_exp, 0.f, 0.f));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_rows, ptr[reg_params + GET_OFF(rows)]);
+        mov(reg_src_row_stride, ptr[reg_params + GET_OFF(src_row_stride)]);
+        mov(reg_table, l_table);
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+        if (jcp_.reduce_mode == ReduceMode::L1) {
+            uni_vmovups(vmm_aux_const, table_val(0));
+        } else if (jcp_.reduce_mode == ReduceMode::And || jcp_.reduce_mode == ReduceMode::Or) {
+            uni_vmovups(vmm_aux_const, table_val(1));
+        }
+
+        Xbyak::Label vertical_label;
+        Xbyak::Label exit_label;
+
+        mov(reg_tmp_64, ptr[reg_params + GET_OFF(horizontal)]);
+        cmp(reg_tmp_64, 0);
+        je(vertical_label, T_NEAR);
+        reduce_horizontal();
+        jmp(exit_label, T_NEAR);
+
+        L(vertical_label);
+        reduce_vertical();
+
+        L(exit_label);
+
+        this->postamble();
+
+        if (exp_injector)
+            exp_injector->prepare_table();
+
+        prepare_table();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr int unroll = 4;
+
+    Xbyak::Address table_val(int index) { return ptr[reg_table + index * vlen]; }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_rows = r11;
+    Xbyak::Reg64 reg_src_row_stride = r12;
+    Xbyak::Reg64 reg_src_row = r13;
+    Xbyak::Reg64 reg_rows_left = r14;
+    Xbyak::Reg64 reg_ptr = r15;
+    Xbyak::Reg64 reg_n = rbx;
+    Xbyak::Reg64 reg_table = rbp;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // rax is the table pointer of the exp injector
+    Reg32 reg_tmp_32 = edx;
+    Reg64 reg_tmp_64 = rdx;
+
+    Vmm vmm_zero = Vmm(0);
+    Vmm vmm_aux_const = Vmm(1);
+    // Vmm(2) .. Vmm(2 + unroll) are accumulators, Vmm(6) .. Vmm(6 + unroll) are source values
+    const int acc_idx = 2;
+    const int src_idx = 6;
+    Vmm vmm_acc_scalar = Vmm(10);
+    Xbyak::Xmm xmm_acc_scalar = Xbyak::Xmm(10);
+    Xbyak::Xmm xmm_aux1 = Xbyak::Xmm(11);
+    Xbyak::Xmm xmm_aux2 = Xbyak::Xmm(12);
+    Xbyak::Xmm xmm_aux3 = Xbyak::Xmm(13);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    Xbyak::Label l_table;
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+
+    Vmm vmm_acc(int i) { return Vmm(acc_idx + i); }
+    Vmm vmm_src(int i) { return Vmm(src_idx + i); }
+
+    inline void reduce_horizontal() {
+        Xbyak::Label row_loop_label;
+        Xbyak::Label row_loop_end_label;
+        Xbyak::Label unroll_loop_label;
+        Xbyak::Label vector_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label row_end_label;
+
+        for (int i = 0; i < unroll; i++)
+            uni_vmovups(vmm_acc(i), table_val(2));
+        uni_vmovups(vmm_acc_scalar, table_val(2));
+
+        mov(reg_src_row, reg_src);
+        mov(reg_rows_left, reg_rows);
+        L(row_loop_label);
+        {
+            cmp(reg_rows_left, 0);
+            jle(row_loop_end_label, T_NEAR);
+
+            mov(reg_ptr, reg_src_row);
+            mov(reg_n, reg_work_amount);
+
+            // independent accumulators hide the latency of the combine operation
+            L(unroll_loop_label);
+            {
+                cmp(reg_n, unroll * simd_w);
+                jl(vector_loop_label, T_NEAR);
+
+                for (int i = 0; i < unroll; i++)
+                    load_vector(vmm_src(i), ptr[reg_ptr + i * simd_w * jcp_.src_data_size], jcp_.src_dt);
+                prepare(src_idx, src_idx + unroll);
+                for (int i = 0; i < unroll; i++)
+                    combine(vmm_acc(i), vmm_src(i));
+
+                add(reg_ptr, unroll * simd_w * jcp_.src_data_size);
+                sub(reg_n, unroll * simd_w);
+                jmp(unroll_loop_label, T_NEAR);
+            }
+
+            L(vector_loop_label);
+            {
+                cmp(reg_n, simd_w);
+                jl(tail_loop_label, T_NEAR);
+
+                load_vector(vmm_src(0), ptr[reg_ptr], jcp_.src_dt);
+                prepare(src_idx, src_idx + 1);
+                combine(vmm_acc(0), vmm_src(0));
+
+                add(reg_ptr, simd_w * jcp_.src_data_size);
+                sub(reg_n, simd_w);
+                jmp(vector_loop_label, T_NEAR);
+            }
+
+            // scalars are accumulated in the first lane of a separate register
+            L(tail_loop_label);
+            {
+                cmp(reg_n, 1);
+                jl(row_end_label, T_NEAR);
+
+                load_scalar(Xbyak::Xmm(src_idx), ptr[reg_ptr], jcp_.src_dt);
+                prepare(src_idx, src_idx + 1);
+                combine(vmm_acc_scalar, vmm_src(0));
+
+                add(reg_ptr, jcp_.src_data_size);
+                sub(reg_n, 1);
+                jmp(tail_loop_label, T_NEAR);
+            }
+
+            L(row_end_label);
+            add(reg_src_row, reg_src_row_stride);
+            sub(reg_rows_left, 1);
+            jmp(row_loop_label, T_NEAR);
+        }
+        L(row_loop_end_label);
+
+        combine(vmm_acc(0), vmm_acc(1));
+        combine(vmm_acc(2), vmm_acc(3));
+        combine(vmm_acc(0), vmm_acc(2));
+
+        Xbyak::Xmm xmm_acc = Xbyak::Xmm(acc_idx);
+        if (isa == cpu::avx512_common) {
+            Xbyak::Zmm zmm_acc = Xbyak::Zmm(acc_idx);
+            vextractf32x4(xmm_aux1, zmm_acc, 1);
+            vextractf32x4(xmm_aux2, zmm_acc, 2);
+            vextractf32x4(xmm_aux3, zmm_acc, 3);
+            combine(xmm_acc, xmm_aux1);
+            combine(xmm_aux2, xmm_aux3);
+            combine(xmm_acc, xmm_aux2);
+        } else if (isa == cpu::avx2) {
+            Xbyak::Ymm ymm_acc = Xbyak::Ymm(acc_idx);
+            vextractf128(xmm_aux1, ymm_acc, 1);
+            combine(xmm_acc, xmm_aux1);
+        }
+        movshdup(xmm_aux1, xmm_acc);  //  acc:1,2,3,4; aux1:2,2,4,4
+        combine(xmm_acc, xmm_aux1);   //  acc:1+2,2+2,3+4,4+4
+        movhlps(xmm_aux1, xmm_acc);   //  aux1:3+4,4+4,4,4
+        combine(xmm_acc, xmm_aux1);   //  acc:1+2+3+4,...
+        combine(xmm_acc, xmm_acc_scalar);
+
+        movss(xmm_aux1, ptr[reg_dst]);
+        combine(xmm_acc, xmm_aux1);
+        movss(ptr[reg_dst], xmm_acc);
+    }
+
+    inline void reduce_vertical() {
+        Xbyak::Label unroll_loop_label;
+        Xbyak::Label unroll_loop_end_label;
+        Xbyak::Label vector_loop_label;
+        Xbyak::Label vector_loop_end_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label tail_loop_end_label;
+
+        // several columns are accumulated at once to hide the latency of the combine operation
+        L(unroll_loop_label);
+        {
+            cmp(reg_work_amount, unroll * simd_w);
+            jl(unroll_loop_end_label, T_NEAR);
+
+            for (int i = 0; i < unroll; i++)
+                uni_vmovups(vmm_acc(i), ptr[reg_dst + i * vlen]);
+
+            reduce_rows([&]() {
+                for (int i = 0; i < unroll; i++)
+                    load_vector(vmm_src(i), ptr[reg_src_row + i * simd_w * jcp_.src_data_size], jcp_.src_dt);
+                prepare(src_idx, src_idx + unroll);
+                for (int i = 0; i < unroll; i++)
+                    combine(vmm_acc(i), vmm_src(i));
+            });
+
+            for (int i = 0; i < unroll; i++)
+                uni_vmovups(ptr[reg_dst + i * vlen], vmm_acc(i));
+
+            add(reg_src, unroll * simd_w * jcp_.src_data_size);
+            add(reg_dst, unroll * vlen);
+            sub(reg_work_amount, unroll * simd_w);
+            jmp(unroll_loop_label, T_NEAR);
+        }
+        L(unroll_loop_end_label);
+
+        L(vector_loop_label);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(vector_loop_end_label, T_NEAR);
+
+            Xbyak::Label rows_loop_label;
+            Xbyak::Label rows_tail_label;
+            Xbyak::Label rows_end_label;
+
+            // a single column is accumulated by two registers in turn
+            uni_vmovups(vmm_acc(0), ptr[reg_dst]);
+            uni_vmovups(vmm_acc(1), table_val(2));
+            mov(reg_src_row, reg_src);
+            mov(reg_rows_left, reg_rows);
+            L(rows_loop_label);
+            {
+                cmp(reg_rows_left, 2);
+                jl(rows_tail_label, T_NEAR);
+
+                load_vector(vmm_src(0), ptr[reg_src_row], jcp_.src_dt);
+                load_vector(vmm_src(1), ptr[reg_src_row + reg_src_row_stride], jcp_.src_dt);
+                prepare(src_idx, src_idx + 2);
+                combine(vmm_acc(0), vmm_src(0));
+                combine(vmm_acc(1), vmm_src(1));
+
+                lea(reg_src_row, ptr[reg_src_row + reg_src_row_stride * 2]);
+                sub(reg_rows_left, 2);
+                jmp(rows_loop_label, T_NEAR);
+            }
+            L(rows_tail_label);
+            {
+                cmp(reg_rows_left, 1);
+                jl(rows_end_label, T_NEAR);
+
+                load_vector(vmm_src(0), ptr[reg_src_row], jcp_.src_dt);
+                prepare(src_idx, src_idx + 1);
+                combine(vmm_acc(0), vmm_src(0));
+            }
+            L(rows_end_label);
+
+            combine(vmm_acc(0), vmm_acc(1));
+            uni_vmovups(ptr[reg_dst], vmm_acc(0));
+
+            add(reg_src, simd_w * jcp_.src_data_size);
+            add(reg_dst, vlen);
+            sub(reg_work_amount, simd_w);
+            jmp(vector_loop_label, T_NEAR);
+        }
+        L(vector_loop_end_label);
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(tail_loop_end_label, T_NEAR);
+
+            movss(Xbyak::Xmm(acc_idx), ptr[reg_dst]);
+            reduce_rows([&]() {
+                load_scalar(Xbyak::Xmm(src_idx), ptr[reg_src_row], jcp_.src_dt);
+                prepare(src_idx, src_idx + 1);
+                combine(vmm_acc(0), vmm_src(0));
+            });
+            movss(ptr[reg_dst], Xbyak::Xmm(acc_idx));
+
+            add(reg_src, jcp_.src_data_size);
+            add(reg_dst, sizeof(float));
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(tail_loop_end_label);
+    }
+
+    template <typename F>
+    inline void reduce_rows(F body) {
+        Xbyak::Label rows_loop_label;
+        Xbyak::Label rows_loop_end_label;
+
+        mov(reg_src_row, reg_src);
+        mov(reg_rows_left, reg_rows);
+        L(rows_loop_label);
+        {
+            cmp(reg_rows_left, 0);
+            jle(rows_loop_end_label, T_NEAR);
+
+            body();
+
+            add(reg_src_row, reg_src_row_stride);
+            sub(reg_rows_left, 1);
+            jmp(rows_loop_label, T_NEAR);
+        }
+        L(rows_loop_end_label);
+    }
+
+    // element-wise part of the reduction applied to the source values
+    inline void prepare(int start_idx, int end_idx) {
+        switch (jcp_.reduce_mode) {
+            case ReduceMode::L1:
+                for (int i = start_idx; i < end_idx; i++)
+                    uni_vandps(Vmm(i), Vmm(i), vmm_aux_const);
+                break;
+            case ReduceMode::L2:
+            case ReduceMode::SumSquare:
+                for (int i = start_idx; i < end_idx; i++)
+                    uni_vmulps(Vmm(i), Vmm(i), Vmm(i));
+                break;
+            case ReduceMode::LogSumExp:
+                exp_injector->compute_vector_range(start_idx, end_idx);
+                break;
+            case ReduceMode::And:
+            case ReduceMode::Or:
+                for (int i = start_idx; i < end_idx; i++)
+                    to_boolean(Vmm(i));
+                break;
+            default:
+                break;
+        }
+    }
+
+    // boolean values are represented by 0.f and 1.f, so And and Or are Min and Max of them
+    template <typename T>
+    inline void combine(const T &vmm_dst, const T &vmm_src) {
+        switch (jcp_.reduce_mode) {
+            case ReduceMode::Max:
+            case ReduceMode::Or:
+                uni_vmaxps(vmm_dst, vmm_dst, vmm_src);
+                break;
+            case ReduceMode::Min:
+            case ReduceMode::And:
+                uni_vminps(vmm_dst, vmm_dst, vmm_src);
+                break;
+            case ReduceMode::Prod:
+                uni_vmulps(vmm_dst, vmm_dst, vmm_src);
+                break;
+            default:
+                uni_vaddps(vmm_dst, vmm_dst, vmm_src);
+                break;
+        }
+    }
+
+    inline void to_boolean(Vmm vmm) {
+        if (isa == cpu::avx512_common) {
+            vcmpps(k_mask, vmm, vmm_zero, _cmp_neq_uq);
+            vblendmps(vmm | k_mask, vmm_zero, vmm_aux_const);
+        } else if (isa == cpu::avx2) {
+            vcmpps(vmm, vmm, vmm_zero, _cmp_neq_uq);
+            uni_vandps(vmm, vmm, vmm_aux_const);
+        } else {
+            cmpps(vmm, vmm_zero, _cmp_neq_uq);
+            uni_vandps(vmm, vmm, vmm_aux_const);
+        }
+    }
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
+        switch (src_dt) {
+            case memory::f32:
+            case memory::s32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case memory::s8:
+                uni_vpmovsxbd(vmm_src, op);
+                break;
+            case memory::u8:
+                uni_vpmovzxbd(vmm_src, op);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+
+        if (src_dt != memory::f32)
+            uni_vcvtdq2ps(vmm_src, vmm_src);
+    }
+
+    inline void load_scalar(Xmm xmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
+        switch (src_dt) {
+            case memory::f32:
+            case memory::s32:
+                movss(xmm_src, op);
+                break;
+            case memory::s8:
+                movsx(reg_tmp_32, op);
+                movq(xmm_src, reg_tmp_64);
+                break;
+            case memory::u8:
+                movzx(reg_tmp_32, op);
+                movq(xmm_src, reg_tmp_64);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+
+        if (src_dt != data_type::f32) {
+            uni_vcvtdq2ps(xmm_src, xmm_src);
+        }
+    }
+
+    void prepare_table() {
+        auto broadcast_int = [&](int val) {
+            for (size_t d = 0; d < vlen / sizeof(float); ++d) {
+                dd(val);
+            }
+        };
+
+        float init_value = reduce_init_value<float>(jcp_.reduce_mode);
+        int init_value_int;
+        std::memcpy(&init_value_int, &init_value, sizeof(init_value_int));
+
+        align(64);
+        L(l_table);
+
+        broadcast_int(0x7fffffff);  // 0 // mask to clear the sign
+        broadcast_int(0x3f800000);  // 1 // 1.0f
+        broadcast_int(init_value_int);  // 2 // initial value of the accumulators
+    }
+};
+
+// dst = post_ops(src), src is the f32 result of the reduction with contiguous channels
+template <cpu_isa_t isa>
+struct jit_uni_reduce_post_kernel_f32 : public jit_uni_reduce_post_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduce_post_kernel_f32)
+
+    explicit jit_uni_reduce_post_kernel_f32(jit_reduce_post_config_params jcp, const mkldnn_primitive_attr &attr)
+    : jit_uni_reduce_post_kernel(jcp, attr), jit_generator() {
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len_; i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                        this, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                        this, post_op.depthwise.alg));
+            } else if (post_op.is_quantization()) {
+                quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                        this, post_op, vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+            }
+        }
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF_POST(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF_POST(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF_POST(work_amount)]);
+        mov(reg_oc_off, ptr[reg_params + GET_OFF_POST(oc_off)]);
+        if (isa == avx512_common)
+            uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label tail_loop_end_label;
+
+        int step = vlen / sizeof(float);
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(main_loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            apply_post_ops(jcp_.dst_dt, false);
+            store_vector(ptr[reg_dst], vmm_val, jcp_.dst_dt);
+
+            add(reg_src, vlen);
+            add(reg_dst, step * jcp_.dst_data_size);
+            add(reg_oc_off, vlen);  // out channel offset of fused ops weights in byte
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(tail_loop_end_label, T_NEAR);
+
+            movss(xmm_val, ptr[reg_src]);
+            apply_post_ops(jcp_.dst_dt, true);
+            store_scalar(ptr[reg_dst], xmm_val, jcp_.dst_dt);
+
+            add(reg_src, sizeof(float));
+            add(reg_dst, jcp_.dst_data_size);
+            add(reg_oc_off, sizeof(float));
+            sub(reg_work_amount, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(tail_loop_end_label);
+
+        this->postamble();
+
+        for (auto& inj : eltwise_injectors)
+            inj->prepare_table();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_oc_off = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Reg8 reg_tmp_8 = r14b;
+    Reg32 reg_tmp_32 = r14d;
+    Reg64 reg_tmp_64 = r14;
+
+    Xbyak::Reg64 reg_d_weights = rbx;
+    Xbyak::Reg64 reg_d_bias = rdx;
+
+    Vmm vmm_val = Vmm(0);
+    Xmm xmm_val = Xmm(0);
+
+    Vmm vmm_d_weights = Vmm(5);
+    Vmm vmm_d_bias = Vmm(6);
+    Vmm vmm_zero = Vmm(7);
+
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
+
+    inline void store_vector(const Xbyak::Address &op, Vmm vmm_dst, memory::data_type dst_dt) {
+        Ymm ymm_dst = Ymm(vmm_dst.getIdx());
+        Xmm xmm_dst = Xmm(vmm_dst.getIdx());
+
+        if (dst_dt == memory::f32) {
+            uni_vmovups(op, vmm_dst);
+        } else if (dst_dt == memory::s32) {
+            uni_vcvtps2dq(vmm_dst, vmm_dst);
+            uni_vmovups(op, vmm_dst);
+        } else if (dst_dt == memory::u8) {
+            uni_vcvtps2dq(vmm_dst, vmm_dst);
+            if (isa == cpu::avx512_common) {
+                vpmaxsd(vmm_dst, vmm_dst, vmm_zero);
+                vpmovusdb(op, vmm_dst);
+            } else {
+                uni_vpackusdw(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vpermq(ymm_dst, ymm_dst, 0x08);
+                uni_vpackuswb(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vmovq(op, xmm_dst);
+                else
+                    movd(op, xmm_dst);
+            }
+        } else if (dst_dt == memory::s8) {
+            uni_vcvtps2dq(vmm_dst, vmm_dst);
+            if (isa == cpu::avx512_common) {
+                vpmovsdb(op, vmm_dst);
+            } else {
+                uni_vpackssdw(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vpermq(ymm_dst, ymm_dst, 0x08);
+                uni_vpacksswb(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vmovq(op, xmm_dst);
+                else
+                    movd(op, xmm_dst);
+            }
+        }
+    }
+
+    inline void store_scalar(const Xbyak::Address &op, Xmm xmm_dst, memory::data_type dst_dt) {
+        if (dst_dt != data_type::f32) {
+            uni_vcvtps2dq(xmm_dst, xmm_dst);
+        }
+
+        switch (dst_dt) {
+            case memory::f32:
+            case memory::s32:
+                movss(op, xmm_dst);
+                break;
+            case memory::s8:
+                uni_vpackssdw(xmm_dst, xmm_dst, xmm_dst);
+                uni_vpacksswb(xmm_dst, xmm_dst, xmm_dst);
+                movq(reg_tmp_64, xmm_dst);
+                mov(op, reg_tmp_8);
+                break;
+            case memory::u8:
+                uni_vpackusdw(xmm_dst, xmm_dst, xmm_dst);
+                uni_vpackuswb(xmm_dst, xmm_dst, xmm_dst);
+                movq(reg_tmp_64, xmm_dst);
+                mov(op, reg_tmp_8);
+                break;
+            default:
+                assert(!"unknown dst_dt");
+        }
+    }
+
+    // the tail is processed by scalars, so per channel parameters are broadcasted for it
+    void apply_post_ops(memory::data_type dst_dt, bool is_broadcast) {
+        const auto &p = attr_.post_ops_;
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        int quantization_inj_idx = 0;
+        for (int i = 0; i < p.len_; i++) {
+            auto& post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                eltwise_inj_idx++;
+            } else if (post_op.is_depthwise()) {
+                mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data));
+                mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data));
+                add(reg_d_weights, reg_oc_off);
+                add(reg_d_bias, reg_oc_off);
+                depthwise_injectors[depthwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1, reg_d_weights, reg_d_bias, is_broadcast);
+                depthwise_inj_idx++;
+            } else if (post_op.is_quantization()) {
+                bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+                bool do_rounding = do_dequantization || dst_dt == memory::f32 || i != p.len_ - 1;
+
+                int s_idx = vmm_val.getIdx();
+
+                quantization_injectors[quantization_inj_idx]->init_crop_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_crop(s_idx, s_idx + 1, 0, 0, is_broadcast);
+
+                quantization_injectors[quantization_inj_idx]->init_input_scale_shift_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_input_scale_shift(s_idx, s_idx + 1, 0, do_rounding, 0, is_broadcast);
+
+                if (do_dequantization) {
+                    quantization_injectors[quantization_inj_idx]->init_output_scale_shift_ptrs(reg_oc_off);
+                    quantization_injectors[quantization_inj_idx]->compute_output_scale_shift(s_idx, s_idx + 1, 0, 0, is_broadcast);
+                }
+
+                quantization_inj_idx++;
+            }
+        }
+    }
+};
+
+MKLDNNReduceNode::MKLDNNReduceNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {}
+
+void MKLDNNReduceNode::init() {
+    auto *layer = getCnnLayer().get();
+    if (layer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get Reduce layer.";
+
+    static const std::map<std::string, ReduceMode> reduceModes = {
+        {"ReduceAnd", ReduceMode::And},
+        {"ReduceL1", ReduceMode::L1},
+        {"ReduceL2", ReduceMode::L2},
+        {"ReduceLogSum", ReduceMode::LogSum},
+        {"ReduceLogSumExp", ReduceMode::LogSumExp},
+        {"ReduceMax", ReduceMode::Max},
+        {"ReduceMean", ReduceMode::Mean},
+        {"ReduceMin", ReduceMode::Min},
+        {"ReduceOr", ReduceMode::Or},
+        {"ReduceProd", ReduceMode::Prod},
+        {"ReduceSum", ReduceMode::Sum},
+        {"ReduceSumSquare", ReduceMode::SumSquare}
+    };
+    auto mode = reduceModes.find(layer->type);
+    if (mode == reduceModes.end())
+        THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' has unsupported type " << layer->type;
+    reduceMode = mode->second;
+    keep_dims = layer->GetParamAsBool("keep_dims", true);
+
+    if (getParentEdges().size() != 2)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+
+    // constant axes allow to choose the layouts and to fuse the following operations in advance
+    auto axesNode = getParentEdgesAtPort(REDUCE_INDEXES)[0]->getParent();
+    if (axesNode->getType() == Input && axesNode->getCnnLayer()->type == "Const") {
+        auto axesBlob = axesNode->getCnnLayer()->blobs.find("custom");
+        if (axesBlob != axesNode->getCnnLayer()->blobs.end() && axesBlob->second) {
+            const auto &desc = axesBlob->second->getTensorDesc();
+            if (desc.getPrecision() == Precision::I32) {
+                auto axes = axesBlob->second->cbuffer().as<const int32_t *>() + desc.getBlockingDesc().getOffsetPadding();
+                rawAxes.assign(axes, axes + axesBlob->second->size());
+                constAxes = true;
+            } else if (desc.getPrecision() == Precision::I64) {
+                auto axes = axesBlob->second->cbuffer().as<const int64_t *>() + desc.getBlockingDesc().getOffsetPadding();
+                for (size_t i = 0; i < axesBlob->second->size(); i++)
+                    rawAxes.push_back(static_cast<int>(axes[i]));
+                constAxes = true;
+            }
+        }
+    }
+}
+
+void MKLDNNReduceNode::getSupportedDescriptors() {
+    if (!descs.empty())
+        return;
+
+    if (getParentEdges().size() != 2)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    if (getParentEdgesAtPort(REDUCE_INDEXES)[0]->getDims().ndims() > 1)
+        THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect index vector dimension! Index vector should be 1 dimension.";
+
+    auto srcRank = getParentEdgesAtPort(REDUCE_DATA)[0]->getDims().ndims();
+    auto dstRank = getChildEdgeAt(0)->getDims().ndims();
+    if (keep_dims) {
+        if (srcRank != dstRank)
+            THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect number of input/output dimensions!";
+    } else {
+        if (srcRank <= dstRank)
+            THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect number of input/output dimensions!";
+    }
+}
+
+void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    setPostOps(attr, true);
+
+    Precision inputPrecision = getCnnLayer()->insData[REDUCE_DATA].lock()->getPrecision();
+    inputPrecision = inputPrecision == Precision::BF16 ? Precision(Precision::FP32) : inputPrecision;
+    Precision outputPrecision = getCnnLayer()->outData[0]->getPrecision();
+    outputPrecision = outputPrecision == Precision::BF16 ? Precision(Precision::FP32) : outputPrecision;
+
+    if (!fusedWith.empty()) {
+        auto lastFusedLayer = fusedWith[fusedWith.size() - 1].get()->getCnnLayer();
+        if (lastFusedLayer) {
+            outputPrecision = lastFusedLayer->outData[0]->getPrecision();
+        }
+    }
+
+    auto isOneOf = [&](InferenceEngine::Precision precision, std::vector<InferenceEngine::Precision> precisions) {
+        for (auto p : precisions) {
+            if (precision == p) {
+                return true;
+            }
+        }
+        return false;
+    };
+    if (!isOneOf(inputPrecision, {Precision::FP32, Precision::I32, Precision::I8, Precision::U8})) {
+        THROW_IE_EXCEPTION << "Unsupported input precision. " << getName();
+    }
+    if (!isOneOf(outputPrecision, {Precision::FP32, Precision::I32, Precision::I8, Precision::U8})) {
+        THROW_IE_EXCEPTION << "Unsupported output precision. " << getName();
+    }
+
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    config.inConfs.resize(2);
+    config.outConfs.resize(1);
+    config.inConfs[REDUCE_DATA].constant = false;
+    config.inConfs[REDUCE_INDEXES].constant = false;
+    config.outConfs[0].constant = false;
+    config.inConfs[REDUCE_DATA].inPlace = -1;
+    config.inConfs[REDUCE_INDEXES].inPlace = -1;
+    config.outConfs[0].inPlace = -1;
+
+    auto &srcDims = getParentEdgesAtPort(REDUCE_DATA)[0]->getDims();
+    auto &axesDims = getParentEdgesAtPort(REDUCE_INDEXES)[0]->getDims();
+    auto &dstDims = getChildEdgeAt(0)->getDims();
+
+    auto pushDesc = [&](memory::format inFormat, memory::format outFormat) {
+        config.inConfs[REDUCE_DATA].desc = MKLDNNMemoryDesc(srcDims, inputDataType, inFormat);
+        config.inConfs[REDUCE_INDEXES].desc = MKLDNNMemoryDesc(axesDims, memory::s32, memory::x);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(dstDims, outputDataType, outFormat);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, outFormat});
+    };
+
+    // blocked layouts are reduced as is, so no reorders are needed after convolutions
+    if (canFuseSimpleOperation()) {
+        if (srcDims.ndims() == 4) {
+            pushDesc(memory::nhwc, memory::nhwc);
+            if (mayiuse(cpu::avx512_common)) {
+                pushDesc(memory::nChw16c, memory::nChw16c);
+            } else {
+                pushDesc(memory::nChw8c, memory::nChw8c);
+            }
+        } else {
+            pushDesc(memory::ndhwc, memory::ndhwc);
+            if (mayiuse(cpu::avx512_common)) {
+                pushDesc(memory::nCdhw16c, memory::nCdhw16c);
+            } else {
+                pushDesc(memory::nCdhw8c, memory::nCdhw8c);
+            }
+        }
+    }
+
+    // fused operations are applied to contiguous channels only
+    if (fusedWith.empty()) {
+        pushDesc(MKLDNNMemory::GetPlainFormat(srcDims), MKLDNNMemory::GetPlainFormat(dstDims));
+    }
+}
+
+bool MKLDNNReduceNode::canFuseSimpleOperation() const {
+    if (!constAxes || !keep_dims || !mayiuse(cpu::sse42))
+        return false;
+
+    const int rank = getParentEdgesAtPort(REDUCE_DATA)[0]->getDims().ndims();
+    if (rank != 4 && rank != 5)
+        return false;
+
+    for (int axis : rawAxes) {
+        if (axis < 0)
+            axis += rank;
+        if (axis < 0 || axis >= rank || axis == 1)
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNReduceNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights) {
+    int blob_idx = 0;
+    mkldnn::post_ops ops;
+
+    for (auto &node : fusedWith) {
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(node.get());
+        if (quantizeNode) {
+            quantizeNode->appendPostOps(ops);
+            continue;
+        }
+
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode) {
+            if (initWeights) {
+                auto* depthwiseLayer = reinterpret_cast<WeightableLayer*>(depthwiseNode->getCnnLayer().get());
+                MKLDNNDims depthwiseDims({static_cast<ptrdiff_t>(rnd_up(getParentEdgesAtPort(REDUCE_DATA)[0]->getDims()[1], 16))});
+
+                PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+                PostOpsIntBlobMemory[blob_idx]->Create(depthwiseDims, memory::data_type::f32, memory::format::x);
+
+                PostOpsIntBlobMemory[blob_idx]->SetData(memory::data_type::f32, memory::x,
+                                                        depthwiseLayer->_weights->buffer(),
+                                                        depthwiseLayer->_weights->size() *
+                                                        MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+                if (depthwiseNode->isBroadcast()) {
+                    float broadcastValue = static_cast<float *>(PostOpsIntBlobMemory[blob_idx]->GetData())[0];
+                    for (int i = 1; i < PostOpsIntBlobMemory[blob_idx]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
+                        static_cast<float *>(PostOpsIntBlobMemory[blob_idx]->GetData())[i] = broadcastValue;
+                    }
+                }
+
+                if (depthwiseNode->getAlgorithm() == depthwise_scale_shift) {
+                    PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+                    PostOpsIntBlobMemory[blob_idx + 1]->Create(depthwiseDims, memory::data_type::f32,
+                                                               memory::format::x);
+                    PostOpsIntBlobMemory[blob_idx + 1]->SetData(memory::data_type::f32, memory::x,
+                                                                depthwiseLayer->_biases->buffer(),
+                                                                depthwiseLayer->_biases->size() *
+                                                                MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+                    if (depthwiseNode->isBroadcast()) {
+                        float broadcastValue = static_cast<float *>(PostOpsIntBlobMemory[blob_idx + 1]->GetData())[0];
+                        for (int i = 1; i < PostOpsIntBlobMemory[blob_idx + 1]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
+                            static_cast<float *>(PostOpsIntBlobMemory[blob_idx + 1]->GetData())[i] = broadcastValue;
+                        }
+                    }
+
+                    ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx]->GetData(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx + 1]->GetData());
+
+                    blob_idx += 2;
+                } else {
+                    ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx]->GetData(),
+                                         nullptr);
+
+                    blob_idx += 1;
+                }
+            } else {
+                ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                     nullptr,
+                                     nullptr);
+            }
+
+            continue;
+        }
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            ops.append_eltwise(1.0, activationNode->getAlgorithm(), activationNode->getAlpha(), activationNode->getBeta());
+
+            continue;
+        }
+
+        THROW_IE_EXCEPTION << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType()) << " node is not implemented";
+    }
+
+    attr.set_post_ops(ops);
+}
+
+void MKLDNNReduceNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgesAtPort(REDUCE_DATA)[0]->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    auto selectedPD = getSelectedPrimitiveDescriptor();
+    input_prec = selectedPD->getConfig().inConfs[REDUCE_DATA].desc.getPrecision();
+    output_prec = selectedPD->getConfig().outConfs[0].desc.getPrecision();
+    src_data_size = input_prec.size();
+    dst_data_size = output_prec.size();
+
+    auto srcDesc = getParentEdgesAtPort(REDUCE_DATA)[0]->getDesc();
+    if (srcDesc.getBlockingDesc().getBlockDims().size() > srcDesc.getDims().size()) {
+        layout = blocked;
+        blk_size = srcDesc.getBlockingDesc().getBlockDims().back();
+    } else if (srcDesc.getLayout() == Layout::NHWC || srcDesc.getLayout() == Layout::NDHWC) {
+        layout = channels_last;
+    } else {
+        layout = planar;
+    }
+
+    // integer outputs keep integer accumulation of the reference implementation unless operations are fused
+    jit_mode = mayiuse(cpu::sse42) && (output_prec == Precision::FP32 || !fusedWith.empty());
+    if (jit_mode) {
+        auto jcp = jit_reduce_config_params();
+        jcp.reduce_mode = reduceMode;
+        jcp.src_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(input_prec);
+        jcp.src_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.src_dt);
+
+        auto post_jcp = jit_reduce_post_config_params();
+        post_jcp.dst_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(output_prec);
+        post_jcp.dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(post_jcp.dst_dt);
+
+        if (mayiuse(cpu::avx512_common)) {
+            reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::avx512_common>(jcp));
+            if (!fusedWith.empty())
+                reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::avx512_common>(post_jcp, *attr.get()));
+        } else if (mayiuse(cpu::avx2)) {
+            reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::avx2>(jcp));
+            if (!fusedWith.empty())
+                reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::avx2>(post_jcp, *attr.get()));
+        } else {
+            reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::sse42>(jcp));
+            if (!fusedWith.empty())
+                reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::sse42>(post_jcp, *attr.get()));
+        }
+    }
+
+    // axes computed by a constant subgraph are read once, on the first execution
+    cachedAxes = constAxes || getParentEdgesAtPort(REDUCE_INDEXES)[0]->getParent()->isConstant();
+    if (constAxes)
+        prepareReduce(rawAxes);
+}
+
+std::vector<int> MKLDNNReduceNode::getAxes() const {
+    if (constAxes)
+        return rawAxes;
+
+    auto &axesMemPtr = getParentEdgesAtPort(REDUCE_INDEXES)[0]->getMemoryPtr();
+    const int32_t *axes = reinterpret_cast<const int32_t *>(axesMemPtr->GetData()) +
+            axesMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+    return std::vector<int>(axes, axes + getParentEdgesAtPort(REDUCE_INDEXES)[0]->getDims().size());
+}
+
+void MKLDNNReduceNode::prepareReduce(const std::vector<int>& axes) {
+    const auto srcDims = getParentEdgesAtPort(REDUCE_DATA)[0]->getDims().ToSizeVector();
+    const size_t rank = srcDims.size();
+
+    std::vector<bool> reducedAxes(rank, false);
+    for (int axis : axes) {
+        int idx = axis < 0 ? axis + static_cast<int>(rank) : axis;
+        if (idx < 0 || idx >= static_cast<int>(rank))
+            THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect axis " << axis;
+        reducedAxes[idx] = true;
+    }
+
+    plan = ReducePlan();
+    size_t dstWork = 1;
+    for (size_t i = 0; i < rank; i++) {
+        if (reducedAxes[i])
+            plan.reduce_count *= srcDims[i];
+        else
+            dstWork *= srcDims[i];
+    }
+    if (dstWork != getChildEdgeAt(0)->getDims().size())
+        THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect number of output dimensions!";
+
+    // dims in the memory order
+    std::vector<size_t> dims;
+    std::vector<bool> reduced;
+    if (layout == planar || rank < 3) {
+        dims = srcDims;
+        reduced = reducedAxes;
+    } else {
+        dims.push_back(srcDims[0]);
+        reduced.push_back(reducedAxes[0]);
+        if (layout == blocked) {
+            dims.push_back(div_up(srcDims[1], blk_size));
+            reduced.push_back(false);
+        }
+        for (size_t i = 2; i < rank; i++) {
+            dims.push_back(srcDims[i]);
+            reduced.push_back(reducedAxes[i]);
+        }
+        dims.push_back(layout == blocked ? blk_size : srcDims[1]);
+        reduced.push_back(false);
+    }
+
+    // unit dims are dropped and the neighbouring dims of the same kind are merged
+    std::vector<size_t> groups;
+    std::vector<bool> groupReduced;
+    for (size_t i = 0; i < dims.size(); i++) {
+        plan.dst_size *= reduced[i] ? 1 : dims[i];
+        if (dims[i] == 1)
+            continue;
+        if (!groups.empty() && groupReduced.back() == reduced[i]) {
+            groups.back() *= dims[i];
+        } else {
+            groups.push_back(dims[i]);
+            groupReduced.push_back(reduced[i]);
+        }
+    }
+    if (groups.empty()) {
+        groups.push_back(1);
+        groupReduced.push_back(false);
+    }
+
+    const size_t groupsNum = groups.size();
+    std::vector<size_t> srcStrides(groupsNum, 1);
+    std::vector<size_t> dstStrides(groupsNum, 1);
+    for (size_t i = groupsNum - 1; i > 0; i--) {
+        srcStrides[i - 1] = srcStrides[i] * groups[i];
+        dstStrides[i - 1] = dstStrides[i] * (groupReduced[i] ? 1 : groups[i]);
+    }
+
+    // The innermost group is either reduced to a scalar (horizontal) or accumulated into the output row (vertical).
+    // The closest reduced group above it becomes the rows of the kernel call.
+    plan.horizontal = groupReduced.back();
+    plan.row_len = groups.back();
+    size_t rowsGroup = groupsNum;
+    if (plan.horizontal && groupsNum >= 3)
+        rowsGroup = groupsNum - 3;
+    else if (!plan.horizontal && groupsNum >= 2)
+        rowsGroup = groupsNum - 2;
+    if (rowsGroup < groupsNum) {
+        plan.rows = groups[rowsGroup];
+        plan.row_stride = srcStrides[rowsGroup];
+    }
+
+    for (size_t i = 0; i + 1 < groupsNum; i++) {
+        if (i == rowsGroup)
+            continue;
+        if (groupReduced[i]) {
+            plan.reduced_dims.push_back(groups[i]);
+            plan.reduced_src_strides.push_back(srcStrides[i]);
+            plan.reduced_work *= groups[i];
+        } else {
+            plan.kept_dims.push_back(groups[i]);
+            plan.kept_src_strides.push_back(srcStrides[i]);
+            plan.kept_dst_strides.push_back(dstStrides[i]);
+            plan.kept_work *= groups[i];
+        }
+    }
+
+    preparedAxes = axes;
+    axesPrepared = true;
+}
+
+template <typename acc_t, typename R>
+void MKLDNNReduceNode::reduce_loops(const uint8_t *src_data, acc_t *dst_data, size_t data_size, R reduce_rows) {
+    const size_t out_row = plan.horizontal ? 1 : plan.row_len;
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    const acc_t init_value = reduce_init_value<acc_t>(reduceMode);
+
+    auto kept_offsets = [&](size_t p, size_t &src_off, size_t &dst_off) {
+        src_off = 0;
+        dst_off = 0;
+        for (size_t i = plan.kept_dims.size(); i-- > 0;) {
+            size_t idx = p % plan.kept_dims[i];
+            p /= plan.kept_dims[i];
+            src_off += idx * plan.kept_src_strides[i];
+            dst_off += idx * plan.kept_dst_strides[i];
+        }
+    };
+    auto reduced_offset = [&](size_t r) {
+        size_t src_off = 0;
+        for (size_t i = plan.reduced_dims.size(); i-- > 0;) {
+            src_off += (r % plan.reduced_dims[i]) * plan.reduced_src_strides[i];
+            r /= plan.reduced_dims[i];
+        }
+        return src_off;
+    };
+
+    parallel_for(plan.dst_size, [&](size_t i) {
+        dst_data[i] = init_value;
+    });
+
+    // output rows of a vertical reduction are split into column blocks when there are few of them
+    size_t col_block = plan.row_len;
+    size_t col_blocks = 1;
+    if (!plan.horizontal && plan.kept_work < nthr) {
+        col_block = rnd_up(div_up(out_row, div_up(nthr, plan.kept_work)), minColumnBlock);
+        col_blocks = div_up(out_row, col_block);
+    }
+
+    const size_t reduced_rows = plan.reduced_work * plan.rows;
+    const size_t src_work = plan.kept_work * reduced_rows * plan.row_len;
+    if (plan.kept_work * col_blocks >= nthr || src_work < minSplitWork) {
+        parallel_for2d(plan.kept_work, col_blocks, [&](size_t p, size_t cb) {
+            size_t src_off = 0, dst_off = 0;
+            kept_offsets(p, src_off, dst_off);
+            const size_t col = cb * col_block;
+            const size_t len = (std::min)(col_block, plan.row_len - col);
+            for (size_t r = 0; r < plan.reduced_work; r++) {
+                reduce_rows(src_data + (src_off + reduced_offset(r) + col) * data_size, dst_data + dst_off + col, len, plan.rows);
+            }
+        });
+        return;
+    }
+
+    // Otherwise the rows (or chunks of a single long row) are split between threads,
+    // each thread accumulates into its own buffer and the buffers are combined at the end.
+    size_t chunk_len = plan.row_len;
+    size_t chunks = 1;
+    if (plan.horizontal && reduced_rows < nthr) {
+        chunk_len = rnd_up(div_up(plan.row_len, div_up(nthr, reduced_rows)), minColumnBlock);
+        chunks = div_up(plan.row_len, chunk_len);
+    }
+
+    const size_t part_size = plan.kept_work * out_row;
+    std::vector<acc_t> partial(nthr * part_size, init_value);
+    parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr_used) {
+        size_t start = 0, end = 0;
+        splitter(reduced_rows * chunks, nthr_used, ithr, start, end);
+        acc_t *part = &partial[ithr * part_size];
+        for (size_t p = 0; p < plan.kept_work; p++) {
+            size_t src_off = 0, dst_off = 0;
+            kept_offsets(p, src_off, dst_off);
+            if (chunks == 1) {
+                for (size_t s = start; s < end;) {
+                    const size_t r = s / plan.rows;
+                    const size_t row = s % plan.rows;
+                    const size_t rows = (std::min)(end - s, plan.rows - row);
+                    reduce_rows(src_data + (src_off + reduced_offset(r) + row * plan.row_stride) * data_size,
+                                part + p * out_row, plan.row_len, rows);
+                    s += rows;
+                }
+            } else {
+                for (size_t u = start; u < end; u++) {
+                    const size_t s = u / chunks;
+                    const size_t col = (u % chunks) * chunk_len;
+                    const size_t r = s / plan.rows;
+                    const size_t row = s % plan.rows;
+                    reduce_rows(src_data + (src_off + reduced_offset(r) + row * plan.row_stride + col) * data_size,
+                                part + p, (std::min)(chunk_len, plan.row_len - col), 1);
+                }
+            }
+        }
+    });
+
+    parallel_for(part_size, [&](size_t i) {
+        size_t src_off = 0, dst_off = 0;
+        kept_offsets(i / out_row, src_off, dst_off);
+        acc_t &dst = dst_data[dst_off + i % out_row];
+        for (size_t ithr = 0; ithr < nthr; ithr++)
+            dst = reduce_combine<acc_t>(reduceMode, dst, partial[ithr * part_size + i]);
+    });
+}
+
+void MKLDNNReduceNode::reduce_jit(const uint8_t *src_data, uint8_t *dst_data) {
+    const bool withPostOps = reduce_post_kernel != nullptr;
+    float *acc_data = reinterpret_cast<float *>(dst_data);
+    if (withPostOps) {
+        intermediate.resize(plan.dst_size);
+        acc_data = intermediate.data();
+    }
+
+    const size_t src_row_stride = plan.row_stride * src_data_size;
+    const size_t horizontal = plan.horizontal ? 1 : 0;
+    reduce_loops(src_data, acc_data, src_data_size, [&](const uint8_t *src, float *dst, size_t work_amount, size_t rows) {
+        auto arg = jit_reduce_call_args();
+        arg.src = static_cast<const void *>(src);
+        arg.dst = dst;
+        arg.work_amount = work_amount;
+        arg.rows = rows;
+        arg.src_row_stride = src_row_stride;
+        arg.horizontal = horizontal;
+        (*reduce_kernel)(&arg);
+    });
+    finalize(acc_data);
+
+    if (withPostOps) {
+        // channels are contiguous in the blocked and channels last layouts
+        const auto dstDims = getChildEdgeAt(0)->getDims().ToSizeVector();
+        const size_t C = dstDims[1];
+        const size_t channels = layout == blocked ? blk_size : C;
+        const size_t CB = div_up(C, blk_size);
+        const size_t spatial = plan.dst_size / (dstDims[0] * CB * blk_size);
+        parallel_for(plan.dst_size / channels, [&](size_t i) {
+            auto arg = jit_reduce_post_call_args();
+            arg.src = acc_data + i * channels;
+            arg.dst = dst_data + i * channels * dst_data_size;
+            arg.work_amount = channels;
+            arg.oc_off = layout == blocked ? ((i / spatial) % CB) * blk_size * sizeof(float) : 0;
+            (*reduce_post_kernel)(&arg);
+        });
+    }
+}
+
+template <typename dst_t>
+void MKLDNNReduceNode::reduce_ref(const uint8_t *src_data, uint8_t *dst_data) {
+    auto dst = reinterpret_cast<dst_t *>(dst_data);
+    if (input_prec == Precision::FP32) {
+        reduce_ref_impl<float, dst_t>(reinterpret_cast<const float *>(src_data), dst);
+    } else if (input_prec == Precision::I32) {
+        reduce_ref_impl<int32_t, dst_t>(reinterpret_cast<const int32_t *>(src_data), dst);
+    } else if (input_prec == Precision::U8) {
+        reduce_ref_impl<uint8_t, dst_t>(reinterpret_cast<const uint8_t *>(src_data), dst);
+    } else if (input_prec == Precision::I8) {
+        reduce_ref_impl<int8_t, dst_t>(reinterpret_cast<const int8_t *>(src_data), dst);
+    }
+}
+
+template <typename src_t, typename dst_t>
+void MKLDNNReduceNode::reduce_ref_impl(const src_t *src_data, dst_t *dst_data) {
+    switch (reduceMode) {
+        case ReduceMode::And:
+            reduce_ref_rows(src_data, dst_data, [](dst_t x, src_t y)->dst_t { return x && y; });
+            break;
+        case ReduceMode::L1:
+            reduce_ref_rows(src_data, dst_data, [](dst_t old, src_t y)->dst_t { return old + (std::abs)(y); });
+            break;
+        case ReduceMode::L2:
+        case ReduceMode::SumSquare:
+            reduce_ref_rows(src_data, dst_data, [](dst_t old, src_t y)->dst_t { return old + y * y; });
+            break;
+        case ReduceMode::LogSumExp:
+            reduce_ref_rows(src_data, dst_data, [](dst_t old, src_t y)->dst_t { return old + expf(y); });
+            break;
+        case ReduceMode::Max:
+            reduce_ref_rows(src_data, dst_data, [](dst_t x, src_t y)->dst_t { return x > y ? x : y; });
+            break;
+        case ReduceMode::Min:
+            reduce_ref_rows(src_data, dst_data, [](dst_t x, src_t y)->dst_t { return x < y ? x : y; });
+            break;
+        case ReduceMode::Or:
+            reduce_ref_rows(src_data, dst_data, [](dst_t x, src_t y)->dst_t { return x || y; });
+            break;
+        case ReduceMode::Prod:
+            reduce_ref_rows(src_data, dst_data, [](dst_t x, src_t y)->dst_t { return x * y; });
+            break;
+        default:
+            reduce_ref_rows(src_data, dst_data, [](dst_t x, src_t y)->dst_t { return x + y; });
+            break;
+    }
+    finalize(dst_data);
+}
+
+template <typename src_t, typename dst_t, typename F>
+void MKLDNNReduceNode::reduce_ref_rows(const src_t *src_data, dst_t *dst_data, F func) {
+    const size_t row_stride = plan.row_stride;
+    const bool horizontal = plan.horizontal;
+    reduce_loops(reinterpret_cast<const uint8_t *>(src_data), dst_data, sizeof(src_t),
+                 [&](const uint8_t *src, dst_t *dst, size_t work_amount, size_t rows) {
+        auto src_row = reinterpret_cast<const src_t *>(src);
+        if (horizontal) {
+            dst_t acc = dst[0];
+            for (size_t r = 0; r < rows; r++, src_row += row_stride) {
+                for (size_t i = 0; i < work_amount; i++)
+                    acc = func(acc, src_row[i]);
+            }
+            dst[0] = acc;
+        } else {
+            for (size_t r = 0; r < rows; r++, src_row += row_stride) {
+                for (size_t i = 0; i < work_amount; i++)
+                    dst[i] = func(dst[i], src_row[i]);
+            }
+        }
+    });
+}
+
+template <typename T>
+void MKLDNNReduceNode::finalize(T *dst_data) {
+    switch (reduceMode) {
+        case ReduceMode::L2:
+            parallel_for(plan.dst_size, [&](size_t i) {
+                dst_data[i] = static_cast<T>(std::sqrt(static_cast<float>(dst_data[i])));
+            });
+            break;
+        case ReduceMode::LogSum:
+        case ReduceMode::LogSumExp:
+            parallel_for(plan.dst_size, [&](size_t i) {
+                dst_data[i] = static_cast<T>(logf(static_cast<float>(dst_data[i])));
+            });
+            break;
+        case ReduceMode::Mean:
+            parallel_for(plan.dst_size, [&](size_t i) {
+                dst_data[i] /= static_cast<T>(plan.reduce_count);
+            });
+            break;
+        default:
+            break;
+    }
+}
+
+void MKLDNNReduceNode::clearBlockedPadding(uint8_t *dst_data, size_t data_size) {
+    const auto dstDims = getChildEdgeAt(0)->getDims().ToSizeVector();
+    const size_t C = dstDims[1];
+    const size_t tail = C % blk_size;
+    if (tail == 0)
+        return;
+
+    // the padded channels are not zeros after the reduction of garbage (e.g. log of it)
+    const size_t CB = div_up(C, blk_size);
+    const size_t spatial = plan.dst_size / (dstDims[0] * CB * blk_size);
+    parallel_for2d(dstDims[0], spatial, [&](size_t n, size_t s) {
+        const size_t offset = (((n * CB + CB - 1) * spatial + s) * blk_size + tail) * data_size;
+        std::memset(dst_data + offset, 0, (blk_size - tail) * data_size);
+    });
+}
+
+void MKLDNNReduceNode::execute(mkldnn::stream strm) {
+    auto &srcMemPtr = getParentEdgesAtPort(REDUCE_DATA)[0]->getMemoryPtr();
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const uint8_t *src_data = reinterpret_cast<const uint8_t*>(srcMemPtr->GetData()) +
+            srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding * src_data_size;
+    uint8_t *dst_data = reinterpret_cast<uint8_t*>(dstMemPtr->GetData()) +
+            dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding * dst_data_size;
+
+    if (!axesPrepared || !cachedAxes) {
+        auto axes = getAxes();
+        if (!axesPrepared || axes != preparedAxes)
+            prepareReduce(axes);
+    }
+
+    if (jit_mode) {
+        reduce_jit(src_data, dst_data);
+    } else if (output_prec == Precision::FP32) {
+        reduce_ref<float>(src_data, dst_data);
+    } else if (output_prec == Precision::I32) {
+        reduce_ref<int32_t>(src_data, dst_data);
+    } else if (output_prec == Precision::U8) {
+        reduce_ref<uint8_t>(src_data, dst_data);
+    } else if (output_prec == Precision::I8) {
+        reduce_ref<int8_t>(src_data, dst_data);
+    }
+
+    if (layout == blocked)
+        clearBlockedPadding(dst_data, dst_data_size);
+}
+
+bool MKLDNNReduceNode::created() const {
+    return getType() == Reduce;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNReduceNode, Reduce);
@@ -0,0 +1,177 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+enum class ReduceMode {
+    And,
+    L1,
+    L2,
+    LogSum,
+    LogSumExp,
+    Max,
+    Mean,
+    Min,
+    Or,
+    Prod,
+    Sum,
+    SumSquare
+};
+
+struct jit_reduce_config_params {
+    ReduceMode reduce_mode;
+    mkldnn::memory::data_type src_dt;
+    int src_data_size;
+};
+
+struct jit_reduce_call_args {
+    const void *src;
+    float *dst;
+    size_t work_amount;     // number of elements in a row
+    size_t rows;            // number of rows reduced by the call
+    size_t src_row_stride;  // distance between rows in bytes
+    size_t horizontal;      // 0: rows are reduced into dst[0..work_amount), 1: all elements are reduced into dst[0]
+};
+
+struct jit_reduce_post_config_params {
+    mkldnn::memory::data_type dst_dt;
+    int dst_data_size;
+};
+
+struct jit_reduce_post_call_args {
+    const float *src;
+    void *dst;
+    size_t work_amount;
+    size_t oc_off;
+};
+
+struct jit_uni_reduce_kernel {
+    void (*ker_)(const jit_reduce_call_args *);
+
+    void operator()(const jit_reduce_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_reduce_kernel(jit_reduce_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_reduce_kernel() {}
+
+    jit_reduce_config_params jcp_;
+};
+
+struct jit_uni_reduce_post_kernel {
+    void (*ker_)(const jit_reduce_post_call_args *);
+
+    void operator()(const jit_reduce_post_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_reduce_post_kernel(jit_reduce_post_config_params jcp, const mkldnn_primitive_attr &attr) : ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_reduce_post_kernel() {}
+
+    jit_reduce_post_config_params jcp_;
+    const mkldnn_primitive_attr &attr_;
+};
+
+class MKLDNNReduceNode : public MKLDNNNode {
+public:
+    MKLDNNReduceNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNReduceNode() override = default;
+
+    void init() override;
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    bool created() const override;
+    void execute(mkldnn::stream strm) override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+    /**
+     * @brief Blocked and channels last layouts and fusing of per channel operations need the channels axis
+     * to be kept, so they are supported for 4D and 5D inputs with constant axes and keep_dims only.
+     */
+    bool canFuseSimpleOperation() const;
+
+private:
+    enum LayoutType {
+        planar,
+        channels_last,
+        blocked
+    };
+
+    // Reduction of the physical (collapsed) tensor: every kernel call reduces `rows` rows of `row_len` elements,
+    // the calls are repeated over the outer reduced dims and distributed over the outer kept dims.
+    struct ReducePlan {
+        bool horizontal = true;
+        size_t row_len = 1;
+        size_t rows = 1;
+        size_t row_stride = 0;
+        std::vector<size_t> kept_dims, kept_src_strides, kept_dst_strides;
+        std::vector<size_t> reduced_dims, reduced_src_strides;
+        size_t kept_work = 1;
+        size_t reduced_work = 1;
+        size_t reduce_count = 1;
+        size_t dst_size = 1;
+    };
+
+    void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false);
+    std::vector<int> getAxes() const;
+    void prepareReduce(const std::vector<int>& axes);
+
+    template <typename acc_t, typename R>
+    void reduce_loops(const uint8_t *src_data, acc_t *dst_data, size_t data_size, R reduce_rows);
+
+    void reduce_jit(const uint8_t *src_data, uint8_t *dst_data);
+
+    template <typename dst_t>
+    void reduce_ref(const uint8_t *src_data, uint8_t *dst_data);
+
+    template <typename src_t, typename dst_t>
+    void reduce_ref_impl(const src_t *src_data, dst_t *dst_data);
+
+    template <typename src_t, typename dst_t, typename F>
+    void reduce_ref_rows(const src_t *src_data, dst_t *dst_data, F func);
+
+    template <typename T>
+    void finalize(T *dst_data);
+
+    void clearBlockedPadding(uint8_t *dst_data, size_t data_size);
+
+    ReduceMode reduceMode = ReduceMode::Sum;
+    bool keep_dims = true;
+    bool constAxes = false;
+    std::vector<int> rawAxes;
+    std::vector<int> preparedAxes;
+    bool axesPrepared = false;
+    bool cachedAxes = false;
+
+    LayoutType layout = planar;
+    size_t blk_size = 1;
+    bool jit_mode = false;
+    ReducePlan plan;
+    std::vector<float> intermediate;
+
+    InferenceEngine::Precision input_prec, output_prec;
+    size_t src_data_size, dst_data_size;
+
+    mkldnn::primitive_attr attr;
+
+    std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
+
+    std::shared_ptr<jit_uni_reduce_kernel> reduce_kernel;
+    std::shared_ptr<jit_uni_reduce_post_kernel> reduce_post_kernel;
+};
+
+}  // namespace MKLDNNPlugin
@@ -4,6 +4,8 @@
 
 #include "base.hpp"
 
+#include "non_max_suppression_imp.hpp"
+
 #include <cmath>
 #include <string>
 #include <vector>
@@ -93,41 +95,6 @@ public:
         }
     }
 
-    static float intersectionOverUnion(float* boxesI, float* boxesJ, bool center_point_box) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-        if (center_point_box) {
-            //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-        } else {
-            //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-        }
-
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-        if (areaI <= 0.f || areaJ <= 0.f)
-            return 0.f;
-
-        float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-        return intersection_area / (areaI + areaJ - intersection_area);
-    }
-
     typedef struct {
         float score;
         int batch_index;
@@ -169,47 +136,65 @@ public:
         // scores shape: {num_batches, num_classes, num_boxes}
         int num_batches = static_cast<int>(scores_dims[0]);
         int num_classes = static_cast<int>(scores_dims[1]);
-        std::vector<filteredBoxes> fb;
 
-        for (int batch = 0; batch < num_batches; batch++) {
-            float *boxesPtr = boxes + batch * boxesStrides[0];
-            for (int class_idx = 0; class_idx < num_classes; class_idx++) {
-                float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
-                std::vector<std::pair<float, int> > scores_vector;
-                for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                    if (scoresPtr[box_idx] > score_threshold)
-                        scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
-                }
-
-                if (scores_vector.size()) {
-                    parallel_sort(scores_vector.begin(), scores_vector.end(),
-                        [](const std::pair<float, int>& l, const std::pair<float, int>& r) { return l.first > r.first; });
-
-                    int io_selection_size = 1;
-                    fb.push_back({ scores_vector[0].first, batch, class_idx, scores_vector[0].second });
-                    for (int box_idx = 1; (box_idx < static_cast<int>(scores_vector.size()) && io_selection_size < max_output_boxes_per_class); box_idx++) {
-                        bool box_is_selected = true;
-                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[scores_vector[box_idx].second * 4],
-                                             &boxesPtr[scores_vector[idx].second * 4], center_point_box);
-                            if (iou > iou_threshold) {
-                                box_is_selected = false;
-                                break;
-                            }
-                        }
-
-                        if (box_is_selected) {
-                            scores_vector[io_selection_size] = scores_vector[box_idx];
-                            io_selection_size++;
-                            fb.push_back({ scores_vector[box_idx].first, batch, class_idx, scores_vector[box_idx].second });
-                        }
-                    }
-                }
-            }
+        // IoU is never negative, so every box except the first one is suppressed by a negative threshold
+        size_t max_out = static_cast<size_t>((std::max)(max_output_boxes_per_class, 0));
+        if (iou_threshold < 0.f) {
+            max_out = (std::min)(max_out, static_cast<size_t>(1));
+            iou_threshold = 0.f;
         }
 
+        std::vector<nms_boxes> batch_boxes(num_batches);
+        parallel_for(num_batches, [&](int batch) {
+            prepareBoxes(boxes + batch * boxesStrides[0], num_boxes, batch_boxes[batch]);
+        });
+
+        // each (batch, class) pair is processed independently, the results are merged in the serial order
+        std::vector<std::vector<filteredBoxes>> class_fb(num_batches * num_classes);
+        parallel_for2d(num_batches, num_classes, [&](int batch, int class_idx) {
+            const float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+            std::vector<int> candidates;
+            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
+                if (scoresPtr[box_idx] > score_threshold)
+                    candidates.push_back(box_idx);
+            }
+
+            // boxes with equal scores are taken in the order of their indices
+            auto greater = [scoresPtr](int l, int r) {
+                return scoresPtr[l] > scoresPtr[r] || (scoresPtr[l] == scoresPtr[r] && l < r);
+            };
+
+            // Usually only a small part of candidates is needed to select max_out boxes, so instead of
+            // the full sort the candidates are partially sorted by chunks of growing size until
+            // enough boxes are selected
+            nms_selection selection;
+            size_t sorted = 0;
+            size_t chunk = (std::max)(2 * max_out, prefilterMinChunk);
+            while (sorted < candidates.size() && selection.size() < max_out) {
+                const size_t chunk_end = (std::min)(candidates.size(), sorted + chunk);
+                if (chunk_end < candidates.size())
+                    std::nth_element(candidates.begin() + sorted, candidates.begin() + chunk_end, candidates.end(), greater);
+                std::sort(candidates.begin() + sorted, candidates.begin() + chunk_end, greater);
+
+                XARCH::nms_select(batch_boxes[batch], candidates.data() + sorted, chunk_end - sorted,
+                                  iou_threshold, max_out, selection);
+                sorted = chunk_end;
+                chunk *= 2;
+            }
+
+            auto& fb = class_fb[batch * num_classes + class_idx];
+            fb.reserve(selection.size());
+            for (auto box_idx : selection.indices)
+                fb.push_back({ scoresPtr[box_idx], batch, class_idx, box_idx });
+        });
+
+        std::vector<filteredBoxes> fb;
+        for (auto& boxes_of_class : class_fb)
+            fb.insert(fb.end(), boxes_of_class.begin(), boxes_of_class.end());
+
         if (sort_result_descending) {
-            parallel_sort(fb.begin(), fb.end(), [](const filteredBoxes& l, const filteredBoxes& r) { return l.score > r.score; });
+            // stable sort keeps the (batch, class) order of boxes with equal scores
+            std::stable_sort(fb.begin(), fb.end(), [](const filteredBoxes& l, const filteredBoxes& r) { return l.score > r.score; });
         }
 
         int selected_indicesStride = outputs[0]->getTensorDesc().getBlockingDesc().getStrides()[0];
@@ -232,6 +217,35 @@ public:
     }
 
 private:
+    void prepareBoxes(const float* boxesPtr, int num_boxes, nms_boxes& soa) const {
+        for (auto vec : {&soa.ymin, &soa.xmin, &soa.ymax, &soa.xmax, &soa.area})
+            vec->resize(num_boxes);
+
+        for (int i = 0; i < num_boxes; i++) {
+            const float* box = boxesPtr + i * 4;
+            float ymin, xmin, ymax, xmax;
+            if (center_point_box) {
+                //  box format: x_center, y_center, width, height
+                ymin = box[1] - box[3] / 2.f;
+                xmin = box[0] - box[2] / 2.f;
+                ymax = box[1] + box[3] / 2.f;
+                xmax = box[0] + box[2] / 2.f;
+            } else {
+                //  box format: y1, x1, y2, x2
+                ymin = (std::min)(box[0], box[2]);
+                xmin = (std::min)(box[1], box[3]);
+                ymax = (std::max)(box[0], box[2]);
+                xmax = (std::max)(box[1], box[3]);
+            }
+            soa.ymin[i] = ymin;
+            soa.xmin[i] = xmin;
+            soa.ymax[i] = ymax;
+            soa.xmax[i] = xmax;
+            soa.area[i] = (ymax - ymin) * (xmax - xmin);
+        }
+    }
+
+    const size_t prefilterMinChunk = 64;
     const size_t NMS_BOXES = 0;
     const size_t NMS_SCORES = 1;
     const size_t NMS_MAXOUTPUTBOXESPERCLASS = 2;
@@ -0,0 +1,126 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "non_max_suppression_imp.hpp"
+
+#include <algorithm>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// Checks the candidate against nms_selection::block selected boxes starting from `pos`.
+// The operation order is the same as in the scalar IoU so the results are bit exact.
+static inline bool is_suppressed_block(const nms_selection& sel, size_t pos,
+                                       float yminI, float xminI, float ymaxI, float xmaxI, float areaI,
+                                       float iou_threshold) {
+#if defined(HAVE_AVX512F)
+    const __m512 vzero = _mm512_setzero_ps();
+    const __m512 vyminI = _mm512_set1_ps(yminI);
+    const __m512 vxminI = _mm512_set1_ps(xminI);
+    const __m512 vymaxI = _mm512_set1_ps(ymaxI);
+    const __m512 vxmaxI = _mm512_set1_ps(xmaxI);
+    const __m512 vareaI = _mm512_set1_ps(areaI);
+    const __m512 vthreshold = _mm512_set1_ps(iou_threshold);
+
+    const __m512 vareaJ = _mm512_loadu_ps(&sel.area[pos]);
+    const __m512 vheight = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(vymaxI, _mm512_loadu_ps(&sel.ymax[pos])),
+                                                       _mm512_max_ps(vyminI, _mm512_loadu_ps(&sel.ymin[pos]))), vzero);
+    const __m512 vwidth = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(vxmaxI, _mm512_loadu_ps(&sel.xmax[pos])),
+                                                      _mm512_max_ps(vxminI, _mm512_loadu_ps(&sel.xmin[pos]))), vzero);
+    const __m512 vintersection = _mm512_mul_ps(vheight, vwidth);
+    const __m512 viou = _mm512_div_ps(vintersection, _mm512_sub_ps(_mm512_add_ps(vareaI, vareaJ), vintersection));
+
+    __mmask16 mask = _mm512_cmp_ps_mask(vareaJ, vzero, _CMP_GT_OQ);
+    mask = _mm512_mask_cmp_ps_mask(mask, viou, vthreshold, _CMP_GT_OQ);
+    return mask != 0;
+#elif defined(HAVE_AVX2)
+    const __m256 vzero = _mm256_setzero_ps();
+    const __m256 vyminI = _mm256_set1_ps(yminI);
+    const __m256 vxminI = _mm256_set1_ps(xminI);
+    const __m256 vymaxI = _mm256_set1_ps(ymaxI);
+    const __m256 vxmaxI = _mm256_set1_ps(xmaxI);
+    const __m256 vareaI = _mm256_set1_ps(areaI);
+    const __m256 vthreshold = _mm256_set1_ps(iou_threshold);
+
+    for (size_t j = pos; j < pos + nms_selection::block; j += 8) {
+        const __m256 vareaJ = _mm256_loadu_ps(&sel.area[j]);
+        const __m256 vheight = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(vymaxI, _mm256_loadu_ps(&sel.ymax[j])),
+                                                           _mm256_max_ps(vyminI, _mm256_loadu_ps(&sel.ymin[j]))), vzero);
+        const __m256 vwidth = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(vxmaxI, _mm256_loadu_ps(&sel.xmax[j])),
+                                                          _mm256_max_ps(vxminI, _mm256_loadu_ps(&sel.xmin[j]))), vzero);
+        const __m256 vintersection = _mm256_mul_ps(vheight, vwidth);
+        const __m256 viou = _mm256_div_ps(vintersection, _mm256_sub_ps(_mm256_add_ps(vareaI, vareaJ), vintersection));
+
+        const __m256 vmask = _mm256_and_ps(_mm256_cmp_ps(vareaJ, vzero, _CMP_GT_OQ),
+                                           _mm256_cmp_ps(viou, vthreshold, _CMP_GT_OQ));
+        if (_mm256_movemask_ps(vmask))
+            return true;
+    }
+    return false;
+#elif defined(HAVE_SSE42)
+    const __m128 vzero = _mm_setzero_ps();
+    const __m128 vyminI = _mm_set1_ps(yminI);
+    const __m128 vxminI = _mm_set1_ps(xminI);
+    const __m128 vymaxI = _mm_set1_ps(ymaxI);
+    const __m128 vxmaxI = _mm_set1_ps(xmaxI);
+    const __m128 vareaI = _mm_set1_ps(areaI);
+    const __m128 vthreshold = _mm_set1_ps(iou_threshold);
+
+    for (size_t j = pos; j < pos + nms_selection::block; j += 4) {
+        const __m128 vareaJ = _mm_loadu_ps(&sel.area[j]);
+        const __m128 vheight = _mm_max_ps(_mm_sub_ps(_mm_min_ps(vymaxI, _mm_loadu_ps(&sel.ymax[j])),
+                                                     _mm_max_ps(vyminI, _mm_loadu_ps(&sel.ymin[j]))), vzero);
+        const __m128 vwidth = _mm_max_ps(_mm_sub_ps(_mm_min_ps(vxmaxI, _mm_loadu_ps(&sel.xmax[j])),
+                                                    _mm_max_ps(vxminI, _mm_loadu_ps(&sel.xmin[j]))), vzero);
+        const __m128 vintersection = _mm_mul_ps(vheight, vwidth);
+        const __m128 viou = _mm_div_ps(vintersection, _mm_sub_ps(_mm_add_ps(vareaI, vareaJ), vintersection));
+
+        const __m128 vmask = _mm_and_ps(_mm_cmpgt_ps(vareaJ, vzero), _mm_cmpgt_ps(viou, vthreshold));
+        if (_mm_movemask_ps(vmask))
+            return true;
+    }
+    return false;
+#else
+    for (size_t j = pos; j < pos + nms_selection::block; j++) {
+        if (sel.area[j] <= 0.f)
+            continue;
+        const float intersection =
+            (std::max)((std::min)(ymaxI, sel.ymax[j]) - (std::max)(yminI, sel.ymin[j]), 0.f) *
+            (std::max)((std::min)(xmaxI, sel.xmax[j]) - (std::max)(xminI, sel.xmin[j]), 0.f);
+        if (intersection / (areaI + sel.area[j] - intersection) > iou_threshold)
+            return true;
+    }
+    return false;
+#endif
+}
+
+void nms_select(const nms_boxes& boxes, const int* candidates, size_t num_candidates,
+                float iou_threshold, size_t max_output_boxes, nms_selection& selection) {
+    for (size_t c = 0; c < num_candidates && selection.size() < max_output_boxes; c++) {
+        const int box = candidates[c];
+        const float areaI = boxes.area[box];
+
+        // IoU with a box of non positive area is 0, so such a box is never suppressed
+        bool suppressed = false;
+        if (areaI > 0.f) {
+            for (size_t pos = 0; pos < selection.size() && !suppressed; pos += nms_selection::block) {
+                suppressed = is_suppressed_block(selection, pos, boxes.ymin[box], boxes.xmin[box],
+                                                 boxes.ymax[box], boxes.xmax[box], areaI, iou_threshold);
+            }
+        }
+
+        if (!suppressed)
+            selection.add(boxes, box);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
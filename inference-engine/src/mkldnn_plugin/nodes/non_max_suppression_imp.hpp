@@ -0,0 +1,73 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * @brief Boxes of one batch in SoA layout: normalized corners and area of every box.
+ */
+struct nms_boxes {
+    std::vector<float> ymin;
+    std::vector<float> xmin;
+    std::vector<float> ymax;
+    std::vector<float> xmax;
+    std::vector<float> area;
+};
+
+/**
+ * @brief Boxes selected for one (batch, class) pair.
+ * Corners are kept in SoA layout and padded by zero area boxes up to a multiple of `block`,
+ * so IoU against the whole selected set is computed by full SIMD vectors without a tail.
+ */
+struct nms_selection {
+    static constexpr size_t block = 16;
+
+    std::vector<float> ymin;
+    std::vector<float> xmin;
+    std::vector<float> ymax;
+    std::vector<float> xmax;
+    std::vector<float> area;
+    std::vector<int> indices;
+
+    size_t size() const {
+        return indices.size();
+    }
+
+    void add(const nms_boxes& boxes, int box) {
+        const size_t pos = indices.size();
+        if (pos % block == 0) {
+            for (auto vec : {&ymin, &xmin, &ymax, &xmax, &area})
+                vec->resize(pos + block, 0.f);
+        }
+        ymin[pos] = boxes.ymin[box];
+        xmin[pos] = boxes.xmin[box];
+        ymax[pos] = boxes.ymax[box];
+        xmax[pos] = boxes.xmax[box];
+        area[pos] = boxes.area[box];
+        indices.push_back(box);
+    }
+};
+
+namespace XARCH {
+
+/**
+ * @brief Greedy selection of candidates (box indices sorted by score in descending order).
+ * A candidate is added to the selection until it has `max_output_boxes` boxes unless its IoU
+ * with one of the already selected boxes exceeds non negative `iou_threshold`.
+ */
+void nms_select(const nms_boxes& boxes, const int* candidates, size_t num_candidates,
+                float iou_threshold, size_t max_output_boxes, nms_selection& selection);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -20,6 +20,10 @@ public:
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
 
+    // Boundaries of the last measured iteration
+    std::chrono::high_resolution_clock::time_point lastStart() const { return __start; }
+    std::chrono::high_resolution_clock::time_point lastFinish() const { return __finish; }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -44,6 +44,12 @@ DECLARE_CONFIG_KEY(SUBNETWORK_WITH_NETWORK_INPUTS);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Time in microseconds an idle CPU Executor Stream thread polls task queues before it sleeps
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_SPIN_WAIT);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
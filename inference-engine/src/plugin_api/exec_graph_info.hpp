@@ -53,4 +53,34 @@ static const char OUTPUT_LAYOUTS[] = "outputLayouts";
  */
 static const char EXECUTION_ORDER[] = "execOrder";
 
+/**
+ * @brief A general key for CNNLayer::params map. Used to get a start time of the last execution of primitive
+ *        in microseconds relative to the beginning of the inference.
+ */
+static const char EXEC_START_TIME[] = "execStartMcs";
+
+/**
+ * @brief A general key for CNNLayer::params map. Used to get an end time of the last execution of primitive
+ *        in microseconds relative to the beginning of the inference.
+ */
+static const char EXEC_END_TIME[] = "execEndMcs";
+
+/**
+ * @brief A general key for CNNLayer::params map. Used to get a device which executes the primitive
+ *        in heterogeneous execution.
+ */
+static const char AFFINITY[] = "affinity";
+
+/**
+ * @brief A general key for CNNLayer::params map. Used to get an index of the subgraph the primitive belongs to
+ *        in heterogeneous execution.
+ */
+static const char SUBGRAPH_INDEX[] = "subgraphIndex";
+
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the execution time of the original layers fused to
+ *        the primitive in microseconds estimated by the cost model the layers were assigned to the device with.
+ */
+static const char ESTIMATED_TIME[] = "estimatedTimeMcs";
+
 }  // namespace ExecGraphInfoSerialization
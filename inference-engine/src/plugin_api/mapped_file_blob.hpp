@@ -0,0 +1,55 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file with a blob which data is a memory mapped file
+ * @file mapped_file_blob.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "ie_api.h"
+#include "ie_blob.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief A U8 blob which contents is a file mapped into memory
+ * @ingroup ie_dev_api_file_utils
+ *
+ * The mapping is read-only and its pages are shared through the page cache with all processes
+ * mapping the same file, so the blob is only handed out as const: writing to it crashes.
+ * The memory is unmapped when the blob is destroyed.
+ */
+class INFERENCE_ENGINE_API_CLASS(MappedFileBlob) : public TBlob<uint8_t> {
+public:
+    /**
+     * @brief A smart pointer to the MappedFileBlob object
+     */
+    using Ptr = std::shared_ptr<MappedFileBlob>;
+
+    /**
+     * @brief A smart pointer to the const MappedFileBlob object
+     */
+    using CPtr = std::shared_ptr<const MappedFileBlob>;
+
+    /**
+     * @brief Maps the whole file into memory for reading
+     * @param filePath - path to the file
+     * @return A pointer to the blob or nullptr if the file cannot be mapped (e.g. it is empty)
+     */
+    static CPtr create(const std::string& filePath);
+
+private:
+    MappedFileBlob(uint8_t* data, size_t size, std::shared_ptr<void> mapping)
+        : TBlob<uint8_t>(TensorDesc(Precision::U8, {size}, Layout::C), data, size), _mapping(std::move(mapping)) {}
+
+    std::shared_ptr<void> _mapping;
+};
+
+}  // namespace InferenceEngine
@@ -75,6 +75,7 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        int                _spinWait                = 0;  //!< Time in microseconds an idle stream thread polls task queues before it sleeps
 
         /**
          * @brief      A constructor with arguments
@@ -201,6 +201,16 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+// Normalization (out = (in - mean) * scale, converts to 32F)
+void normalizeRow_8U(const uint8_t in[], float out[], float mean, float scale, int length);
+void normalizeRow_16U(const uint16_t in[], float out[], float mean, float scale, int length);
+void normalizeRow_16S(const int16_t in[], float out[], float mean, float scale, int length);
+void normalizeRow_32F(const float in[], float out[], float mean, float scale, int length);
+
+// Mean image subtraction (out = (in - mean[]) * scale, converts to 32F)
+void subtractMeanRow_8U(const uint8_t in[], const float mean[], float out[], float scale, int length);
+void subtractMeanRow_32F(const float in[], const float mean[], float out[], float scale, int length);
+
 }  // namespace avx
 }  // namespace kernels
 }  // namespace gapi
@@ -149,6 +149,30 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void normalizeRow_8U(const uint8_t in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow_16U(const uint16_t in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow_16S(const int16_t in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow_32F(const float in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void subtractMeanRow_8U(const uint8_t in[], const float mean[], float out[], float scale, int length) {
+    subtractMeanRow_impl(in, mean, out, scale, length);
+}
+
+void subtractMeanRow_32F(const float in[], const float mean[], float out[], float scale, int length) {
+    subtractMeanRow_impl(in, mean, out, scale, length);
+}
+
 }  // namespace avx512
 }  // namespace kernels
 }  // namespace gapi
@@ -780,6 +780,8 @@ public:
 
     void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) override;
 
+    bool executeNormalized(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) override;
+
     void Release() noexcept override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
@@ -827,6 +829,11 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         return;
     }
 
+    if (_roiBlob->is<BatchedBlob>()) {
+        THROW_IE_EXCEPTION << "BatchedBlob pre-processing is unsupported in this mode. "
+                              "Use default pre-processing instead to process batched blobs.";
+    }
+
     if (batchSize > 1) {
         THROW_IE_EXCEPTION << "Batch pre-processing is unsupported in this mode. "
                               "Use default pre-processing instead to process batches.";
@@ -883,6 +890,27 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
     }
 }
 
+bool PreProcessData::executeNormalized(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial,
+        int batchSize) {
+    IE_PROFILING_AUTO_SCOPE_TASK(perf_preprocessing)
+
+    if (_roiBlob == nullptr) {
+        THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
+    }
+
+    if (!PreprocEngine::isNormalizationApplicable(_roiBlob, outBlob)) {
+        return false;
+    }
+
+    batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _roiBlob);
+
+    if (!_preproc) {
+        _preproc.reset(new PreprocEngine);
+    }
+    return _preproc->preprocessWithGAPI(_roiBlob, outBlob, info.getResizeAlgorithm(), info.getColorFormat(),
+                                        serial, batchSize, &info);
+}
+
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // if G-API pre-processing is used, let it check that pre-processing is applicable
     if (PreprocEngine::useGAPI()) {
@@ -890,6 +918,11 @@ void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
         return;
     }
 
+    if (src->is<BatchedBlob>()) {
+        THROW_IE_EXCEPTION << "Preprocessing is not applicable. BatchedBlob is supported by default "
+                              "pre-processing only";
+    }
+
     if (!src->is<MemoryBlob>() || !dst->is<MemoryBlob>()) {
         THROW_IE_EXCEPTION << "Preprocessing is not applicable. Source and destination blobs must "
                               "be memory blobs";
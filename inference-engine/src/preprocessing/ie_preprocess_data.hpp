@@ -55,6 +55,18 @@ public:
      */
     virtual void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
 
+    /**
+     * @brief Executes input pre-processing fused with the mean/scale normalization from the pre-processing
+     * information and the conversion of the input to FP32, so the input is processed in a single pass.
+     * If the ROI blob is not set, the blob to be normalized must be set with setRoiBlob().
+     * @param outBlob FP32 pre-processed output blob, it may share memory with the plugin's input tensor.
+     * @param info pre-processing info that specifies resize algorithm, color format, mean and scale values.
+     * @param serial disable OpenMP threading if the value set to true.
+     * @param batchSize batch size for pre-processing.
+     * @return false if the fused pre-processing is not applicable to the blobs, outBlob is not modified in this case.
+     */
+    virtual bool executeNormalized(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
+
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
 };
 
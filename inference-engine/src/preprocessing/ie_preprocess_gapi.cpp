@@ -75,6 +75,8 @@ namespace G {
 inline int get_cv_depth(const TensorDesc &ie_desc) {
     switch (ie_desc.getPrecision()) {
     case Precision::U8:   return CV_8U;
+    case Precision::U16:  return CV_16U;
+    case Precision::I16:  return CV_16S;
     case Precision::FP32: return CV_32F;
     default: THROW_IE_EXCEPTION << "Unsupported data type";
     }
@@ -535,6 +537,38 @@ convertColorPlanar(const std::vector<cv::GMat>& inputs,
     return planes;
 }
 
+// apply mean/scale normalization to planes, converting them to the network's precision
+std::vector<cv::GMat> normalize(const std::vector<cv::GMat>& planes,
+                                const std::vector<cv::GMat>& mean_planes,
+                                int precision,
+                                int out_precision,
+                                MeanVariant mean_variant,
+                                const std::vector<float>& means,
+                                const std::vector<float>& scales) {
+    const bool unit_scales = std::all_of(scales.begin(), scales.end(), [](float scale) { return scale == 1.f; });
+    if (mean_variant == NONE && unit_scales && precision == out_precision) {
+        return planes;
+    }
+
+    if (out_precision != CV_32F) {
+        THROW_IE_EXCEPTION << "[G-API] mean/scale normalization and precision conversion of the input "
+                           << "are supported only for FP32 network's input";
+    }
+
+    std::vector<cv::GMat> normalized;
+    normalized.reserve(planes.size());
+    for (size_t c = 0; c < planes.size(); c++) {
+        const float scale = scales.empty() ? 1.f : scales[c];
+        if (mean_variant == MEAN_IMAGE) {
+            normalized.emplace_back(gapi::SubtractMeanPlane::on(planes[c], mean_planes[c], scale));
+        } else {
+            const float mean = mean_variant == MEAN_VALUE ? means[c] : 0.f;
+            normalized.emplace_back(gapi::NormalizePlane::on(planes[c], mean, scale));
+        }
+    }
+    return normalized;
+}
+
 cv::GComputation buildGraph(const G::Desc &in_desc,
                             const G::Desc &out_desc,
                             Layout in_layout,
@@ -542,7 +576,11 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
                             ColorFormat output_color_format,
-                            int precision) {
+                            int precision,
+                            int out_precision,
+                            MeanVariant mean_variant,
+                            const std::vector<float>& means,
+                            const std::vector<float>& scales) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -554,6 +592,22 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         inputs.resize(in_desc.d.C);
     }
 
+    // mean image planes are passed to the graph as additional inputs, one per network's channel
+    std::vector<cv::GMat> mean_planes(mean_variant == MEAN_IMAGE ? out_desc.d.C : 0);
+    const auto graph_inputs = [&inputs, &mean_planes]() {
+        std::vector<cv::GMat> all_inputs(inputs);
+        all_inputs.insert(all_inputs.end(), mean_planes.begin(), mean_planes.end());
+        return all_inputs;
+    };
+
+    // resize kernels support only 8U and 32F data, so 16-bit input is converted first
+    std::vector<cv::GMat> sources = inputs;
+    if (precision == CV_16U || precision == CV_16S) {
+        std::transform(inputs.begin(), inputs.end(), sources.begin(),
+                       [](const cv::GMat& in) { return gapi::ConvertTo32F::on(in); });
+        precision = CV_32F;
+    }
+
     // specific pre-processing case:
     // 1. Requires interleaved image of type CV_8UC3/CV_8UC4 (except for NV12/I420 input)
     // 2. Supports bilinear resize only
@@ -602,16 +656,18 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             std::reverse(planes.begin(), planes.end());
         }
 
+        planes = normalize(planes, mean_planes, precision, out_precision, mean_variant, means, scales);
+
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
             outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
         } else {
             outputs = planes;
         }
-        return cv::GComputation(inputs, outputs);
+        return cv::GComputation(graph_inputs(), outputs);
     }
 
-    auto planes = convertColorPlanar(inputs, in_desc, in_layout, out_layout,
+    auto planes = convertColorPlanar(sources, in_desc, in_layout, out_layout,
         input_color_format, output_color_format, algorithm);
 
     const int number_of_planes = static_cast<int>(planes.size());
@@ -645,12 +701,54 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
+    outputs = normalize(outputs, mean_planes, precision, out_precision, mean_variant, means, scales);
+
     // convert to interleaved if NHWC is required as output
     if (out_layout == NHWC) {
         outputs = merge(outputs, out_desc.d.C);
     }
 
-    return cv::GComputation(inputs, outputs);
+    return cv::GComputation(graph_inputs(), outputs);
+}
+
+// mean variant, per-channel mean values and per-channel scales of the pre-processing info
+std::tuple<MeanVariant, std::vector<float>, std::vector<float>> get_norm_desc(const PreProcessInfo* norm_info,
+                                                                              const G::Desc &out_desc) {
+    std::tuple<MeanVariant, std::vector<float>, std::vector<float>> norm{MeanVariant::NONE, {}, {}};
+    if (norm_info != nullptr && norm_info->getNumberOfChannels() != 0) {
+        const auto channels = norm_info->getNumberOfChannels();
+        if (channels != static_cast<size_t>(out_desc.d.C)) {
+            THROW_IE_EXCEPTION << "Number of channels in the pre-processing info " << channels
+                               << " != " << out_desc.d.C << " (expected by network)";
+        }
+        std::get<0>(norm) = norm_info->getMeanVariant();
+        for (size_t c = 0; c < channels; c++) {
+            const auto& channel = (*norm_info)[c];
+            if (std::get<0>(norm) == MEAN_VALUE) {
+                std::get<1>(norm).push_back(channel->meanValue);
+            }
+            std::get<2>(norm).push_back(channel->stdScale);
+        }
+    }
+    return norm;
+}
+
+// mean image planes are passed to the graph as additional inputs
+std::vector<cv::gapi::own::Mat> bind_mean_planes(const PreProcessInfo& norm_info, const G::Desc &out_desc) {
+    const auto plane_size = cv::gapi::own::Size(out_desc.d.W, out_desc.d.H);
+    std::vector<cv::gapi::own::Mat> mean_planes;
+    for (int c = 0; c < out_desc.d.C; c++) {
+        const auto& mean_blob = norm_info[c]->meanData;
+        if (!mean_blob || mean_blob->getTensorDesc().getPrecision() != Precision::FP32 ||
+            mean_blob->size() != static_cast<size_t>(plane_size.width) * plane_size.height) {
+            THROW_IE_EXCEPTION << "Mean image for channel " << c << " is not provided, not in FP32 "
+                               << "or its size does not match network's input size "
+                               << plane_size.width << "x" << plane_size.height;
+        }
+        mean_planes.emplace_back(plane_size.height, plane_size.width, CV_32FC1,
+                                 static_cast<float*>(mean_blob->buffer()), plane_size.width * sizeof(float));
+    }
+    return mean_planes;
 }
 }  // anonymous namespace
 
@@ -665,6 +763,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
+    // 6. normalization has changed (mean values and scales are kernel parameters)
     if (!_lastCall) {
         return Update::REBUILD;
     }
@@ -672,13 +771,15 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    NormDesc last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = *_lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    NormDesc new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -694,7 +795,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -739,10 +840,11 @@ bool PreprocEngine::useGAPI() {
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
-    // src is either a memory blob, an NV12, or an I420 blob
+    // src is either a memory blob, an NV12, an I420 or a batched blob
     const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
-    if (!src->is<MemoryBlob>() && !yuv420_blob) {
-        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob or I420Blob";
+    const bool batched_blob = src->is<BatchedBlob>();
+    if (!src->is<MemoryBlob>() && !yuv420_blob && !batched_blob) {
+        THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob, I420Blob or BatchedBlob";
     }
 
     // dst is always a memory blob
@@ -750,9 +852,33 @@ void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr
         THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
     }
 
-    const auto &src_dims = src->getTensorDesc().getDims();
     const auto &dst_dims = dst->getTensorDesc().getDims();
 
+    if (batched_blob) {
+        // every image is a memory blob of the network's number of dimensions with batch 1, which is
+        // checked when the batched blob is created
+        if (dst_dims.size() != 4) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Only 4D tensors are supported.";
+        }
+        if (src->size() != dst_dims[0]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Number of images in the batched blob "
+                               << src->size() << " != " << dst_dims[0] << " (network's batch size)";
+        }
+        auto batched = as<BatchedBlob>(src);
+        for (size_t i = 0; i < batched->size(); i++) {
+            const auto &image_dims = batched->getBlob(i)->getTensorDesc().getDims();
+            if (has_zeros(image_dims)) {
+                THROW_IE_EXCEPTION << "Invalid input data dimensions: " << details::dumpVec(image_dims);
+            }
+        }
+        if (has_zeros(dst_dims)) {
+            THROW_IE_EXCEPTION << "Invalid network's input dimensions: " << details::dumpVec(dst_dims);
+        }
+        return;
+    }
+
+    const auto &src_dims = src->getTensorDesc().getDims();
+
     // dimensions sizes must be equal if both blobs are memory blobs
     if (!yuv420_blob && src_dims.size() != dst_dims.size()) {
         THROW_IE_EXCEPTION << "Preprocessing is not applicable. Source and destination blobs "
@@ -772,12 +898,47 @@ void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr
     }
 }
 
+bool PreprocEngine::isNormalizationApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
+    if (!useGAPI()) {
+        return false;
+    }
+
+    const auto supported_src_precision = [](const Precision& p) {
+        return p == Precision::U8 || p == Precision::U16 || p == Precision::I16 || p == Precision::FP32;
+    };
+    const auto& src_desc = src->getTensorDesc();
+    const auto& dst_desc = dst->getTensorDesc();
+    const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
+    // batched blob has the precision of its images
+    const bool memory_blob = src->is<MemoryBlob>() || src->is<BatchedBlob>();
+    if (!yuv420_blob && (!memory_blob || !supported_src_precision(src_desc.getPrecision()))) {
+        return false;
+    }
+
+    // interleaved output is produced by Merge kernels, which support up to 4 channels
+    const auto& dst_dims = dst_desc.getDims();
+    return dst->is<MemoryBlob>()
+        && dst_desc.getPrecision() == Precision::FP32
+        && dst_dims.size() == 4
+        && (dst_desc.getLayout() == NCHW || (dst_desc.getLayout() == NHWC && dst_dims[1] <= 4));
+}
+
 int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     if (batch == 0) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (blob->is<BatchedBlob>()) {
+        // batched blob holds one image per batch item
+        const auto images = static_cast<int>(blob->size());
+        if (batch > images) {
+            THROW_IE_EXCEPTION  << "Provided batch size " << batch << " is greater than the number of images "
+                                << images << " in the batched blob";
+        }
+        if (batch < 0) {
+            batch = images;
+        }
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
@@ -876,7 +1037,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const PreProcessInfo* norm_info) {
 
     validateBlob(inBlob);
 
@@ -910,6 +1071,8 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                             << batch_size << " > " << out_desc.d.N << " (expected by network)";
     }
 
+    const NormDesc norm = get_norm_desc(norm_info, out_desc);
+
     CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
                                             in_layout,
                                             in_desc_ie.getDims(),
@@ -918,7 +1081,8 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  norm };
     const Update update = needUpdate(thisCall);
 
     Opt<cv::GComputation> _lastComputation;
@@ -938,21 +1102,155 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            algorithm,
                            in_fmt,
                            out_fmt,
-                           get_cv_depth(in_desc_ie)));
+                           get_cv_depth(in_desc_ie),
+                           get_cv_depth(out_desc_ie),
+                           std::get<0>(norm),
+                           std::get<1>(norm),
+                           std::get<2>(norm)));
         }
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
+    if (std::get<0>(norm) == MEAN_IMAGE) {
+        // mean image planes are the same for all images in batch
+        const auto mean_planes = bind_mean_planes(*norm_info, out_desc);
+        for (auto& input_plane_mats : batched_input_plane_mats) {
+            input_plane_mats.insert(input_plane_mats.end(), mean_planes.begin(), mean_planes.end());
+        }
+    }
+
     executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 
     return true;
 }
 
+bool PreprocEngine::preprocessBatch(const BatchedBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+    int batch_size, const PreProcessInfo* norm_info) {
+
+    const auto& out_desc_ie = outBlob->getTensorDesc();
+    validateTensorDesc(out_desc_ie);
+
+    const auto out_layout = out_desc_ie.getLayout();
+    const G::Desc out_desc = G::decompose(out_desc_ie);
+
+    if (inBlob->size() != static_cast<size_t>(out_desc.d.N)) {
+        THROW_IE_EXCEPTION  << "Number of images in the batched blob is invalid: (input blob) "
+                            << inBlob->size() << " != " << out_desc.d.N << " (expected by network)";
+    }
+
+    const NormDesc norm = get_norm_desc(norm_info, out_desc);
+    std::vector<cv::gapi::own::Mat> mean_planes;
+    if (std::get<0>(norm) == MEAN_IMAGE) {
+        mean_planes = bind_mean_planes(*norm_info, out_desc);
+    }
+
+    // Find (or build) the graph for every image before the parallel section, so threads only
+    // compile or reshape their own copies of the graphs
+    std::vector<size_t> graph_ids(batch_size);
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        auto image = as<MemoryBlob>(inBlob->getBlob(i));
+        const auto& in_desc_ie = image->getTensorDesc();
+        validateTensorDesc(in_desc_ie);
+        const G::Desc in_desc = G::decompose(in_desc_ie);
+
+        CallDesc call = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
+                                            in_desc_ie.getLayout(),
+                                            SizeVector{},
+                                            in_fmt },
+                                  BlobDesc{ out_desc_ie.getPrecision(),
+                                            out_layout,
+                                            out_desc_ie.getDims(),
+                                            out_fmt },
+                                  algorithm,
+                                  norm };
+        const bool upscale = algorithm == RESIZE_AREA
+            && (in_desc.d.H < out_desc.d.H || in_desc.d.W < out_desc.d.W);
+
+        auto graph = std::find_if(_batchGraphs.begin(), _batchGraphs.end(), [&](const BatchGraph& g) {
+            return g.upscale == upscale && g.call == call;
+        });
+        if (graph == _batchGraphs.end()) {
+            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
+            auto computation = buildGraph(in_desc,
+                                          out_desc,
+                                          in_desc_ie.getLayout(),
+                                          out_layout,
+                                          algorithm,
+                                          in_fmt,
+                                          out_fmt,
+                                          get_cv_depth(in_desc_ie),
+                                          get_cv_depth(out_desc_ie),
+                                          std::get<0>(norm),
+                                          std::get<1>(norm),
+                                          std::get<2>(norm));
+            _batchGraphs.push_back(BatchGraph{ std::move(call), upscale, std::move(computation), {} });
+            graph = std::prev(_batchGraphs.end());
+        }
+        graph_ids[i] = static_cast<size_t>(std::distance(_batchGraphs.begin(), graph));
+
+        batched_input_plane_mats[i] = std::move(bind_to_blob(image, 1)[0]);
+        batched_input_plane_mats[i].insert(batched_input_plane_mats[i].end(), mean_planes.begin(), mean_planes.end());
+    }
+
+    auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        parallel_get_max_threads();  // use all available threads
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    // every thread compiles its own copy of a graph, the number of threads may change between calls
+    for (auto graph_id : graph_ids) {
+        auto& compiled = _batchGraphs[graph_id].compiled;
+        if (compiled.size() < static_cast<size_t>(thread_num))
+            compiled.resize(thread_num);
+    }
+
+    // Unlike executeGraph(), every image is processed as a whole by one thread: images are
+    // distributed among threads, so no per-slice compilation is needed for a new image size
+    parallel_nt_static(thread_num, [&, this](int ithr, const int nthr) {
+        for (int i = ithr; i < batch_size; i += nthr) {
+            IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_image);
+
+            auto& graph = _batchGraphs[graph_ids[i]];
+            auto& compiled = graph.compiled[ithr];
+            const auto& input_plane_mats = batched_input_plane_mats[i];
+            auto& output_plane_mats = batched_output_plane_mats[i];
+
+            auto metas = descrs_of(input_plane_mats);
+            if (!compiled) {
+                IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
+                compiled = graph.computation.compile(std::move(metas), cv::compile_args(gapi::preprocKernels()));
+            } else if (compiled.metas() != metas) {
+                IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
+                compiled.reshape(metas, cv::compile_args(gapi::preprocKernels()));
+            }
+
+            cv::GRunArgs call_ins;
+            cv::GRunArgsP call_outs;
+            for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
+            for (auto & m : output_plane_mats) { call_outs.emplace_back(&m);}
+
+            IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_graph);
+            compiled(std::move(call_ins), std::move(call_outs));
+        }
+    });
+
+    return true;
+}
+
 bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const PreProcessInfo* norm_info) {
     if (!useGAPI()) {
         return false;
     }
@@ -965,6 +1263,15 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
         THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
     }
 
+    if (auto inBatchedBlob = as<BatchedBlob>(inBlob)) {
+        if (in_fmt == ColorFormat::NV12 || in_fmt == ColorFormat::I420) {
+            THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
+                                << ": BatchedBlob of NV12/I420 images is not supported";
+        }
+        return preprocessBatch(inBatchedBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            batch_size, norm_info);
+    }
+
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
     // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
@@ -976,7 +1283,7 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, norm_info);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -985,7 +1292,7 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, norm_info);
     }
 
     default:
@@ -995,7 +1302,7 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, norm_info);
     }
 }
 }  // namespace InferenceEngine
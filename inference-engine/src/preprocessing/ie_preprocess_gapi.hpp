@@ -22,7 +22,9 @@ namespace InferenceEngine {
 
 class PreprocEngine {
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    // mean variant, per-channel mean values and per-channel scales
+    using NormDesc = std::tuple<MeanVariant, std::vector<float>, std::vector<float>>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, NormDesc>;
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
@@ -32,6 +34,18 @@ class PreprocEngine {
     ProfilingTask _perf_exec_tile  {"Preproc Calc Tile"};
     ProfilingTask _perf_exec_graph {"Preproc Exec Graph"};
     ProfilingTask _perf_graph_compiling {"Preproc Graph compiling"};
+    ProfilingTask _perf_exec_image {"Preproc Exec Image"};
+
+    // Graphs for batched blobs are built once per call description without input dimensions,
+    // so images of any size reuse them. Compiled objects are per thread and reshaped to the size
+    // of the image being processed.
+    struct BatchGraph {
+        CallDesc call;
+        bool upscale;  // AREA interpolation uses different kernels for upscale and downscale
+        cv::GComputation computation;
+        std::vector<cv::GCompiled> compiled;  // indexed by the thread number, resized before every run
+    };
+    std::vector<BatchGraph> _batchGraphs;
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
@@ -46,15 +60,28 @@ class PreprocEngine {
     template<typename BlobTypePtr>
     bool preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, const PreProcessInfo* norm_info);
+
+    bool preprocessBatch(const BatchedBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+        int batch_size, const PreProcessInfo* norm_info);
 
 public:
     PreprocEngine();
     static bool useGAPI();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
+    static bool isNormalizationApplicable(const Blob::Ptr &src, const Blob::Ptr &dst);
+    /**
+     * @brief Pre-processes the input with G-API
+     * @param inBlob Input blob, if it is a BatchedBlob, every image is resized into the corresponding
+     * item of outBlob and the images are processed in parallel
+     * @param norm_info If set, the mean/scale normalization is fused into the same pass, and the output
+     * is converted to the precision of outBlob, which must be FP32 in this case
+     * @return false if G-API pre-processing is disabled
+     */
     bool preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1, const PreProcessInfo* norm_info = nullptr);
 };
 
 }  // namespace InferenceEngine
@@ -2014,6 +2014,203 @@ GAPI_FLUID_KERNEL(FI420toRGB, I420toRGB, false) {
         calculate_i420_to_rgb_fallback(y_rows, u_row, v_row, out_rows, buf_width);
     }
 };
+
+//----------------------------------------------------------------------
+
+// out = (in - mean) * scale, the reference code matches the vectorized one: in * scale + shift
+template<typename T>
+static void normalizeRowRef(const T in[], float out[], float mean, float scale, int length) {
+    const float shift = -mean * scale;
+    for (int l = 0; l < length; l++) {
+        out[l] = static_cast<float>(in[l]) * scale + shift;
+    }
+}
+
+static void normalizeRow(const uint8_t in[], float out[], float mean, float scale, int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::normalizeRow_8U(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX512
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::normalizeRow_8U(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        normalizeRow_8U(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+    normalizeRowRef(in, out, mean, scale, length);
+}
+
+static void normalizeRow(const uint16_t in[], float out[], float mean, float scale, int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::normalizeRow_16U(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX512
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::normalizeRow_16U(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        normalizeRow_16U(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+    normalizeRowRef(in, out, mean, scale, length);
+}
+
+static void normalizeRow(const int16_t in[], float out[], float mean, float scale, int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::normalizeRow_16S(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX512
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::normalizeRow_16S(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        normalizeRow_16S(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+    normalizeRowRef(in, out, mean, scale, length);
+}
+
+static void normalizeRow(const float in[], float out[], float mean, float scale, int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::normalizeRow_32F(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX512
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::normalizeRow_32F(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        normalizeRow_32F(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+    normalizeRowRef(in, out, mean, scale, length);
+}
+
+template<typename T>
+static void normalizeRow(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer& out,
+                         float mean, float scale, int length) {
+    normalizeRow(in.InLine<T>(0), out.OutLine<float>(), mean, scale, length);
+}
+
+template<typename T>
+static void subtractMeanRowRef(const T in[], const float mean[], float out[], float scale, int length) {
+    for (int l = 0; l < length; l++) {
+        out[l] = (static_cast<float>(in[l]) - mean[l]) * scale;
+    }
+}
+
+template<typename T>
+static void subtractMeanRow(const T in[], const float mean[], float out[], float scale, int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx512::subtractMeanRow_8U(reinterpret_cast<const uint8_t*>(in), mean, out, scale, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::subtractMeanRow_32F(reinterpret_cast<const float*>(in), mean, out, scale, length);
+            return;
+        }
+    }
+    #endif  // HAVE_AVX512
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx::subtractMeanRow_8U(reinterpret_cast<const uint8_t*>(in), mean, out, scale, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::subtractMeanRow_32F(reinterpret_cast<const float*>(in), mean, out, scale, length);
+            return;
+        }
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (std::is_same<T, uint8_t>::value) {
+            subtractMeanRow_8U(reinterpret_cast<const uint8_t*>(in), mean, out, scale, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            subtractMeanRow_32F(reinterpret_cast<const float*>(in), mean, out, scale, length);
+            return;
+        }
+    }
+    #endif  // HAVE_SSE
+    subtractMeanRowRef(in, mean, out, scale, length);
+}
+
+GAPI_FLUID_KERNEL(FConvertTo32F, ConvertTo32F, false) {
+    static const int Window = 1;
+    static void run(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer& out) {
+        // conversion does not depend on the channel, so interleaved rows are processed as a whole
+        const int length = in.length() * in.meta().chan;
+        switch (in.meta().depth) {
+        case CV_8U:  normalizeRow<uint8_t> (in, out, 0.f, 1.f, length); break;
+        case CV_16U: normalizeRow<uint16_t>(in, out, 0.f, 1.f, length); break;
+        case CV_16S: normalizeRow<int16_t> (in, out, 0.f, 1.f, length); break;
+        case CV_32F: normalizeRow<float>   (in, out, 0.f, 1.f, length); break;
+        default: GAPI_Assert(!"unsupported input depth");
+        }
+    }
+};
+
+GAPI_FLUID_KERNEL(FNormalizePlane, NormalizePlane, false) {
+    static const int Window = 1;
+    static void run(const cv::gapi::fluid::View& in, float mean, float scale,
+                    cv::gapi::fluid::Buffer& out) {
+        switch (in.meta().depth) {
+        case CV_8U:  normalizeRow<uint8_t> (in, out, mean, scale, in.length()); break;
+        case CV_16U: normalizeRow<uint16_t>(in, out, mean, scale, in.length()); break;
+        case CV_16S: normalizeRow<int16_t> (in, out, mean, scale, in.length()); break;
+        case CV_32F: normalizeRow<float>   (in, out, mean, scale, in.length()); break;
+        default: GAPI_Assert(!"unsupported input depth");
+        }
+    }
+};
+
+GAPI_FLUID_KERNEL(FSubtractMeanPlane, SubtractMeanPlane, false) {
+    static const int Window = 1;
+    static void run(const cv::gapi::fluid::View& in, const cv::gapi::fluid::View& mean, float scale,
+                    cv::gapi::fluid::Buffer& out) {
+        if (in.meta().depth == CV_8U) {
+            subtractMeanRow(in.InLine<uint8_t>(0), mean.InLine<float>(0), out.OutLine<float>(), scale, in.length());
+        } else {
+            subtractMeanRow(in.InLine<float>(0), mean.InLine<float>(0), out.OutLine<float>(), scale, in.length());
+        }
+    }
+};
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2040,6 +2237,9 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FSplit4
         , FNV12toRGB
         , FI420toRGB
+        , FConvertTo32F
+        , FNormalizePlane
+        , FSubtractMeanPlane
         >();
 }
 
@@ -143,6 +143,32 @@ namespace gapi {
         }
     };
 
+    G_TYPED_KERNEL(ConvertTo32F, <cv::GMat(cv::GMat)>, "com.intel.ie.convert_to_32f") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc &in) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_16S || in.depth == CV_32F);
+            return in.withType(CV_32F, in.chan);
+        }
+    };
+
+    G_TYPED_KERNEL(NormalizePlane, <cv::GMat(cv::GMat, float, float)>, "com.intel.ie.normalize_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc &in, float /*mean*/, float /*scale*/) {
+            GAPI_Assert(in.chan == 1);
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_16S || in.depth == CV_32F);
+            return in.withType(CV_32F, 1);
+        }
+    };
+
+    G_TYPED_KERNEL(SubtractMeanPlane, <cv::GMat(cv::GMat, cv::GMat, float)>, "com.intel.ie.subtract_mean_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc &in, const cv::GMatDesc &mean, float /*scale*/) {
+            GAPI_Assert(in.chan == 1 && mean.chan == 1);
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(mean.depth == CV_32F);
+            // mean image must be of the network's input size
+            GAPI_Assert(in.size == mean.size);
+            return in.withType(CV_32F, 1);
+        }
+    };
+
     cv::gapi::GKernelPackage preprocKernels();
 
 }  // namespace gapi
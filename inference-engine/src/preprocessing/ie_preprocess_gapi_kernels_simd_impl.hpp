@@ -783,6 +783,77 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+#if MANUAL_SIMD
+inline v_float32 vx_load_f32(const uint8_t in[]) {
+    return v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(in)));
+}
+
+inline v_float32 vx_load_f32(const uint16_t in[]) {
+    return v_cvt_f32(v_reinterpret_as_s32(vx_load_expand(in)));
+}
+
+inline v_float32 vx_load_f32(const int16_t in[]) {
+    return v_cvt_f32(vx_load_expand(in));
+}
+
+inline v_float32 vx_load_f32(const float in[]) {
+    return vx_load(in);
+}
+#endif
+
+// out = (in - mean) * scale, computed as in * scale + shift with a separate multiply and add
+// like normalizeRowRef() does, rather than with v_fma
+template<typename T>
+inline void normalizeRow_impl(const T in[], float out[], float mean, float scale, int length) {
+    const float shift = -mean * scale;
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vscale = vx_setall_f32(scale);
+    const v_float32 vshift = vx_setall_f32(shift);
+
+    cycle:
+    for (; l <= length - nlanes; l += nlanes) {
+        vx_store(&out[l], vx_load_f32(&in[l]) * vscale + vshift);
+    }
+
+    if (l < length && length >= nlanes) {
+        l = length - nlanes;
+        goto cycle;
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = static_cast<float>(in[l]) * scale + shift;
+    }
+}
+
+// out = (in - mean[]) * scale
+template<typename T>
+inline void subtractMeanRow_impl(const T in[], const float mean[], float out[], float scale, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    cycle:
+    for (; l <= length - nlanes; l += nlanes) {
+        vx_store(&out[l], (vx_load_f32(&in[l]) - vx_load(&mean[l])) * vscale);
+    }
+
+    if (l < length && length >= nlanes) {
+        l = length - nlanes;
+        goto cycle;
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (static_cast<float>(in[l]) - mean[l]) * scale;
+    }
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
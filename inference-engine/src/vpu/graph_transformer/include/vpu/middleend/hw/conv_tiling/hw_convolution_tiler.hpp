@@ -7,6 +7,8 @@
 #include <utility>
 #include <memory>
 #include <list>
+#include <map>
+#include <mutex>
 #include <string>
 #include <limits>
 #include <algorithm>
@@ -38,15 +40,19 @@ struct ConvolutionOptions final {
 
     const bool _withPool;
 
+    // is taken from CompileEnv by the caller, so the tiling can be done outside of the compilation thread
+    const int _numCMXSlices;
+
 public:
     ConvolutionOptions(std::string stageName, const DimValues& inputDims, const DimValues& outputDims,
                        const DimValues& origOutputDims, int kernelSizeX, int kernelSizeY,
                        int kernelStride, int paddingLeft, int paddingRight,
-                       int paddingTop, int paddingBottom, bool withPool)
+                       int paddingTop, int paddingBottom, bool withPool, int numCMXSlices)
             : _stageName(std::move(stageName)), _inputDims(inputDims), _outputDims(outputDims),
               _origOutputDims(origOutputDims), _kernelSizeX(kernelSizeX), _kernelSizeY(kernelSizeY),
               _kernelStride(kernelStride), _paddingLeft(paddingLeft), _paddingRight(paddingRight),
-              _paddingTop(paddingTop), _paddingBottom(paddingBottom), _withPool(withPool) {}
+              _paddingTop(paddingTop), _paddingBottom(paddingBottom), _withPool(withPool),
+              _numCMXSlices(numCMXSlices) {}
 };
 
 struct TilingOption final {
@@ -65,6 +71,24 @@ enum class Direction {
     INPUT_TO_OUTPUT = 0, OUTPUT_TO_INPUT = 1
 };
 
+// The tiling search depends on the convolution parameters only (not on the stage), so its results are
+// reused by the identical convolutions of a single compilation. Is shared by the threads tiling the stages.
+class TilingCache final {
+public:
+    using Key = std::vector<int>;
+
+    bool find(const Key& key, std::vector<TilingOption>& tilingOptions);
+
+    void insert(Key key, std::vector<TilingOption> tilingOptions);
+
+    std::size_t hits() const;
+
+private:
+    mutable std::mutex _mutex;
+    std::map<Key, std::vector<TilingOption>> _tilingOptions;
+    std::size_t _hits = 0;
+};
+
 // Tensors can be split going either from input to output or vice versa
 class GraphDataTiling {
 public:
@@ -139,16 +163,18 @@ public:
     HWConvolutionTilingSearcher(const HWConvolutionTilingSearcher& other):
         _convolutionOptions(other._convolutionOptions),
         _maxTilingOptions(other._maxTilingOptions),
+        _cache(other._cache),
         _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(*other._dirTiling)),
         _tilingOptions(other._tilingOptions) {}
     HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
-                                std::size_t maxTilingOptions) :
+                                std::size_t maxTilingOptions, TilingCache* cache = nullptr) :
         _convolutionOptions(std::move(convolutionOptions)),
-        _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)),
-        _maxTilingOptions(maxTilingOptions) {
+        _maxTilingOptions(maxTilingOptions),
+        _cache(cache),
+        _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)) {
             IE_ASSERT(maxTilingOptions > 0);
             _dirTiling->initTileSizes();
-            _tilingOptions = selectBetterTiling();
+            _tilingOptions = cachedBetterTiling();
         }
 
     const std::vector<TilingOption>& tilingOptions() const {
@@ -162,8 +188,12 @@ public:
 private:
     std::vector<TilingOption> selectBetterTiling() const;
 
+    // looks the options up in the cache if it is given, searches them otherwise
+    std::vector<TilingOption> cachedBetterTiling() const;
+
     const ConvolutionOptions _convolutionOptions;
     const std::size_t _maxTilingOptions;
+    TilingCache* const _cache;
     const std::unique_ptr<GraphDataTiling> _dirTiling;
     std::vector<TilingOption> _tilingOptions;
 };
@@ -173,7 +203,8 @@ class HWConvolutionTiler final {
 public:
     HWConvolutionTiler() = delete;
     HWConvolutionTiler(const HWConvolutionTiler&) = default;
-    HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::size_t maxTilingOptions);
+    HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::size_t maxTilingOptions,
+                       TilingCache* cache = nullptr);
 
 
     bool isTilingPossible() const {
@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include <utility>
@@ -257,9 +259,9 @@ public:
 };
 
 HWConvolutionTiler::HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction,
-                                       std::size_t maxTilingOptions) :
+                                       std::size_t maxTilingOptions, TilingCache* cache) :
     _convolutionOptions(std::move(convolutionOptions)),
-    _searcher(_convolutionOptions, direction, maxTilingOptions) {
+    _searcher(_convolutionOptions, direction, maxTilingOptions, cache) {
     _tilingPossible = tileForHW();
 }
 
@@ -325,7 +327,7 @@ bool GraphDataTiling::ceilNeeded() const {
 bool GraphDataTiling::patternMatching() {
     // All optimizations below are for MiryadX code with 2 threads, so at least 9 slices is required.
     // TODO: check 1-thread perfomance and replace with exact equality check.
-    if (CompileEnv::get().resources.numCMXSlices < 9) {
+    if (_convolutionOptions._numCMXSlices < 9) {
         return false;
     }
 
@@ -618,8 +620,6 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
 std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
-    const auto& env = CompileEnv::get();
-
     auto& dirTiling = *_dirTiling;
     FixedMaxHeap<TilingOption> tilingOptions(_maxTilingOptions);
 
@@ -641,7 +641,7 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
     const auto& splitOver = dirTiling.splitOverTensorDims();
     const auto direction = dirTiling.getDirection();
 
-    const auto cmxLimit = tilingCMXLimit(env.resources.numCMXSlices);
+    const auto cmxLimit = tilingCMXLimit(_convolutionOptions._numCMXSlices);
 
     // split over Input tensor for the Channel dimension always
     for (int numChannelTiles = 1; numChannelTiles <= maxNumChannelTiles; numChannelTiles++) {
@@ -838,6 +838,72 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
     return tilingOptions.sorted();
 }
 
+bool TilingCache::find(const Key& key, std::vector<TilingOption>& tilingOptions) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _tilingOptions.find(key);
+    if (it == _tilingOptions.end()) {
+        return false;
+    }
+    tilingOptions = it->second;
+    ++_hits;
+    return true;
+}
+
+void TilingCache::insert(Key key, std::vector<TilingOption> tilingOptions) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tilingOptions.emplace(std::move(key), std::move(tilingOptions));
+}
+
+std::size_t TilingCache::hits() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hits;
+}
+
+namespace {
+
+TilingCache::Key makeTilingCacheKey(const ConvolutionOptions& options, Direction direction, std::size_t maxTilingOptions) {
+    TilingCache::Key key;
+
+    const auto addDims = [&key](const DimValues& dims) {
+        key.push_back(static_cast<int>(dims.size()));
+        for (const auto& dim : dims) {
+            key.push_back(static_cast<int>(dim.first));
+            key.push_back(dim.second);
+        }
+    };
+    addDims(options._inputDims);
+    addDims(options._outputDims);
+    addDims(options._origOutputDims);
+
+    key.insert(key.end(), {
+        options._kernelSizeX, options._kernelSizeY, options._kernelStride,
+        options._paddingLeft, options._paddingRight, options._paddingTop, options._paddingBottom,
+        static_cast<int>(options._withPool), options._numCMXSlices,
+        static_cast<int>(direction), static_cast<int>(maxTilingOptions)});
+
+    return key;
+}
+
+}  // namespace
+
+std::vector<TilingOption> HWConvolutionTilingSearcher::cachedBetterTiling() const {
+    if (_cache == nullptr) {
+        return selectBetterTiling();
+    }
+
+    auto key = makeTilingCacheKey(_convolutionOptions, _dirTiling->getDirection(), _maxTilingOptions);
+
+    std::vector<TilingOption> tilingOptions;
+    if (_cache->find(key, tilingOptions)) {
+        return tilingOptions;
+    }
+
+    // the cache is not locked during the search, so different stages are tiled concurrently
+    tilingOptions = selectBetterTiling();
+    _cache->insert(std::move(key), tilingOptions);
+    return tilingOptions;
+}
+
 HWConvolutionTileLayoutCut HWConvolutionTilingSearcher::tileLayoutCut(const TilingOption& option) const {
     return HWConvolutionTileLayoutCut(*_dirTiling, option);
 }
@@ -297,8 +297,6 @@ std::unique_ptr<GraphDataTiling> PoolGraphDataTilingFactory::makeDirTiling(const
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
 std::vector<TilingOption> HWPoolingTilingSearcher::selectBetterTiling() const {
-    const auto& env = CompileEnv::get();
-
     auto& dirTiling = *_dirTiling;
     FixedMaxHeap<TilingOption> tilingOptions(_maxTilingOptions);
 
@@ -316,7 +314,7 @@ std::vector<TilingOption> HWPoolingTilingSearcher::selectBetterTiling() const {
     const auto& splitOver = dirTiling.splitOverTensorDims();
     const auto direction = dirTiling.getDirection();
 
-    const auto cmxLimit = tilingCMXLimit(env.resources.numCMXSlices);
+    const auto cmxLimit = tilingCMXLimit(_convolutionOptions._numCMXSlices);
 
     for (int numBatchTiles = 1; numBatchTiles <= maxNumBatchTiles; numBatchTiles++) {
         //
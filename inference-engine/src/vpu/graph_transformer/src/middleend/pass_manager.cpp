@@ -48,7 +48,13 @@ void PassSet::run(const Model& model) const {
 
         model->cleanUp();
 
-        p.first->run(model);
+        {
+#ifdef ENABLE_PROFILING_RAW
+            // Reports the time of every pass in the profiling output, the passes are nested into the MiddleEnd section
+            Profiler::Section passSection(p.second);
+#endif
+            p.first->run(model);
+        }
 
         auto endTime = std::chrono::high_resolution_clock::now();
 
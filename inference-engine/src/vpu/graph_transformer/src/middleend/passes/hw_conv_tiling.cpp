@@ -5,9 +5,12 @@
 #include <vpu/middleend/pass_manager.hpp>
 
 #include <precision_utils.h>
+#include <ie_parallel.hpp>
+#include <exception>
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -31,9 +34,65 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+// The result of the tiling search for one stage
+struct StageTiling final {
+    std::vector<HwConvTilingPtr> hwTilings;
+    bool withPool;
+};
+
+HWTilingNS::ConvolutionOptions makeConvolutionOptions(const Stage& origStage,
+                                                      const HWConvStageOptions& stageOptions,
+                                                      const HWConvStageIO& stageIO,
+                                                      const DimValues& outputDims,
+                                                      bool withPool) {
+    return HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        outputDims,
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        withPool,
+        CompileEnv::get().resources.numCMXSlices
+    };
+}
+
+// Doesn't touch the model, so it is called for different stages in parallel
+StageTiling tileStage(const HWTilingNS::ConvolutionOptions& convolutionOptions,
+                      const HWTilingNS::ConvolutionOptions& optionsWithoutPool,
+                      HWTilingNS::TilingCache& cache) {
+    //
+    // Try to find "best" tiling
+    //
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount, &cache);
+
+    if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
+        const HWTilingNS::HWConvolutionTiler tiler(optionsWithoutPool, direction, tilingsCount, &cache);
+        return StageTiling{tiler.getHwTilings(), tiler.withPool()};
+    }
+
+    return StageTiling{tiler1stAttempt.getHwTilings(), tiler1stAttempt.withPool()};
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const auto& env = CompileEnv::get();
+
+    StageVector origStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionOptions;
+    std::vector<HWTilingNS::ConvolutionOptions> optionsWithoutPool;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -47,64 +106,53 @@ void PassImpl::run(const Model& model) {
         const HWConvStageOptions stageOptions(origStage);
         const HWConvStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Unsupported paddings
-        //
+        origStages.push_back(origStage);
+        convolutionOptions.push_back(makeConvolutionOptions(
+            origStage, stageOptions, stageIO, stageIO.origOutput->desc().dims(), stageOptions.withPool));
+        optionsWithoutPool.push_back(makeConvolutionOptions(
+            origStage, stageOptions, stageIO, stageIO.origOutputDesc.dims(), false));
+    }
 
-        //
-        // Try to find "best" tiling
-        //
+    //
+    // Search tilings for all the stages in parallel, the exceptions are rethrown in the compilation thread
+    //
+
+    std::vector<StageTiling> stageTilings(origStages.size(), StageTiling{{}, false});
+    {
+        VPU_PROFILE(hwConvTilingSearch);
+
+        // lives as long as the pass, so the identical convolutions of this model reuse the search results
+        HWTilingNS::TilingCache cache;
+        std::vector<std::exception_ptr> errors(origStages.size());
+        ie::parallel_for(origStages.size(), [&](size_t ind) {
+            try {
+                stageTilings[ind] = tileStage(convolutionOptions[ind], optionsWithoutPool[ind], cache);
+            } catch (...) {
+                errors[ind] = std::current_exception();
+            }
+        });
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
-
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
             }
-        }();
+        }
+    }
+
+    env.log->trace("Found HW tilings for %d convolution stages", origStages.size());
+
+    for (size_t stageInd = 0; stageInd < origStages.size(); ++stageInd) {
+        const auto& origStage = origStages[stageInd];
+        const auto& tiling = stageTilings[stageInd];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
         //
 
-        if (!tiler.isTilingPossible()) {
+        if (tiling.hwTilings.empty()) {
             origStage->attrs().set<bool>("tryHW", false);
 
             auto swConvOutput = stageIO.origOutput;
@@ -182,15 +230,15 @@ void PassImpl::run(const Model& model) {
 
         model->disconnectStage(origStage);
 
-        for (const auto &tiling : tiler.getHwTilings()) {
+        for (const auto &hwTiling : tiling.hwTilings) {
             HWConvStageTiler hwStageTiler(
                 stageOptions,
                 stageIO,
                 model,
                 origStage,
                 _stageBuilder,
-                tiling,
-                stageOptions.withPool && !tiler.withPool());
+                hwTiling,
+                stageOptions.withPool && !tiling.withPool);
 
             //
             // Split/concat input/output tiles
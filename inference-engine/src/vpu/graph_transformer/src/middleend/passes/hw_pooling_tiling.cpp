@@ -32,6 +32,8 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwPoolTiling);
 
+    const auto& env = CompileEnv::get();
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubMaxPool &&
             origStage->type() != StageType::StubAvgPool) {
@@ -67,7 +69,8 @@ void PassImpl::run(const Model& model) {
             stageOptions.padRight,
             stageOptions.padTop,
             stageOptions.padBottom,
-            false};
+            false,
+            env.resources.numCMXSlices};
 
         const HWTilingNS::HWPoolingTiler tiler(convolutionOptions, direction, tilingsCount);
 
@@ -277,7 +277,7 @@ std::vector<BatchNum> BlobCopy_BatchNum = {
 };
 
 std::vector<ChannelNum > BlobCopy_ChannelNum = {
-        3, 7,
+        3, 7, 16,
 };
 
 std::vector<Dims> BlobCopy_Dims = {
@@ -434,3 +434,63 @@ INSTANTIATE_TEST_CASE_P(accuracy, BlobCopySetLayoutTest,
     ::testing::Combine(::testing::ValuesIn(BlobCopySetLayout_Dims),
                        ::testing::ValuesIn(BlobCopySetLayout_Precisions)));
 
+
+namespace {
+
+// Micro-benchmark of the layout conversion matrix: every supported precision in both directions
+// for a 4K frame and a batch of feature maps
+using BlobCopyPerfTest = ::testing::TestWithParam<std::tuple<IsInterleaved, SizeVector, PrecisionType>>;
+
+std::vector<SizeVector> BlobCopyPerf_Dims = {
+    {1, 3, 2160, 3840},
+    {8, 16, 224, 224},
+    {1, 3, 16, 540, 960},
+};
+
+std::vector<PrecisionType> BlobCopyPerf_Precisions = {
+    InferenceEngine::Precision::FP32,
+    InferenceEngine::Precision::FP16,
+    InferenceEngine::Precision::I16,
+    InferenceEngine::Precision::U8,
+};
+
+}  // namespace
+
+TEST_P(BlobCopyPerfTest, BlobCopy) {
+    IsInterleaved srcIsInterleaved = get<0>(GetParam());
+    SizeVector dims = get<1>(GetParam());
+    PrecisionType precisionType = get<2>(GetParam());
+
+    InferenceEngine::Layout srcLayout = setLayout(srcIsInterleaved, dims.size() - 2);
+    InferenceEngine::Layout dstLayout = setLayout(!srcIsInterleaved, dims.size() - 2);
+
+    Blob::Ptr srcBlob = createBlob(precisionType, dims, srcLayout);
+    Blob::Ptr dstBlob = createBlob(precisionType, dims, dstLayout);
+    srcBlob->allocate();
+    dstBlob->allocate();
+    FillBlob(srcBlob);
+
+    // warm up to exclude page faults of the first touch
+    blob_copy(srcBlob, dstBlob);
+
+    const int iterations = 10;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        blob_copy(srcBlob, dstBlob);
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    auto avgTime = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(finish - start).count() / iterations;
+    // read and write of every byte
+    auto bandwidth = 2.0 * srcBlob->byteSize() / avgTime / 1000.0;
+    PrintParams(srcLayout, dims, "src", precisionType);
+    std::cout << "Blob_copy to " << dstLayout << " average time : " << avgTime << " micros, "
+              << bandwidth << " GB/s" << std::endl;
+
+    ASSERT_TRUE(IsCorrectBlobCopy(srcBlob, dstBlob)) << "'blob_copy' function is't correct";
+}
+
+INSTANTIATE_TEST_CASE_P(performance, BlobCopyPerfTest,
+    ::testing::Combine(::testing::Values(true, false),
+                       ::testing::ValuesIn(BlobCopyPerf_Dims),
+                       ::testing::ValuesIn(BlobCopyPerf_Precisions)));
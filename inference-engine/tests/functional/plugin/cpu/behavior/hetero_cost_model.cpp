@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+
+#include "functional_test_utils/precision_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> makeConvFunction() {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(Precision::FP32);
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 3, 16, 16}});
+    auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 8);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+}  // namespace
+
+TEST(HeteroCostModelTest, ConcurrentLoadNetwork) {
+    CNNNetwork network(makeConvFunction());
+    Core ie;
+    ie.SetConfig({{"TARGET_FALLBACK", "CPU"},
+                  {HETERO_CONFIG_KEY(AFFINITY_MODE), HETERO_CONFIG_VALUE(COST_MODEL)}}, "HETERO");
+
+    // every load profiles the network, so the profiling requests of the threads run at once
+    std::vector<std::thread> threads(4);
+    for (auto &thread : threads) {
+        thread = std::thread([&] {
+            for (int i = 0; i < 10; i++)
+                (void)ie.LoadNetwork(network, "HETERO");
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+}
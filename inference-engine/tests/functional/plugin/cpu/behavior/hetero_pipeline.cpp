@@ -0,0 +1,185 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+#include <ngraph/variant.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/precision_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// The CPU plugin registered under another device name, so HETERO splits the network into two CPU subnetworks
+const std::string stageDevice = "CPU_STAGE";
+const std::string heteroDevice = "HETERO:CPU," + stageDevice;
+
+void setAffinity(const std::shared_ptr<ngraph::Node> &node, const std::string &device) {
+    node->get_rt_info()["affinity"] = std::make_shared<ngraph::VariantWrapper<std::string>>(device);
+}
+
+// Two chains of convolutions of the same cost, the first one is executed by CPU, the second one by CPU_STAGE
+std::shared_ptr<ngraph::Function> makeTwoStageFunction() {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(Precision::FP32);
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 16, 32, 32}});
+    ngraph::Output<ngraph::Node> value = params[0];
+    ngraph::Output<ngraph::Node> firstStageOutput;
+    for (size_t stage = 0; stage < 2; stage++) {
+        for (size_t i = 0; i < 4; i++) {
+            auto conv = ngraph::builder::makeConvolution(value, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                         ngraph::op::PadType::EXPLICIT, 16);
+            value = std::make_shared<ngraph::opset1::Relu>(conv);
+        }
+        if (stage == 0) {
+            firstStageOutput = value;
+        }
+    }
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(value)};
+    auto function = std::make_shared<ngraph::Function>(results, params);
+
+    std::set<ngraph::Node*> firstStage;
+    std::vector<ngraph::Node*> stack{firstStageOutput.get_node()};
+    while (!stack.empty()) {
+        auto node = stack.back();
+        stack.pop_back();
+        if (firstStage.insert(node).second) {
+            for (auto &&input : node->input_values())
+                stack.push_back(input.get_node());
+        }
+    }
+    for (auto &&node : function->get_ops()) {
+        setAffinity(node, firstStage.count(node.get()) != 0 ? "CPU" : stageDevice);
+    }
+    return function;
+}
+
+ExecutableNetwork loadHetero(Core &ie, CNNNetwork &network, bool pipeline) {
+    // single threaded stages overlap only if they are pipelined
+    return ie.LoadNetwork(network, heteroDevice,
+        {{HETERO_CONFIG_KEY(PIPELINE), pipeline ? PluginConfigParams::YES : PluginConfigParams::NO},
+         {PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}});
+}
+
+}  // namespace
+
+class HeteroPipelineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ie.RegisterPlugin(std::string("MKLDNNPlugin") + IE_BUILD_POSTFIX, stageDevice);
+        network = CNNNetwork(makeTwoStageFunction());
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+    }
+
+    std::vector<InferRequest> createRequests(ExecutableNetwork &execNet, size_t numRequests) {
+        std::vector<InferRequest> requests;
+        for (size_t i = 0; i < numRequests; i++) {
+            requests.push_back(execNet.CreateInferRequest());
+            requests.back().SetBlob(inputName,
+                FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc(), 10, i));
+        }
+        return requests;
+    }
+
+    // returns the time of the given number of inferences of all the requests started at once
+    std::chrono::microseconds inferAll(std::vector<InferRequest> &requests, int iterations) {
+        auto start = std::chrono::steady_clock::now();
+        for (int iteration = 0; iteration < iterations; iteration++) {
+            for (auto &request : requests) {
+                request.StartAsync();
+            }
+            for (auto &request : requests) {
+                EXPECT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+            }
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    Core ie;
+    CNNNetwork network;
+    std::string inputName, outputName;
+};
+
+TEST_F(HeteroPipelineTest, NetworkIsSplitIntoTwoStages) {
+    auto execNet = loadHetero(ie, network, true);
+    std::set<std::string> subgraphs;
+    IE_SUPPRESS_DEPRECATED_START
+    CNNNetwork execGraphInfo = execNet.GetExecGraphInfo();
+    for (auto it = execGraphInfo.begin(); it != execGraphInfo.end(); it++) {
+        subgraphs.insert((*it)->GetParamAsString("subgraphIndex", ""));
+    }
+    IE_SUPPRESS_DEPRECATED_END
+    subgraphs.erase("");
+    ASSERT_EQ(2u, subgraphs.size());
+}
+
+TEST_F(HeteroPipelineTest, ConcurrentRequestsMatchNonPipelinedExecution) {
+    const size_t numRequests = 4;
+    auto referenceNet = loadHetero(ie, network, false);
+    auto pipelineNet = loadHetero(ie, network, true);
+    auto referenceRequests = createRequests(referenceNet, numRequests);
+    auto requests = createRequests(pipelineNet, numRequests);
+    for (auto &request : referenceRequests) {
+        request.Infer();
+    }
+
+    // a request which outputs are overwritten by another one shows up as a mismatch
+    for (int iteration = 0; iteration < 5; iteration++) {
+        inferAll(requests, 1);
+        for (size_t i = 0; i < numRequests; i++) {
+            FuncTestUtils::compareBlobs(requests[i].GetBlob(outputName), referenceRequests[i].GetBlob(outputName), 0.f);
+        }
+    }
+}
+
+TEST_F(HeteroPipelineTest, StagesOverlapInTime) {
+    if (std::thread::hardware_concurrency() < 2) {
+        GTEST_SKIP() << "The stages cannot overlap on a single core";
+    }
+    const size_t numRequests = 4;
+    const int iterations = 10;
+    auto sequentialNet = loadHetero(ie, network, false);
+    auto pipelineNet = loadHetero(ie, network, true);
+    auto sequentialRequests = createRequests(sequentialNet, numRequests);
+    auto requests = createRequests(pipelineNet, numRequests);
+    inferAll(sequentialRequests, 1);
+    inferAll(requests, 1);
+
+    // the stages of the same cost overlapped make the throughput nearly twice as high,
+    // a single unlucky schedule is not a failure
+    bool overlapped = false;
+    for (int attempt = 0; attempt < 3 && !overlapped; attempt++) {
+        auto sequentialTime = inferAll(sequentialRequests, iterations);
+        auto pipelineTime = inferAll(requests, iterations);
+        overlapped = pipelineTime.count() < 0.8 * sequentialTime.count();
+    }
+    EXPECT_TRUE(overlapped);
+}
+
+TEST_F(HeteroPipelineTest, ConcurrentLoadNetwork) {
+    ie.SetConfig({{HETERO_CONFIG_KEY(PIPELINE), PluginConfigParams::YES}}, "HETERO");
+
+    std::vector<std::thread> threads(4);
+    for (auto &thread : threads) {
+        thread = std::thread([&] {
+            for (int i = 0; i < 10; i++)
+                (void)ie.LoadNetwork(network, heteroDevice);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/precision_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "network_serializer.h"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const std::string cacheFileExt = ".blob";
+
+std::shared_ptr<ngraph::Function> makeConvFunction() {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(Precision::FP32);
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 3, 16, 16}});
+    auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 8);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+std::string readFile(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string &path, const std::string &content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+IE_SUPPRESS_DEPRECATED_START
+// the primitive and the output layouts selected for every node of the compiled graph
+std::map<std::string, std::string> getPrimitives(ExecutableNetwork &execNet) {
+    std::map<std::string, std::string> primitives;
+    CNNNetwork execGraphInfo = execNet.GetExecGraphInfo();
+    for (auto &node : Serialization::TopologicalSort(execGraphInfo)) {
+        primitives[node->name] = node->params["primitiveType"] + " " + node->params["outputLayouts"];
+    }
+    return primitives;
+}
+IE_SUPPRESS_DEPRECATED_END
+
+}  // namespace
+
+class CPUNetworkCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cacheDir = std::string("cpu_network_cache_") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        CommonTestUtils::removeDirectory(cacheDir);
+        CommonTestUtils::createDirectory(cacheDir);
+        network = CNNNetwork(makeConvFunction());
+        input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeDirectory(cacheDir);
+    }
+
+    ExecutableNetwork loadCached() {
+        Core ie;
+        ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+        return ie.LoadNetwork(network, "CPU");
+    }
+
+    std::string cacheFilePath() {
+        auto files = CommonTestUtils::listFilesWithExt(cacheDir, cacheFileExt);
+        EXPECT_EQ(1, files.size());
+        return files.empty() ? std::string() : CommonTestUtils::makePath(cacheDir, files.front());
+    }
+
+    Blob::Ptr infer(ExecutableNetwork &execNet) {
+        auto request = execNet.CreateInferRequest();
+        request.SetBlob(network.getInputsInfo().begin()->first, input);
+        request.Infer();
+        return request.GetBlob(network.getOutputsInfo().begin()->first);
+    }
+
+    void checkOutputs(ExecutableNetwork &execNet) {
+        Core ie;
+        auto reference = ie.LoadNetwork(network, "CPU");
+        FuncTestUtils::compareBlobs(infer(execNet), infer(reference), 0.f);
+    }
+
+    std::string cacheDir;
+    CNNNetwork network;
+    Blob::Ptr input;
+};
+
+TEST_F(CPUNetworkCacheTest, MissThenHit) {
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(cacheDir, cacheFileExt).empty());
+    auto compiled = loadCached();
+    auto path = cacheFilePath();
+    ASSERT_FALSE(path.empty());
+
+    // bytes after the exported network are not read by the import and are kept by a hit only,
+    // a recompiled network would overwrite the file
+    const std::string marker = "MARKER";
+    auto content = readFile(path);
+    writeFile(path, content + marker);
+
+    auto imported = loadCached();
+    ASSERT_EQ(path, cacheFilePath());
+    ASSERT_EQ(content + marker, readFile(path));
+    checkOutputs(compiled);
+    checkOutputs(imported);
+}
+
+TEST_F(CPUNetworkCacheTest, HitRestoresSelectedPrimitives) {
+    auto compiled = loadCached();
+    auto imported = loadCached();
+    auto primitives = getPrimitives(compiled);
+    ASSERT_FALSE(primitives.empty());
+    ASSERT_EQ(primitives, getPrimitives(imported));
+    // the exported network keeps the reordered weights, so the outputs are bit exact
+    checkOutputs(imported);
+}
+
+TEST_F(CPUNetworkCacheTest, RecoversFromCorruptFile) {
+    loadCached();
+    auto path = cacheFilePath();
+    auto content = readFile(path);
+
+    // keep the header with the matching key, so the import itself fails on the garbage
+    auto headerEnd = content.find('\n', content.find('\n') + 1) + 1;
+    ASSERT_NE(0, headerEnd);
+    writeFile(path, content.substr(0, headerEnd) + std::string(content.size() - headerEnd, '\x5a'));
+
+    ExecutableNetwork recovered;
+    ASSERT_NO_THROW(recovered = loadCached());
+    checkOutputs(recovered);
+    ASSERT_EQ(content, readFile(path));
+}
+
+TEST_F(CPUNetworkCacheTest, RecompilesOnKeyMismatch) {
+    loadCached();
+    auto path = cacheFilePath();
+    auto content = readFile(path);
+
+    // the exported network is intact, but the stored digest belongs to another network
+    auto keyStart = content.find('\n') + 1;
+    auto corrupted = content;
+    corrupted[keyStart] = corrupted[keyStart] == '0' ? '1' : '0';
+    writeFile(path, corrupted);
+
+    auto recompiled = loadCached();
+    checkOutputs(recompiled);
+    ASSERT_EQ(content, readFile(path));
+}
+
+TEST_F(CPUNetworkCacheTest, CacheDirIsNotSetForDevice) {
+    Core ie;
+    ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}}, "CPU"), details::InferenceEngineException);
+    ie.LoadNetwork(network, "CPU");
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(cacheDir, cacheFileExt).empty());
+}
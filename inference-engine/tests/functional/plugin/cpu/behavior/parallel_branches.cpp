@@ -0,0 +1,174 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_parallel.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "behavior/infer_request_callback.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/precision_utils.hpp"
+#include "network_serializer.h"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// Two independent chains of convolutions which are joined only by the final Concat
+std::shared_ptr<ngraph::Function> makeTwoBranchFunction() {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(Precision::FP32);
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 16, 64, 64}});
+    auto split = ngraph::builder::makeSplit(params[0], ngPrc, 2, 1);
+
+    ngraph::OutputVector branches;
+    for (size_t branch = 0; branch < 2; branch++) {
+        ngraph::Output<ngraph::Node> value = split->output(branch);
+        for (size_t i = 0; i < 4; i++) {
+            auto conv = ngraph::builder::makeConvolution(value, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                         ngraph::op::PadType::EXPLICIT, 32);
+            conv->set_friendly_name("branch" + std::to_string(branch) + "_conv" + std::to_string(i));
+            value = std::make_shared<ngraph::opset1::Relu>(conv);
+        }
+        branches.push_back(value);
+    }
+
+    auto concat = std::make_shared<ngraph::opset1::Concat>(branches, 1);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+struct ExecInterval {
+    int64_t start = std::numeric_limits<int64_t>::max();
+    int64_t end = std::numeric_limits<int64_t>::min();
+};
+
+// Joins the execStartMcs/execEndMcs of the executed primitives of each branch
+IE_SUPPRESS_DEPRECATED_START
+std::vector<ExecInterval> getBranchIntervals(ExecutableNetwork &execNet) {
+    std::vector<ExecInterval> intervals(2);
+    CNNNetwork execGraphInfo = execNet.GetExecGraphInfo();
+    for (auto &layer : Serialization::TopologicalSort(execGraphInfo)) {
+        for (size_t branch = 0; branch < intervals.size(); branch++) {
+            if (layer->name.find("branch" + std::to_string(branch) + "_") != 0)
+                continue;
+            auto start = layer->params.find("execStartMcs");
+            auto end = layer->params.find("execEndMcs");
+            if (start == layer->params.end() || end == layer->params.end())
+                continue;
+            intervals[branch].start = std::min<int64_t>(intervals[branch].start, std::stoll(start->second));
+            intervals[branch].end = std::max<int64_t>(intervals[branch].end, std::stoll(end->second));
+        }
+    }
+    return intervals;
+}
+IE_SUPPRESS_DEPRECATED_END
+
+using LayerTestsDefinitions::CallbackTests;
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::FP16
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, InferenceEngine::PluginConfigParams::YES}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ParallelBranches_BehaviorTests, CallbackTests,
+        ::testing::Combine(
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+            ::testing::ValuesIn(configs)),
+        CallbackTests::getTestCaseName);
+
+}  // namespace
+
+TEST(CPUParallelBranchesTest, OutputsMatchSequentialExecution) {
+    CNNNetwork network(makeTwoBranchFunction());
+    const std::string inputName = network.getInputsInfo().begin()->first;
+    const std::string outputName = network.getOutputsInfo().begin()->first;
+
+    Core ie;
+    auto sequentialNet = ie.LoadNetwork(network, "CPU",
+        {{PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO}});
+    auto parallelNet = ie.LoadNetwork(network, "CPU",
+        {{PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES}});
+    auto sequentialRequest = sequentialNet.CreateInferRequest();
+    auto parallelRequest = parallelNet.CreateInferRequest();
+
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+    sequentialRequest.SetBlob(inputName, input);
+    parallelRequest.SetBlob(inputName, input);
+    sequentialRequest.Infer();
+
+    // Run several times, a wrong dependency shows up as a race rather than as a stable error
+    for (int i = 0; i < 10; i++) {
+        parallelRequest.Infer();
+        FuncTestUtils::compareBlobs(parallelRequest.GetBlob(outputName), sequentialRequest.GetBlob(outputName), 0.f);
+    }
+}
+
+TEST(CPUParallelBranchesTest, BranchesOverlapInTime) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (std::thread::hardware_concurrency() < 2) {
+        GTEST_SKIP() << "The branches cannot overlap on a single core";
+    }
+
+    CNNNetwork network(makeTwoBranchFunction());
+    Core ie;
+    auto execNet = ie.LoadNetwork(network, "CPU",
+        {{PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES}});
+    auto request = execNet.CreateInferRequest();
+
+    // The timestamps are reported for the last inference only, a single unlucky schedule is not a failure
+    bool overlapped = false;
+    for (int i = 0; i < 20 && !overlapped; i++) {
+        request.Infer();
+        auto intervals = getBranchIntervals(execNet);
+        for (auto &interval : intervals)
+            ASSERT_LT(interval.start, interval.end);
+        overlapped = intervals[0].start < intervals[1].end && intervals[1].start < intervals[0].end;
+    }
+    EXPECT_TRUE(overlapped);
+
+    // Sequential execution is the reference: one branch finishes before the other one starts
+    auto sequentialNet = ie.LoadNetwork(network, "CPU",
+        {{PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO}});
+    auto sequentialRequest = sequentialNet.CreateInferRequest();
+    sequentialRequest.Infer();
+    auto intervals = getBranchIntervals(sequentialNet);
+    EXPECT_TRUE(intervals[0].end <= intervals[1].start || intervals[1].end <= intervals[0].start);
+#else
+    GTEST_SKIP() << "Parallel execution of graph branches is supported only with TBB threading";
+#endif
+}
+
+TEST(CPUParallelBranchesTest, ConcurrentLoadNetworkWithStreams) {
+    CNNNetwork network(makeTwoBranchFunction());
+    Core ie;
+    ie.SetConfig({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"},
+                  {PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES}}, "CPU");
+
+    std::vector<std::thread> threads(4);
+    for (auto &thread : threads) {
+        thread = std::thread([&] {
+            for (int i = 0; i < 10; i++)
+                (void)ie.LoadNetwork(network, "CPU");
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+}
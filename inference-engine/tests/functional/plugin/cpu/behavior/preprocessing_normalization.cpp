@@ -0,0 +1,120 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/precision_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const SizeVector inputShape = {1, 3, 8, 12};
+const std::vector<float> meanValues = {100.f, 200.f, 300.f};
+const std::vector<float> scales = {0.5f, 0.25f, 2.f};
+
+std::shared_ptr<ngraph::Function> makeConvFunction() {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(Precision::FP32);
+    auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+    auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 4);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv)};
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+// the mean image of a channel is its mean value plus the offset of the pixel
+float meanImageValue(size_t c, size_t i) {
+    return meanValues[c] + static_cast<float>(i % 7);
+}
+
+}  // namespace
+
+// U16 inputs are normalized by the fused G-API pre-processing, the only CPU path which applies the scales,
+// MeanImage::Subtract of the legacy path ignores them
+class CPUPreprocessingNormalizationTest : public ::testing::TestWithParam<MeanVariant> {
+protected:
+    void SetUp() override {
+        // the weights are random, so the reference network is a copy of the same function
+        function = makeConvFunction();
+        network = CNNNetwork(ngraph::clone_function(*function));
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        // U16 values above the mean values, so the subtraction does not depend on the clamping
+        input = FuncTestUtils::createAndFillBlob(TensorDesc(Precision::U16, inputShape, Layout::NCHW), 1000, 400);
+    }
+
+    Blob::Ptr inferNormalized() {
+        auto inputInfo = network.getInputsInfo().begin()->second;
+        inputInfo->setPrecision(Precision::U16);
+        auto& preProcess = inputInfo->getPreProcess();
+        const auto planeSize = inputShape[2] * inputShape[3];
+        preProcess.init(inputShape[1]);
+        for (size_t c = 0; c < inputShape[1]; c++) {
+            preProcess[c]->stdScale = scales[c];
+            preProcess[c]->meanValue = meanValues[c];
+            auto meanData = make_shared_blob<float>(TensorDesc(Precision::FP32, {inputShape[2], inputShape[3]}, Layout::HW));
+            meanData->allocate();
+            for (size_t i = 0; i < planeSize; i++) {
+                meanData->data()[i] = meanImageValue(c, i);
+            }
+            preProcess[c]->meanData = meanData;
+        }
+        preProcess.setVariant(GetParam());
+
+        auto execNet = ie.LoadNetwork(network, "CPU");
+        auto request = execNet.CreateInferRequest();
+        request.SetBlob(inputName, input);
+        request.Infer();
+        return request.GetBlob(outputName);
+    }
+
+    // the network without pre-processing inferred on the input normalized by the test
+    Blob::Ptr inferReference() {
+        CNNNetwork referenceNetwork(ngraph::clone_function(*function));
+        auto normalized = make_shared_blob<float>(TensorDesc(Precision::FP32, inputShape, Layout::NCHW));
+        normalized->allocate();
+        const auto planeSize = inputShape[2] * inputShape[3];
+        auto src = input->cbuffer().as<const uint16_t*>();
+        for (size_t c = 0; c < inputShape[1]; c++) {
+            for (size_t i = 0; i < planeSize; i++) {
+                float mean = 0.f;
+                if (GetParam() == MEAN_VALUE) {
+                    mean = meanValues[c];
+                } else if (GetParam() == MEAN_IMAGE) {
+                    mean = meanImageValue(c, i);
+                }
+                normalized->data()[c * planeSize + i] = (src[c * planeSize + i] - mean) * scales[c];
+            }
+        }
+
+        auto execNet = ie.LoadNetwork(referenceNetwork, "CPU");
+        auto request = execNet.CreateInferRequest();
+        request.SetBlob(network.getInputsInfo().begin()->first, normalized);
+        request.Infer();
+        return request.GetBlob(outputName);
+    }
+
+    Core ie;
+    std::shared_ptr<ngraph::Function> function;
+    CNNNetwork network;
+    std::string inputName, outputName;
+    Blob::Ptr input;
+};
+
+TEST_P(CPUPreprocessingNormalizationTest, FusedNormalizationAppliesMeanAndScale) {
+    auto output = inferNormalized();
+    auto reference = inferReference();
+    FuncTestUtils::compareBlobs(output, reference, 1e-4f);
+}
+
+INSTANTIATE_TEST_CASE_P(MeanVariants, CPUPreprocessingNormalizationTest,
+                        ::testing::Values(MEAN_VALUE, MEAN_IMAGE, NONE));
@@ -0,0 +1,122 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "behavior/infer_request_callback.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/precision_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> makeConvFunction() {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(Precision::FP32);
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 3, 16, 16}});
+    auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 8);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+using LayerTestsDefinitions::CallbackTests;
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::FP16
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE, "4"}},
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE, "4"},
+         {InferenceEngine::PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT, "1000"}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_RequestsBatching_BehaviorTests, CallbackTests,
+        ::testing::Combine(
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+            ::testing::ValuesIn(configs)),
+        CallbackTests::getTestCaseName);
+
+}  // namespace
+
+TEST(CPURequestsBatchingTest, ConcurrentRequestsMatchUnbatchedInference) {
+    const size_t batchSize = 4;
+    const size_t numRequests = 2 * batchSize;
+    const unsigned int iterations = 5;
+
+    CNNNetwork network(makeConvFunction());
+    const std::string inputName = network.getInputsInfo().begin()->first;
+    const std::string outputName = network.getOutputsInfo().begin()->first;
+
+    Core ie;
+    auto referenceNet = ie.LoadNetwork(network, "CPU");
+    // the long timeout makes the started requests wait for each other, so the batches are full
+    auto batchingNet = ie.LoadNetwork(network, "CPU",
+        {{PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE, std::to_string(batchSize)},
+         {PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT, "1000000"}});
+
+    // every request has its own input, so a wrong slot shows up as a mismatch
+    std::vector<InferRequest> requests, referenceRequests;
+    for (size_t i = 0; i < numRequests; i++) {
+        auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc(), 10, i);
+        referenceRequests.push_back(referenceNet.CreateInferRequest());
+        referenceRequests.back().SetBlob(inputName, input);
+        referenceRequests.back().Infer();
+        requests.push_back(batchingNet.CreateInferRequest());
+        requests.back().SetBlob(inputName, input);
+    }
+
+    for (unsigned int iteration = 0; iteration < iterations; iteration++) {
+        for (auto &request : requests) {
+            request.StartAsync();
+        }
+        for (size_t i = 0; i < numRequests; i++) {
+            ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+            // the batched network may select other convolution kernels, so the results are not bit exact
+            FuncTestUtils::compareBlobs(requests[i].GetBlob(outputName), referenceRequests[i].GetBlob(outputName), 1e-4f);
+        }
+    }
+
+    auto histogram = batchingNet.GetMetric(METRIC_KEY(CPU_REQUESTS_BATCH_SIZE_HISTOGRAM)).as<std::vector<unsigned int>>();
+    ASSERT_EQ(batchSize, histogram.size());
+    unsigned int executedRequests = 0;
+    for (size_t i = 0; i < histogram.size(); i++) {
+        executedRequests += static_cast<unsigned int>(i + 1) * histogram[i];
+    }
+    EXPECT_EQ(numRequests * iterations, executedRequests);
+    EXPECT_GT(histogram.back(), 0u);
+}
+
+TEST(CPURequestsBatchingTest, ConcurrentLoadNetworkWithStreams) {
+    CNNNetwork network(makeConvFunction());
+    Core ie;
+    ie.SetConfig({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"},
+                  {PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE, "4"},
+                  {PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT, "100"}}, "CPU");
+
+    std::vector<std::thread> threads(4);
+    for (auto &thread : threads) {
+        thread = std::thread([&] {
+            for (int i = 0; i < 10; i++)
+                (void)ie.LoadNetwork(network, "CPU");
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+}
@@ -0,0 +1,203 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "behavior/infer_request_callback.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/precision_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const SizeVector defaultShape = {1, 3, 16, 16};
+
+// The convolutions without the padding at the end keep the leading outputs of the padded inputs,
+// the reduction over the spatial dimensions does not
+std::shared_ptr<ngraph::Function> makeConvFunction(bool padEnd, bool reduceSpatial) {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(Precision::FP32);
+    auto params = ngraph::builder::makeParams(ngPrc, {defaultShape});
+    ngraph::Output<ngraph::Node> value = params[0];
+    for (size_t i = 0; i < 2; i++) {
+        auto conv = ngraph::builder::makeConvolution(value, ngPrc, {3, 3}, {1, 1}, {1, 1}, {padEnd ? 1 : 0, padEnd ? 1 : 0},
+                                                     {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+        value = std::make_shared<ngraph::opset1::Relu>(conv);
+    }
+    if (reduceSpatial) {
+        auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {2, 3});
+        value = std::make_shared<ngraph::opset1::ReduceMean>(value, axes, true);
+    }
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(value)};
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+// The last window of the ceil rounding is cut by the border of the input,
+// so the max pooling of negative inputs differs from the one of the zero padded inputs
+std::shared_ptr<ngraph::Function> makeCeilPoolFunction() {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(Precision::FP32);
+    auto params = ngraph::builder::makeParams(ngPrc, {defaultShape});
+    auto pool = std::make_shared<ngraph::opset1::MaxPool>(params[0], ngraph::Strides{2, 2}, ngraph::Shape{0, 0},
+                                                          ngraph::Shape{0, 0}, ngraph::Shape{2, 2},
+                                                          ngraph::op::RoundingType::CEIL);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(pool)};
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+uint64_t getMetric(ExecutableNetwork &execNet, const std::string &name) {
+    return execNet.GetMetric(name).as<uint64_t>();
+}
+
+using LayerTestsDefinitions::CallbackTests;
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::FP16
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE, "4"}},
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE, "4"},
+         {InferenceEngine::PluginConfigParams::KEY_CPU_SHAPES_CACHE_PADDING, InferenceEngine::PluginConfigParams::YES}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ShapesCache_BehaviorTests, CallbackTests,
+        ::testing::Combine(
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+            ::testing::ValuesIn(configs)),
+        CallbackTests::getTestCaseName);
+
+}  // namespace
+
+class CPUShapesCacheTest : public ::testing::Test {
+protected:
+    void load(const std::shared_ptr<ngraph::Function>& func, size_t cacheSize, bool padding) {
+        // the weights are random, so the reference networks are copies of the same function
+        function = func;
+        CNNNetwork network(ngraph::clone_function(*function));
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        execNet = ie.LoadNetwork(network, "CPU",
+            {{PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE, std::to_string(cacheSize)},
+             {PluginConfigParams::KEY_CPU_SHAPES_CACHE_PADDING, padding ? PluginConfigParams::YES : PluginConfigParams::NO}});
+        request = execNet.CreateInferRequest();
+    }
+
+    // infers the input of the given shape and compares the outputs with the network loaded for the shape
+    void inferAndCompare(const SizeVector &shape, int32_t startFrom = 0) {
+        auto input = FuncTestUtils::createAndFillBlob(TensorDesc(Precision::FP32, shape, Layout::NCHW), 10,
+                                                      startFrom + static_cast<int32_t>(shape[2]));
+        request.SetBlob(inputName, input);
+        request.Infer();
+
+        CNNNetwork network(ngraph::clone_function(*function));
+        network.reshape({{inputName, shape}});
+        auto referenceNet = ie.LoadNetwork(network, "CPU");
+        auto referenceRequest = referenceNet.CreateInferRequest();
+        referenceRequest.SetBlob(inputName, input);
+        referenceRequest.Infer();
+
+        auto output = request.GetBlob(outputName);
+        auto reference = referenceRequest.GetBlob(outputName);
+        ASSERT_EQ(reference->getTensorDesc().getDims(), output->getTensorDesc().getDims());
+        // the padded network may select other convolution kernels, so the results are not bit exact
+        FuncTestUtils::compareBlobs(output, reference, 1e-4f);
+    }
+
+    Core ie;
+    std::shared_ptr<ngraph::Function> function;
+    ExecutableNetwork execNet;
+    InferRequest request;
+    std::string inputName, outputName;
+};
+
+TEST_F(CPUShapesCacheTest, SeveralShapesMatchFreshLoadNetwork) {
+    load(makeConvFunction(true, false), 4, false);
+    const std::vector<SizeVector> shapes = {{1, 3, 24, 20}, {1, 3, 8, 32}, defaultShape, {1, 3, 24, 20}, {1, 3, 8, 32}};
+    for (auto &shape : shapes) {
+        inferAndCompare(shape);
+    }
+    // the network for the default shape is compiled by LoadNetwork
+    EXPECT_EQ(2u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_MISSES)));
+    EXPECT_EQ(3u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_HITS)));
+    EXPECT_EQ(0u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_PADDED_HITS)));
+}
+
+TEST_F(CPUShapesCacheTest, EvictsLeastRecentlyUsedNetworks) {
+    load(makeConvFunction(true, false), 2, false);
+    const SizeVector shapeB = {1, 3, 24, 20}, shapeC = {1, 3, 8, 32};
+
+    inferAndCompare(shapeB);        // miss, the cache keeps B and the default shape
+    inferAndCompare(shapeC);        // miss, the default shape is evicted
+    inferAndCompare(shapeB);        // hit
+    EXPECT_EQ(2u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_MISSES)));
+    EXPECT_EQ(1u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_HITS)));
+
+    inferAndCompare(defaultShape);  // miss, C is evicted as B was used later
+    inferAndCompare(shapeB);        // hit
+    inferAndCompare(shapeC);        // miss
+    EXPECT_EQ(4u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_MISSES)));
+    EXPECT_EQ(2u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_HITS)));
+}
+
+TEST_F(CPUShapesCacheTest, PaddedOutputsMatchExactShapes) {
+    load(makeConvFunction(false, false), 4, true);
+    inferAndCompare({1, 3, 32, 32});
+    // the network for the smaller shape is compiled in the background, the request is executed by the padded one
+    inferAndCompare({1, 3, 20, 24});
+    EXPECT_EQ(1u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_PADDED_HITS)));
+    EXPECT_EQ(2u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_MISSES)));
+}
+
+TEST_F(CPUShapesCacheTest, PaddingIsDisabledForPaddedConvolutions) {
+    load(makeConvFunction(true, false), 4, true);
+    inferAndCompare({1, 3, 32, 32});
+    inferAndCompare({1, 3, 20, 24});
+    EXPECT_EQ(0u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_PADDED_HITS)));
+}
+
+TEST_F(CPUShapesCacheTest, PaddingIsDisabledForSpatialReductions) {
+    load(makeConvFunction(false, true), 4, true);
+    inferAndCompare({1, 3, 32, 32});
+    inferAndCompare({1, 3, 20, 24});
+    EXPECT_EQ(0u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_PADDED_HITS)));
+    EXPECT_EQ(2u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_MISSES)));
+}
+
+TEST_F(CPUShapesCacheTest, PaddingIsDisabledForCeilPooling) {
+    load(makeCeilPoolFunction(), 4, true);
+    // the inputs are below zero, so the zeros of the padding would be the maximums of the last windows
+    inferAndCompare({1, 3, 32, 32}, -100);
+    inferAndCompare({1, 3, 21, 23}, -100);
+    EXPECT_EQ(0u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_PADDED_HITS)));
+    EXPECT_EQ(2u, getMetric(execNet, METRIC_KEY(CPU_SHAPES_CACHE_MISSES)));
+}
+
+TEST_F(CPUShapesCacheTest, ConcurrentLoadNetworkWithStreams) {
+    CNNNetwork network(makeConvFunction(true, false));
+    ie.SetConfig({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"},
+                  {PluginConfigParams::KEY_CPU_SHAPES_CACHE_SIZE, "4"}}, "CPU");
+
+    std::vector<std::thread> threads(4);
+    for (auto &thread : threads) {
+        thread = std::thread([&] {
+            for (int i = 0; i < 10; i++)
+                (void)ie.LoadNetwork(network, "CPU");
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+}
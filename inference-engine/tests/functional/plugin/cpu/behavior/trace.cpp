@@ -0,0 +1,124 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "behavior/infer_request_callback.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/precision_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> makeConvChainFunction() {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(Precision::FP32);
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 8, 16, 16}});
+    ngraph::Output<ngraph::Node> value = params[0];
+    for (size_t i = 0; i < 3; i++) {
+        auto conv = ngraph::builder::makeConvolution(value, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 8);
+        value = std::make_shared<ngraph::opset1::Relu>(conv);
+    }
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(value)};
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+size_t countOccurrences(const std::string &str, const std::string &pattern) {
+    size_t count = 0;
+    for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + pattern.size()))
+        count++;
+    return count;
+}
+
+std::string getTrace(size_t bufferSize, int inferences) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(CNNNetwork(makeConvChainFunction()), "CPU",
+        {{PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE, std::to_string(bufferSize)}});
+    auto request = execNet.CreateInferRequest();
+    for (int i = 0; i < inferences; i++)
+        request.Infer();
+    return execNet.GetMetric(METRIC_KEY(CPU_TRACE)).as<std::string>();
+}
+
+using LayerTestsDefinitions::CallbackTests;
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::FP16
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE, "16"}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_Trace_BehaviorTests, CallbackTests,
+        ::testing::Combine(
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+            ::testing::ValuesIn(configs)),
+        CallbackTests::getTestCaseName);
+
+}  // namespace
+
+TEST(CPUTraceTest, TraceHasNodeRecords) {
+    auto trace = getTrace(10000, 2);
+    ASSERT_EQ(0, trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    ASSERT_EQ(2, countOccurrences(trace, "\"name\":\"Infer\""));
+
+    // every executed node has a record per inference with its wait time and critical path mark
+    auto nodeEvents = countOccurrences(trace, "\"cat\":\"node");
+    ASSERT_GT(nodeEvents, 0);
+    ASSERT_EQ(0, nodeEvents % 2);
+    ASSERT_EQ(nodeEvents, countOccurrences(trace, "\"wait_us\":"));
+    ASSERT_EQ(nodeEvents, countOccurrences(trace, "\"critical_path\":"));
+    ASSERT_EQ(nodeEvents + 2, countOccurrences(trace, "\"ph\":\"X\""));
+
+    // the last finished node of an inference is always on the critical path
+    auto criticalEvents = countOccurrences(trace, "\"cat\":\"node,critical_path\"");
+    ASSERT_GT(criticalEvents, 0);
+    ASSERT_EQ(criticalEvents, countOccurrences(trace, "\"critical_path\":\"1\""));
+    ASSERT_NE(std::string::npos, trace.find("\"infer\":\"0\""));
+    ASSERT_NE(std::string::npos, trace.find("\"infer\":\"1\""));
+}
+
+TEST(CPUTraceTest, RingBufferKeepsLastRecords) {
+    const size_t bufferSize = 5;
+    const int inferences = 10;
+    auto trace = getTrace(bufferSize, inferences);
+
+    // the buffer is smaller than a single inference, so only the records of the last one are left
+    ASSERT_EQ(bufferSize, countOccurrences(trace, "\"ph\":\"X\""));
+    ASSERT_EQ(1, countOccurrences(trace, "\"name\":\"Infer\""));
+    ASSERT_EQ(std::string::npos, trace.find("\"infer\":\"0\""));
+    ASSERT_EQ(bufferSize, countOccurrences(trace, "\"infer\":\"" + std::to_string(inferences - 1) + "\""));
+}
+
+TEST(CPUTraceTest, ConcurrentLoadNetworkWithStreams) {
+    CNNNetwork network(makeConvChainFunction());
+    Core ie;
+    ie.SetConfig({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"},
+                  {PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES},
+                  {PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE, "64"}}, "CPU");
+
+    std::vector<std::thread> threads(4);
+    for (auto &thread : threads) {
+        thread = std::thread([&] {
+            for (int i = 0; i < 10; i++)
+                (void)ie.LoadNetwork(network, "CPU");
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+}
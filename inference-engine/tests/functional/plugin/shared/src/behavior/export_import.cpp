@@ -0,0 +1,80 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <sstream>
+
+#include <ie_core.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "behavior/export_import.hpp"
+
+namespace LayerTestsDefinitions {
+std::string ExportImportTests::getTestCaseName(testing::TestParamInfo<ExportImportParams> obj) {
+    InferenceEngine::Precision  netPrecision;
+    std::string targetDevice;
+    std::map<std::string, std::string> configuration;
+    std::tie(netPrecision, targetDevice, configuration) = obj.param;
+    std::ostringstream result;
+    result << "netPRC=" << netPrecision.name() << "_";
+    result << "targetDevice=" << targetDevice;
+    if (!configuration.empty()) {
+        result << "configItem=" << configuration.begin()->first << "_" << configuration.begin()->second;
+    }
+    return result.str();
+}
+
+void ExportImportTests::SetUp() {
+    InferenceEngine::Precision netPrecision;
+    std::tie(netPrecision, targetDevice, configuration) = this->GetParam();
+    function = ngraph::builder::subgraph::makeSplitConvConcat();
+}
+
+void ExportImportTests::TearDown() {
+    if (targetDevice.find(CommonTestUtils::DEVICE_GPU) != std::string::npos) {
+        PluginCache::get().reset();
+    }
+}
+
+TEST_P(ExportImportTests, importedNetworkInfersAsLoaded) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    InferenceEngine::CNNNetwork cnnNet(function);
+    cnnNet.getInputsInfo().begin()->second->setPrecision(InferenceEngine::Precision::U8);
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(cnnNet, targetDevice, configuration);
+
+    std::stringstream networkModel;
+    ASSERT_NO_THROW(execNet.Export(networkModel));
+    InferenceEngine::ExecutableNetwork importedNet;
+    ASSERT_NO_THROW(importedNet = ie->ImportNetwork(networkModel, targetDevice, configuration));
+
+    auto inputsInfo = importedNet.GetInputsInfo();
+    ASSERT_EQ(execNet.GetInputsInfo().size(), inputsInfo.size());
+    ASSERT_EQ(InferenceEngine::Precision::U8, inputsInfo.begin()->second->getPrecision());
+    ASSERT_EQ(execNet.GetOutputsInfo().size(), importedNet.GetOutputsInfo().size());
+
+    auto inputName = inputsInfo.begin()->first;
+    auto outputName = importedNet.GetOutputsInfo().begin()->first;
+    auto input = FuncTestUtils::createAndFillBlob(inputsInfo.begin()->second->getTensorDesc());
+
+    auto req = execNet.CreateInferRequest();
+    req.SetBlob(inputName, input);
+    req.Infer();
+    auto importedReq = importedNet.CreateInferRequest();
+    importedReq.SetBlob(inputName, input);
+    importedReq.Infer();
+
+    FuncTestUtils::compareBlobs(importedReq.GetBlob(outputName), req.GetBlob(outputName));
+}
+
+}  // namespace LayerTestsDefinitions
@@ -3,10 +3,23 @@
 //
 #pragma once
 
+#include <cstdio>
 #include <fstream>
 #include <string>
 #include <vector>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <direct.h>
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "test_constants.hpp"
 
 namespace CommonTestUtils {
@@ -50,4 +63,55 @@ inline void removeIRFiles(const std::string &xmlFilePath, const std::string &bin
         std::remove(binFileName.c_str());
     }
 }
+
+inline void createDirectory(const std::string &dirPath) {
+#ifdef _WIN32
+    _mkdir(dirPath.c_str());
+#else
+    mkdir(dirPath.c_str(), 0755);
+#endif
+}
+
+/**
+ * @brief Lists names of the files in the directory which end with the extension, subdirectories are ignored
+ */
+inline std::vector<std::string> listFilesWithExt(const std::string &dirPath, const std::string &ext) {
+    std::vector<std::string> files;
+    auto hasExt = [&](const std::string &name) {
+        return name.size() > ext.size() && name.compare(name.size() - ext.size(), ext.size(), ext) == 0;
+    };
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA(makePath(dirPath, "*").c_str(), &data);
+    if (handle == INVALID_HANDLE_VALUE) return files;
+    do {
+        if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && hasExt(data.cFileName))
+            files.emplace_back(data.cFileName);
+    } while (FindNextFileA(handle, &data));
+    FindClose(handle);
+#else
+    DIR *dir = opendir(dirPath.c_str());
+    if (dir == nullptr) return files;
+    while (struct dirent *entry = readdir(dir)) {
+        if (entry->d_type != DT_DIR && hasExt(entry->d_name))
+            files.emplace_back(entry->d_name);
+    }
+    closedir(dir);
+#endif
+    return files;
+}
+
+/**
+ * @brief Removes the files of the directory and the directory itself, nested directories are not supported
+ */
+inline void removeDirectory(const std::string &dirPath) {
+    for (auto &&file : listFilesWithExt(dirPath, "")) {
+        std::remove(makePath(dirPath, file).c_str());
+    }
+#ifdef _WIN32
+    _rmdir(dirPath.c_str());
+#else
+    rmdir(dirPath.c_str());
+#endif
+}
 }  // namespace CommonTestUtils
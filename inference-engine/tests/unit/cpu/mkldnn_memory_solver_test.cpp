@@ -273,3 +273,81 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+class MemSolverStrategyTest : public ::testing::TestWithParam<MKLDNNPlugin::MemorySolver::Strategy> {};
+
+TEST_P(MemSolverStrategyTest, NoOverlappingAndNotBelowLowerBound) {
+    // Pseudo random boxes with several "till to end" and zero sized ones
+    std::vector<Box> boxes;
+    unsigned seed = 7;
+    auto next = [&seed] (unsigned mod) { seed = seed * 1103515245 + 12345; return static_cast<int>((seed >> 16) % mod); };
+    for (int id = 0; id < 200; id++) {
+        int start = next(60);
+        int finish = next(10) == 0 ? -1 : start + next(12);
+        boxes.push_back({start, finish, next(9) == 0 ? 0 : 1 + next(100), id});
+    }
+
+    MKLDNNPlugin::MemorySolver ms(boxes, GetParam());
+    int64_t total = ms.solve();
+    EXPECT_GE(total, ms.maxDepth());
+
+    int max_ts = 0;
+    for (const auto& box : boxes) max_ts = std::max(max_ts, std::max(box.start, box.finish));
+    auto finish = [&](const Box& box) { return box.finish == -1 ? max_ts : box.finish; };
+
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const auto& box1 = boxes[i];
+        int64_t off1 = ms.getOffset(box1.id);
+        ASSERT_LE(off1 + box1.size, total);
+        for (size_t j = i + 1; j < boxes.size(); j++) {
+            const auto& box2 = boxes[j];
+            int64_t off2 = ms.getOffset(box2.id);
+            bool no_overlap = finish(box1) < box2.start || box1.start > finish(box2) ||
+                              off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+            ASSERT_TRUE(no_overlap) << "Box overlapping is detected";
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(MemSolverStrategies, MemSolverStrategyTest,
+                        ::testing::Values(MKLDNNPlugin::MemorySolver::Strategy::SizeFirst,
+                                          MKLDNNPlugin::MemorySolver::Strategy::LifetimeFirst,
+                                          MKLDNNPlugin::MemorySolver::Strategy::BestFit));
+
+TEST(MemSolverTest, LifetimeFirstBetterThanSizeFirst) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {4, 4, 3, n++},
+            {4, 4, 3, n++},
+            {2, 2, 4, n++},
+            {2, 4, 3, n++},
+    };
+
+    // The long living box goes first and does not split the memory at the time stamp 4
+    MKLDNNPlugin::MemorySolver size_first(boxes, MKLDNNPlugin::MemorySolver::Strategy::SizeFirst);
+    MKLDNNPlugin::MemorySolver lifetime_first(boxes, MKLDNNPlugin::MemorySolver::Strategy::LifetimeFirst);
+    EXPECT_EQ(size_first.solve(), 10);
+    EXPECT_EQ(lifetime_first.solve(), 9);
+    EXPECT_EQ(lifetime_first.maxDepth(), 9);
+}
+
+TEST(MemSolverTest, BestFitBetterThanSizeFirst) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {3, 6, 3, n++},
+            {3, 3, 2, n++},
+            {1, 3, 3, n++},
+            {2, 2, 4, n++},
+            {2, 2, 3, n++},
+            {2, 4, 3, n++},
+            {3, 4, 2, n++},
+    };
+
+    MKLDNNPlugin::MemorySolver size_first(boxes, MKLDNNPlugin::MemorySolver::Strategy::SizeFirst);
+    MKLDNNPlugin::MemorySolver best_fit(boxes, MKLDNNPlugin::MemorySolver::Strategy::BestFit);
+    EXPECT_EQ(size_first.solve(), 15);
+    EXPECT_EQ(best_fit.solve(), 13);
+    // both boxes of size 2 fill the gap [0, 4) left under the bigger boxes
+    EXPECT_EQ(best_fit.getOffset(1), 0);
+    EXPECT_EQ(best_fit.getOffset(6), 2);
+}
@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <ie_blob.h>
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+Blob::Ptr makeWeights(const std::vector<float>& values) {
+    auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {values.size()}, Layout::C));
+    blob->allocate();
+    std::memcpy(blob->buffer(), values.data(), values.size() * sizeof(float));
+    return blob;
+}
+
+MKLDNNMemoryPtr makeMemory(const mkldnn::engine& eng, int size, float value = 1.f) {
+    MKLDNNMemoryPtr memory(new MKLDNNMemory(eng));
+    memory->Create({size}, mkldnn::memory::f32, mkldnn::memory::x);
+    auto data = static_cast<float*>(memory->GetData());
+    std::fill(data, data + size, value);
+    return memory;
+}
+
+}  // namespace
+
+TEST(WeightsSharingTest, HashMatchesXXH64ForSmallData) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    ASSERT_EQ(0xEF46DB3751D8E999ull, hashFunc.hash(nullptr, 0));
+    ASSERT_EQ(0x44BC2CF5AD770999ull, hashFunc.hash(reinterpret_cast<const unsigned char*>("abc"), 3));
+}
+
+TEST(WeightsSharingTest, HashOfLargeDataDependsOnEveryByte) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    std::vector<unsigned char> data(3 * 1024 * 1024 + 17);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<unsigned char>(i * 31 + 7);
+
+    const auto hash = hashFunc.hash(data.data(), data.size());
+    ASSERT_EQ(hash, hashFunc.hash(data.data(), data.size()));
+    ASSERT_NE(hash, hashFunc.hash(data.data(), data.size() - 1));
+    ASSERT_NE(hash, hashFunc.hash(data.data(), data.size(), 1));
+
+    for (size_t position : {size_t{0}, data.size() / 2, data.size() - 1}) {
+        data[position] ^= 1;
+        ASSERT_NE(hash, hashFunc.hash(data.data(), data.size())) << "position " << position;
+        data[position] ^= 1;
+    }
+}
+
+TEST(WeightsSharingTest, KeyDependsOnContentAndDescriptor) {
+    auto weights = makeWeights({1.f, 2.f, 3.f, 4.f});
+    auto sameWeights = makeWeights({1.f, 2.f, 3.f, 4.f});
+    auto otherWeights = makeWeights({1.f, 2.f, 3.f, 5.f});
+    MKLDNNMemoryDesc desc({4}, mkldnn::memory::f32, mkldnn::memory::x);
+    MKLDNNMemoryDesc otherDesc({4}, mkldnn::memory::s32, mkldnn::memory::x);
+
+    ASSERT_EQ(MKLDNNWeightsSharing::GetKey(weights, desc), MKLDNNWeightsSharing::GetKey(sameWeights, desc));
+    ASSERT_NE(MKLDNNWeightsSharing::GetKey(weights, desc), MKLDNNWeightsSharing::GetKey(otherWeights, desc));
+    ASSERT_NE(MKLDNNWeightsSharing::GetKey(weights, desc), MKLDNNWeightsSharing::GetKey(weights, otherDesc));
+}
+
+TEST(WeightsSharingTest, SharesMemoryWhileItIsUsed) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNWeightsSharing cache;
+    auto create = [&] {
+        return makeMemory(eng, 16);
+    };
+
+    auto first = cache.findOrCreate("key", create);
+    auto second = cache.findOrCreate("key", create);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(16 * sizeof(float), cache.GetBytesSaved());
+
+    auto other = cache.findOrCreate("other key", create);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(16 * sizeof(float), cache.GetBytesSaved());
+
+    std::weak_ptr<MKLDNNMemory> released = first;
+    first.reset();
+    second.reset();
+    ASSERT_EQ(0ull, cache.GetBytesSaved());
+    auto recreated = cache.findOrCreate("key", create);
+    ASSERT_TRUE(released.expired());
+    ASSERT_EQ(recreated, cache.findOrCreate("key", create));
+}
+
+TEST(WeightsSharingTest, CreatesMemoryOnlyOnMiss) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNWeightsSharing cache;
+    int created = 0;
+    auto create = [&] {
+        created++;
+        return makeMemory(eng, 16);
+    };
+
+    auto first = cache.findOrCreate("key", create);
+    ASSERT_EQ(1, created);
+    ASSERT_EQ(first, cache.findOrCreate("key", create));
+    ASSERT_EQ(1, created);
+
+    first.reset();
+    cache.findOrCreate("key", create);
+    ASSERT_EQ(2, created);
+}
+
+TEST(WeightsSharingTest, SharedInstanceIsCommonForAllUsers) {
+    auto first = NumaNodesWeights::GetShared();
+    auto second = NumaNodesWeights::GetShared();
+    ASSERT_EQ(first, second);
+}
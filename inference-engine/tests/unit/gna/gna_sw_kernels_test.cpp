@@ -0,0 +1,301 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "runtime/floatmath.h"
+#include "runtime/cnn.h"
+#include "runtime/pwl.h"
+
+namespace {
+
+constexpr float kTolerance = 1e-4f;
+
+std::vector<float> randomVector(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> v(size);
+    for (auto& x : v) {
+        x = dist(gen);
+    }
+    return v;
+}
+
+// C = op(A) * op(B) + C, the scalar reference of the software emulation
+void referenceGemm(bool transA, bool transB, int M, int N, int K, const float* A, int lda, const float* B, int ldb,
+                   float* C, int ldc) {
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            float sum = C[i * ldc + j];
+            for (int k = 0; k < K; k++) {
+                const float a = transA ? A[k * lda + i] : A[i * lda + k];
+                const float b = transB ? B[j * ldb + k] : B[k * ldb + j];
+                sum += a * b;
+            }
+            C[i * ldc + j] = sum;
+        }
+    }
+}
+
+void referenceGemm(int M, int N, int K, const float* A, int lda, const float* B, int ldb, float* C, int ldc) {
+    referenceGemm(false, false, M, N, K, A, lda, B, ldb, C, ldc);
+}
+
+void expectNear(const std::vector<float>& expected, const std::vector<float>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], kTolerance) << "at index " << i;
+    }
+}
+
+void expectEqual(const std::vector<float>& expected, const std::vector<float>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], actual[i]) << "at index " << i;
+    }
+}
+
+}  // namespace
+
+class GNASWKernelsGemmTest : public ::testing::TestWithParam<int> {};
+
+TEST_P(GNASWKernelsGemmTest, sgemmMatchesReference) {
+    const int M = 517, K = 300, N = GetParam();
+    const auto A = randomVector(M * K, 1);
+    const auto B = randomVector(K * N, 2);
+    auto expected = randomVector(M * N, 3);
+    auto actual = expected;
+
+    referenceGemm(M, N, K, A.data(), K, B.data(), N, expected.data(), N);
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, actual.data(), N);
+
+    expectNear(expected, actual);
+}
+
+TEST_P(GNASWKernelsGemmTest, sgemmSubsetMatchesReference) {
+    const int M = 517, K = 300, N = GetParam();
+    const auto A = randomVector(M * K, 4);
+    const auto B = randomVector(K * N, 5);
+    std::vector<uint32_t> outputs;
+    for (uint32_t i = 0; i < M; i += 3) {
+        outputs.push_back(i);
+    }
+    const int L = static_cast<int>(outputs.size());
+    auto actual = randomVector(L * N, 6);
+    auto expected = actual;
+
+    for (int l = 0; l < L; l++) {
+        referenceGemm(1, N, K, A.data() + outputs[l] * K, K, B.data(), N, expected.data() + l * N, N);
+    }
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N,
+                       1.0, actual.data(), N, outputs.data(), L);
+
+    expectNear(expected, actual);
+}
+
+TEST_P(GNASWKernelsGemmTest, sgemmTransAMatchesReference) {
+    const int M = 517, K = 300, N = GetParam();
+    const auto A = randomVector(K * M, 15);
+    const auto B = randomVector(K * N, 16);
+    auto expected = randomVector(M * N, 17);
+    auto actual = expected;
+
+    referenceGemm(true, false, M, N, K, A.data(), M, B.data(), N, expected.data(), N);
+    cblas_sgemm1(CblasRowMajor, CblasTrans, CblasNoTrans, M, N, K, 1.0, A.data(), M, B.data(), N, 1.0, actual.data(), N);
+
+    // the strided rows of A are never computed by dot, so the summation order is the reference one
+    expectEqual(expected, actual);
+}
+
+TEST_P(GNASWKernelsGemmTest, sgemmTransBMatchesReference) {
+    const int M = 517, K = 300, N = GetParam();
+    const auto A = randomVector(M * K, 18);
+    const auto B = randomVector(N * K, 19);
+    auto expected = randomVector(M * N, 20);
+    auto actual = expected;
+
+    referenceGemm(false, true, M, N, K, A.data(), K, B.data(), K, expected.data(), N);
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, 1.0, A.data(), K, B.data(), K, 1.0, actual.data(), N);
+
+    expectNear(expected, actual);
+}
+
+TEST_P(GNASWKernelsGemmTest, sgemmSubsetTransAMatchesReference) {
+    const int M = 517, K = 300, N = GetParam();
+    const auto A = randomVector(K * M, 21);
+    const auto B = randomVector(K * N, 22);
+    std::vector<uint32_t> outputs;
+    for (uint32_t i = 1; i < M; i += 4) {
+        outputs.push_back(i);
+    }
+    const int L = static_cast<int>(outputs.size());
+    auto actual = randomVector(L * N, 23);
+    auto expected = actual;
+
+    for (int l = 0; l < L; l++) {
+        referenceGemm(true, false, 1, N, K, A.data() + outputs[l], M, B.data(), N, expected.data() + l * N, N);
+    }
+    cblas_sgemm_subset(CblasRowMajor, CblasTrans, CblasNoTrans, M, N, K, 1.0, A.data(), M, B.data(), N,
+                       1.0, actual.data(), N, outputs.data(), L);
+
+    expectEqual(expected, actual);
+}
+
+TEST_P(GNASWKernelsGemmTest, sgemmSubsetTransBMatchesReference) {
+    const int M = 31, K = 300, N = GetParam() * 20;
+    const auto A = randomVector(M * K, 24);
+    const auto B = randomVector(N * K, 25);
+    std::vector<uint32_t> outputs;
+    for (uint32_t j = 0; j < N; j += 3) {
+        outputs.push_back(j);
+    }
+    const int L = static_cast<int>(outputs.size());
+    auto actual = randomVector(M * L, 26);
+    auto expected = actual;
+
+    // the subset selects the columns of the output
+    for (int l = 0; l < L; l++) {
+        referenceGemm(false, true, M, 1, K, A.data(), K, B.data() + outputs[l] * K, K, expected.data() + l, L);
+    }
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, 1.0, A.data(), K, B.data(), K,
+                       1.0, actual.data(), L, outputs.data(), L);
+
+    expectNear(expected, actual);
+}
+
+TEST_P(GNASWKernelsGemmTest, sgemmIsBitExactExceptForMatrixVectorProduct) {
+    const int M = 517, K = 300, N = GetParam();
+    const auto A = randomVector(M * K, 27);
+    const auto B = randomVector(K * N, 28);
+    auto expected = randomVector(M * N, 29);
+    auto actual = expected;
+
+    referenceGemm(M, N, K, A.data(), K, B.data(), N, expected.data(), N);
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, actual.data(), N);
+
+    // a single column is computed by dot, which reorders the summation
+    if (N == 1) {
+        expectNear(expected, actual);
+    } else {
+        expectEqual(expected, actual);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(GNASWKernels, GNASWKernelsGemmTest, ::testing::Values(1, 3, 8, 21));
+
+TEST(GNASWKernelsTest, sgemvSplitMatchesReference) {
+    const uint32_t N = 257, K1 = 301, K2 = 77;
+    const auto A1 = randomVector(K1, 7);
+    const auto A2 = randomVector(K2, 8);
+    const auto X = randomVector(N * (K1 + K2), 9);
+    const auto B = randomVector(N, 10);
+    std::vector<float> expected(N), actual(N);
+
+    for (uint32_t i = 0; i < N; i++) {
+        float sum = B[i];
+        for (uint32_t j = 0; j < K1 + K2; j++) {
+            sum += (j < K1 ? A1[j] : A2[j - K1]) * X[i * (K1 + K2) + j];
+        }
+        expected[i] = sum;
+    }
+    sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), actual.data());
+
+    expectNear(expected, actual);
+}
+
+TEST(GNASWKernelsTest, cnnFilter32MatchesReference) {
+    const uint32_t numFilters = 64, numCoefficients = 48, numFeatureMaps = 4, numFeatureMapColumns = 12;
+    const uint32_t numFeatureMapRows = 200, numFilterRows = 8, numOutputs = numFeatureMapRows - numFilterRows + 1;
+    const uint32_t bandStride = numFeatureMaps * numFeatureMapColumns;
+    auto filters = randomVector(numFilters * numCoefficients, 11);
+    auto biases = randomVector(numFilters, 12);
+    auto inputs = randomVector(numFeatureMapRows * bandStride, 13);
+    std::vector<float> expected(numOutputs * numFilters), actual(numOutputs * numFilters);
+
+    for (uint32_t j = 0; j < numOutputs; j++) {
+        for (uint32_t i = 0; i < numFilters; i++) {
+            float sum = biases[i];
+            for (uint32_t k = 0; k < numCoefficients; k++) {
+                sum += inputs[j * bandStride + k] * filters[i * numCoefficients + k];
+            }
+            expected[j * numFilters + i] = sum;
+        }
+    }
+
+    intel_dnn_component_t component = {};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_out = numOutputs * numFilters;
+    component.op.conv1D.num_filters = numFilters;
+    component.op.conv1D.num_filter_rows = numFilterRows;
+    component.op.conv1D.num_filter_coefficients = numCoefficients;
+    component.op.conv1D.num_feature_maps = numFeatureMaps;
+    component.op.conv1D.num_feature_map_rows = numFeatureMapRows;
+    component.op.conv1D.num_feature_map_columns = numFeatureMapColumns;
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = actual.data();
+    CNNFilter32(&component);
+
+    expectNear(expected, actual);
+}
+
+TEST(GNASWKernelsTest, pwlApply32IsExactOnSubregion) {
+    const uint32_t rows = 3, columns = 40000;
+    auto inputs = randomVector(rows * columns, 14);
+    std::vector<float> outputs(rows * columns, 0.0f);
+
+    intel_dnn_component_t component = {};
+    component.num_rows_in = rows;
+    component.num_columns_in = columns;
+    component.op.pwl.func_id.type = kActTanh;
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    PwlApply32(&component, 1, 2, 5, columns - 2);
+
+    for (uint32_t i = 0; i < rows; i++) {
+        for (uint32_t j = 0; j < columns; j++) {
+            const bool inside = i >= 1 && j >= 5 && j <= columns - 2;
+            const float expected = inside ? static_cast<float>(std::tanh(static_cast<double>(inputs[i * columns + j]))) : 0.0f;
+            ASSERT_EQ(expected, outputs[i * columns + j]) << "at " << i << ", " << j;
+        }
+    }
+}
+
+// compares the kernels with the scalar reference on the affine layer of a speech model, is run manually
+TEST(GNASWKernelsTest, DISABLED_sgemmBenchmark) {
+    using Clock = std::chrono::steady_clock;
+    const int M = 1024, K = 1024, iterations = 20;
+    const auto A = randomVector(M * K, 30);
+
+    for (const int N : {1, 8}) {
+        const auto B = randomVector(K * N, 31);
+        std::vector<float> C(M * N, 0.0f);
+
+        const auto referenceStart = Clock::now();
+        for (int i = 0; i < iterations; i++) {
+            referenceGemm(M, N, K, A.data(), K, B.data(), N, C.data(), N);
+        }
+        const auto kernelStart = Clock::now();
+        for (int i = 0; i < iterations; i++) {
+            cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N,
+                         1.0, C.data(), N);
+        }
+        const auto kernelEnd = Clock::now();
+
+        const auto toMs = [iterations](Clock::duration time) {
+            return std::chrono::duration<double, std::milli>(time).count() / iterations;
+        };
+        std::cout << M << "x" << K << " affine, batch " << N << ": reference " << toMs(kernelStart - referenceStart)
+                  << " ms, kernel " << toMs(kernelEnd - kernelStart) << " ms" << std::endl;
+    }
+}
@@ -0,0 +1,157 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_layers.h>
+#include <cnn_network_impl.hpp>
+#include <details/ie_cnn_network_tools.h>
+
+#include "hetero_cost_model.hpp"
+#include "hetero_graph_splitter.hpp"
+
+using namespace InferenceEngine;
+using namespace HeteroPlugin;
+
+class HeteroCostModelTest : public ::testing::Test {
+protected:
+    // every blob is 4000 bytes
+    DataPtr addData(const std::string& name) {
+        auto data = std::make_shared<Data>(name, TensorDesc(Precision::FP32, {1, 1000}, Layout::NC));
+        network.addData(name.c_str(), data);
+        return data;
+    }
+
+    DataPtr addInput(const std::string& name) {
+        auto data = addLayer(name, "Input", {});
+        auto info = std::make_shared<InputInfo>();
+        info->setInputData(data);
+        network.setInputInfo(info);
+        return data;
+    }
+
+    DataPtr addLayer(const std::string& name, const std::string& type, const std::vector<DataPtr>& inputs) {
+        auto layer = std::make_shared<CNNLayer>(LayerParams{name, type, Precision::FP32});
+        for (auto&& input : inputs) {
+            layer->insData.push_back(input);
+            input->getInputTo()[name] = layer;
+        }
+        auto output = addData(name);
+        output->getCreatorLayer() = layer;
+        layer->outData.push_back(output);
+        network.addLayer(layer);
+        return output;
+    }
+
+    // input -> l0 -> ... -> l5, the first half is faster on A, the second one is faster on B
+    void makeChain() {
+        auto value = addInput("input");
+        for (int i = 0; i < 6; i++) {
+            value = addLayer("l" + std::to_string(i), "ReLU", {value});
+        }
+        network.addOutput(value->getName());
+        costModel.devices = {"A", "B"};
+        costModel.layersTime = {{{"l0", 1.f}, {"l1", 1.f}, {"l2", 1.f}, {"l3", 10.f}, {"l4", 10.f}, {"l5", 10.f}},
+                                {{"l0", 11.f}, {"l1", 11.f}, {"l2", 11.f}, {"l3", 1.f}, {"l4", 1.f}, {"l5", 1.f}}};
+        costModel.subgraphOverhead = 2.f;
+    }
+
+    size_t countSubgraphs(const Partition& partition) {
+        std::vector<std::string> devices;
+        for (auto&& layer : CNNNetSortTopologically(network)) {
+            layer->affinity = partition.affinities.at(layer->name);
+            if (std::find(devices.begin(), devices.end(), layer->affinity) == devices.end()) {
+                devices.push_back(layer->affinity);
+            }
+        }
+        return splitGraph(network, devices).size();
+    }
+
+    details::CNNNetworkImpl network;
+    CostModel costModel;
+};
+
+TEST_F(HeteroCostModelTest, ChainIsSplitAtTheOptimalLayer) {
+    makeChain();
+    // the switch costs the overhead plus the transfer of the output of l2
+    costModel.transferTimePerByte = 1e-3f;
+    auto partition = partitionByCostModel(network, costModel, 4);
+
+    for (auto&& name : {"input", "l0", "l1", "l2"}) {
+        EXPECT_EQ("A", partition.affinities.at(name)) << name;
+    }
+    for (auto&& name : {"l3", "l4", "l5"}) {
+        EXPECT_EQ("B", partition.affinities.at(name)) << name;
+    }
+    EXPECT_FLOAT_EQ(2.f + 3.f + (2.f + 4.f) + 3.f, partition.latency);
+    EXPECT_FLOAT_EQ(1.f, partition.layersTime.at("l4"));
+    EXPECT_EQ(2u, countSubgraphs(partition));
+}
+
+TEST_F(HeteroCostModelTest, ExpensiveTransferKeepsSingleDevice) {
+    makeChain();
+    costModel.transferTimePerByte = 1e-2f;
+    auto partition = partitionByCostModel(network, costModel, 4);
+
+    for (auto&& affinity : partition.affinities) {
+        EXPECT_EQ("A", affinity.second) << affinity.first;
+    }
+    EXPECT_FLOAT_EQ(2.f + 3.f + 30.f, partition.latency);
+}
+
+TEST_F(HeteroCostModelTest, SingleSubgraphUsesTheFastestDevice) {
+    makeChain();
+    auto partition = partitionByCostModel(network, costModel, 1);
+
+    for (auto&& affinity : partition.affinities) {
+        EXPECT_EQ("A", affinity.second) << affinity.first;
+    }
+    EXPECT_FLOAT_EQ(2.f + 3.f + 30.f, partition.latency);
+}
+
+TEST_F(HeteroCostModelTest, UnsupportedLayerIsAssignedToTheOtherDevice) {
+    makeChain();
+    costModel.layersTime[0].erase("l1");
+    auto partition = partitionByCostModel(network, costModel, 4);
+
+    EXPECT_EQ("B", partition.affinities.at("l1"));
+    EXPECT_EQ("B", partition.affinities.at("l5"));
+}
+
+TEST_F(HeteroCostModelTest, NetworkAffinitiesAreKept) {
+    makeChain();
+    partitionByCostModel(network, costModel, 4);
+
+    for (auto&& layer : CNNNetSortTopologically(network)) {
+        EXPECT_TRUE(layer->affinity.empty()) << layer->name;
+    }
+}
+
+TEST_F(HeteroCostModelTest, SubgraphsOfDisconnectedBranchesAreCounted) {
+    // the branches assigned to one device in one segment of the topological order are two subgraphs
+    auto a1 = addLayer("a1", "ReLU", {addInput("input1")});
+    auto a2 = addLayer("a2", "ReLU", {addInput("input2")});
+    auto b1 = addLayer("b1", "ReLU", {a1});
+    auto b2 = addLayer("b2", "ReLU", {a2});
+    network.addOutput(addLayer("c", "Eltwise", {b1, b2})->getName());
+    costModel.devices = {"A", "B"};
+    costModel.layersTime = {{{"a1", 1.f}, {"a2", 1.f}, {"b1", 10.f}, {"b2", 10.f}, {"c", 10.f}},
+                            {{"a1", 10.f}, {"a2", 10.f}, {"b1", 1.f}, {"b2", 1.f}, {"c", 1.f}}};
+    costModel.subgraphOverhead = 1.f;
+
+    for (size_t maxSubgraphs = 1; maxSubgraphs <= 4; maxSubgraphs++) {
+        auto partition = partitionByCostModel(network, costModel, maxSubgraphs);
+        EXPECT_LE(countSubgraphs(partition), maxSubgraphs);
+    }
+    // with enough subgraphs both branches start on A
+    auto partition = partitionByCostModel(network, costModel, 4);
+    EXPECT_EQ("A", partition.affinities.at("a1"));
+    EXPECT_EQ("A", partition.affinities.at("a2"));
+    EXPECT_EQ("B", partition.affinities.at("c"));
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "common_test_utils/test_common.hpp"
+
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+using namespace InferenceEngine;
+
+using CPUStreamsExecutorParams = std::tuple<int, int>;  // streams, spin wait in microseconds
+
+class CPUStreamsExecutorTests : public CommonTestUtils::TestsCommon,
+                                public ::testing::WithParamInterface<CPUStreamsExecutorParams> {
+protected:
+    IStreamsExecutor::Ptr makeExecutor() {
+        int streams = 0, spinWait = 0;
+        std::tie(streams, spinWait) = GetParam();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1};
+        config._spinWait = spinWait;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    }
+};
+
+TEST_P(CPUStreamsExecutorTests, canRunMoreTasksThanQueueCapacity) {
+    std::atomic<int> counter = {0};
+    constexpr int tasksNum = 10000;
+    {
+        auto executor = makeExecutor();
+        std::promise<void> blocker;
+        auto blocked = blocker.get_future().share();
+        // block stream threads so all tasks are stored in queues
+        for (int i = 0; i < tasksNum; ++i) {
+            executor->run([&counter, blocked] {
+                blocked.wait();
+                ++counter;
+            });
+        }
+        blocker.set_value();
+    }
+    ASSERT_EQ(tasksNum, counter);
+}
+
+TEST_P(CPUStreamsExecutorTests, canRunTasksFromMultipleThreads) {
+    auto executor = makeExecutor();
+    constexpr int threadsNum = 8;
+    constexpr int tasksPerThread = 2000;
+    std::atomic<int> counter = {0};
+    std::promise<void> done;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < tasksPerThread; ++i) {
+                executor->run([&] {
+                    if (threadsNum * tasksPerThread == ++counter) {
+                        done.set_value();
+                    }
+                });
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    done.get_future().wait();
+    ASSERT_EQ(threadsNum * tasksPerThread, counter);
+}
+
+TEST_P(CPUStreamsExecutorTests, DISABLED_dispatchThroughputAndLatency) {
+    constexpr int tasksNum = 200000;
+    auto executor = makeExecutor();
+    using Clock = std::chrono::steady_clock;
+    std::vector<Clock::time_point> submitted(tasksNum), started(tasksNum);
+    std::atomic<int> counter = {0};
+    std::promise<void> done;
+
+    auto begin = Clock::now();
+    for (int i = 0; i < tasksNum; ++i) {
+        submitted[i] = Clock::now();
+        executor->run([&, i] {
+            started[i] = Clock::now();
+            if (tasksNum == ++counter) {
+                done.set_value();
+            }
+        });
+    }
+    done.get_future().wait();
+    auto elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    std::vector<double> latencies(tasksNum);
+    for (int i = 0; i < tasksNum; ++i) {
+        latencies[i] = std::chrono::duration<double, std::micro>(started[i] - submitted[i]).count();
+    }
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << "streams: " << std::get<0>(GetParam()) << " spin wait: " << std::get<1>(GetParam()) << " us"
+              << " tasks/sec: " << tasksNum / elapsed
+              << " p50 dispatch latency: " << latencies[tasksNum / 2] << " us"
+              << " p99 dispatch latency: " << latencies[tasksNum * 99 / 100] << " us" << std::endl;
+}
+
+INSTANTIATE_TEST_CASE_P(CPUStreamsExecutor, CPUStreamsExecutorTests,
+                        ::testing::Combine(::testing::Values(1, 2, 4, 8, 16, 32),
+                                           ::testing::Values(0, 50)));
+
+TEST(CPUStreamsExecutorConfigTests, canSetSpinWait) {
+    IStreamsExecutor::Config config;
+    ASSERT_NO_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT), "20"));
+    ASSERT_EQ(20, config._spinWait);
+    ASSERT_EQ(20, config.GetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT)).as<int>());
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT), "-1"), details::InferenceEngineException);
+}
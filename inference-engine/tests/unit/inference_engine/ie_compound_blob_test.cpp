@@ -47,6 +47,7 @@ public:
 
 class NV12BlobTests : public CompoundBlobTests {};
 class I420BlobTests : public CompoundBlobTests {};
+class BatchedBlobTests : public CompoundBlobTests {};
 
 TEST(BlobConversionTests, canWorkWithMemoryBlob) {
     Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
@@ -424,4 +425,42 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
     EXPECT_THROW(make_shared_blob<I420Blob>(y_blob, v_blob, u_blob), InferenceEngine::details::InferenceEngineException);
 }
 
+TEST_F(BatchedBlobTests, canCreateBatchedBlobFromRoiBlobs) {
+    Blob::Ptr frame = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 32, 32}, NHWC));
+    frame->allocate();
+    Blob::Ptr roi1 = make_shared_blob(frame, ROI{0, 0, 0, 8, 16});
+    Blob::Ptr roi2 = make_shared_blob(frame, ROI{0, 10, 4, 12, 6});
+    BatchedBlob::Ptr batched_blob = make_shared_blob<BatchedBlob>(BlobPtrs{roi1, roi2});
+    verifyCompoundBlob(batched_blob, {roi1, roi2});
+    EXPECT_EQ(Precision::U8, batched_blob->getTensorDesc().getPrecision());
+    EXPECT_EQ(NHWC, batched_blob->getTensorDesc().getLayout());
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromEmptyVector) {
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{}), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromCompoundBlobs) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    Blob::Ptr nv12_blob = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{nv12_blob}), InferenceEngine::details::InferenceEngineException);
+}
 
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromImagesWithBatchGreaterThanOne) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 6, 8}, NCHW));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{image}), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromInconsistentImages) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NCHW));
+    Blob::Ptr other_precision = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 3, 6, 8}, NCHW));
+    Blob::Ptr other_layout = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    Blob::Ptr other_channels = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 4, 6, 8}, NCHW));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{image, other_precision}),
+                 InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{image, other_layout}),
+                 InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{image, other_channels}),
+                 InferenceEngine::details::InferenceEngineException);
+}
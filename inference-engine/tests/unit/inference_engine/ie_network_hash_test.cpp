@@ -0,0 +1,116 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "ie_network_hash.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+class OpsetExtension : public IExtension {
+public:
+    explicit OpsetExtension(std::string opsetName) : _opsetName(std::move(opsetName)) {}
+
+    void GetVersion(const Version*& versionInfo) const noexcept override {}
+    void Release() noexcept override { delete this; }
+    void Unload() noexcept override {}
+
+    std::map<std::string, ngraph::OpSet> getOpSets() override {
+        ngraph::OpSet opset;
+        opset.insert<ngraph::opset1::Relu>();
+        return {{_opsetName, opset}};
+    }
+
+private:
+    std::string _opsetName;
+};
+
+}  // namespace
+
+class NetworkHashTests : public CommonTestUtils::TestsCommon {
+protected:
+    static CNNNetwork makeNetwork(float weight, const std::string& priority = {}) {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+        param->set_friendly_name("input");
+        auto constant = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1},
+                                                         std::vector<float>(3, weight));
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(param, constant);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+        relu->set_friendly_name("output");
+        if (!priority.empty()) {
+            relu->get_rt_info()["PrimitivesPriority"] = std::make_shared<ngraph::VariantWrapper<std::string>>(priority);
+        }
+        auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                                           ngraph::ParameterVector{param});
+        return CNNNetwork(function);
+    }
+};
+
+TEST_F(NetworkHashTests, hashIsStableForEqualNetworks) {
+    auto hash = computeNetworkHash(makeNetwork(2.f), "CPU", {});
+    ASSERT_FALSE(hash.empty());
+    ASSERT_EQ(hash, computeNetworkHash(makeNetwork(2.f), "CPU", {}));
+}
+
+TEST_F(NetworkHashTests, hashDependsOnWeights) {
+    ASSERT_NE(computeNetworkHash(makeNetwork(2.f), "CPU", {}), computeNetworkHash(makeNetwork(3.f), "CPU", {}));
+}
+
+TEST_F(NetworkHashTests, hashDependsOnDeviceAndConfig) {
+    auto network = makeNetwork(2.f);
+    auto hash = computeNetworkHash(network, "CPU", {});
+    ASSERT_NE(hash, computeNetworkHash(network, "GPU", {}));
+    ASSERT_NE(hash, computeNetworkHash(network, "CPU", {{"CPU_THROUGHPUT_STREAMS", "2"}}));
+}
+
+TEST_F(NetworkHashTests, hashDependsOnInputsInfo) {
+    auto network = makeNetwork(2.f);
+    auto hash = computeNetworkHash(network, "CPU", {});
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    auto u8Hash = computeNetworkHash(network, "CPU", {});
+    ASSERT_NE(hash, u8Hash);
+    network.getInputsInfo().begin()->second->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+    ASSERT_NE(u8Hash, computeNetworkHash(network, "CPU", {}));
+}
+
+TEST_F(NetworkHashTests, hashIsSha256Digest) {
+    auto hash = computeNetworkHash(makeNetwork(2.f), "CPU", {});
+    ASSERT_EQ(64, hash.size());
+    ASSERT_EQ(std::string::npos, hash.find_first_not_of("0123456789abcdef"));
+}
+
+TEST_F(NetworkHashTests, hashDependsOnExtensions) {
+    auto network = makeNetwork(2.f);
+    auto hash = computeNetworkHash(network, "CPU", {});
+    IExtensionPtr extension(new OpsetExtension("custom_opset"), [](IExtension* ext) { ext->Release(); });
+    IExtensionPtr otherExtension(new OpsetExtension("other_opset"), [](IExtension* ext) { ext->Release(); });
+    auto extensionHash = computeNetworkHash(network, "CPU", {}, {extension});
+    ASSERT_NE(hash, extensionHash);
+    ASSERT_EQ(extensionHash, computeNetworkHash(network, "CPU", {}, {extension}));
+    ASSERT_NE(extensionHash, computeNetworkHash(network, "CPU", {}, {otherExtension}));
+}
+
+TEST_F(NetworkHashTests, hashDependsOnRuntimeInfo) {
+    auto hash = computeNetworkHash(makeNetwork(2.f), "CPU", {});
+    auto priorityHash = computeNetworkHash(makeNetwork(2.f, "cpu:jit_avx2"), "CPU", {});
+    ASSERT_FALSE(priorityHash.empty());
+    ASSERT_NE(hash, priorityHash);
+    ASSERT_EQ(priorityHash, computeNetworkHash(makeNetwork(2.f, "cpu:jit_avx2"), "CPU", {}));
+    ASSERT_NE(priorityHash, computeNetworkHash(makeNetwork(2.f, "cpu:ref_any"), "CPU", {}));
+}
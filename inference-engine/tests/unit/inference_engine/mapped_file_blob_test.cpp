@@ -0,0 +1,67 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "mapped_file_blob.hpp"
+
+using namespace InferenceEngine;
+
+class MappedFileBlobTests : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        data.resize(4099);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = static_cast<uint8_t>(i * 7);
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    const std::string fileName = "mapped_file_blob_test.bin";
+    std::vector<uint8_t> data;
+};
+
+TEST_F(MappedFileBlobTests, canMapFile) {
+    auto blob = MappedFileBlob::create(fileName);
+    ASSERT_NE(nullptr, blob);
+    ASSERT_EQ(data.size(), blob->size());
+    ASSERT_EQ(Precision::U8, blob->getTensorDesc().getPrecision());
+
+    auto mapped = blob->cbuffer().as<const uint8_t*>();
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(data[i], mapped[i]) << "at " << i;
+}
+
+TEST_F(MappedFileBlobTests, mappingsOfSameFileShareData) {
+    static_assert(std::is_const<MappedFileBlob::CPtr::element_type>::value, "the mapping is read-only");
+
+    auto first = MappedFileBlob::create(fileName);
+    auto second = MappedFileBlob::create(fileName);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(first->cbuffer().as<const uint8_t*>(), second->cbuffer().as<const uint8_t*>());
+
+    first.reset();
+    auto mapped = second->cbuffer().as<const uint8_t*>();
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(data[i], mapped[i]) << "at " << i;
+}
+
+TEST_F(MappedFileBlobTests, returnsNullForMissingFile) {
+    ASSERT_EQ(nullptr, MappedFileBlob::create("not_existing_file.bin"));
+}
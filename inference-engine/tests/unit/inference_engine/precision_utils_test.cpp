@@ -0,0 +1,118 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "precision_utils.h"
+
+using namespace InferenceEngine;
+
+namespace {
+
+uint32_t asUint(float value) {
+    uint32_t result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+float asFloat(uint32_t value) {
+    float result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+// values around all the branches of the scalar conversion
+std::vector<float> makeSpecialValues() {
+    std::vector<float> values = {
+        0.f, -0.f, 1.f, -1.f, 0.5f, 65504.f, -65504.f, 65519.f, 65520.f, 1e5f, -1e5f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN(), -std::numeric_limits<float>::quiet_NaN(),
+        asFloat(0x7FA00001u), asFloat(0xFFC12345u),                             // NaNs with payload
+        std::numeric_limits<float>::min(), std::numeric_limits<float>::denorm_min(),
+        -std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::max(),
+    };
+    // around minimal normal f16, its half and ULP boundaries of f16
+    for (uint32_t base : {0x38800000u, 0x38000000u, 0x3F800000u, 0x477FE000u, 0x33800000u}) {
+        for (int delta = -4; delta <= 4; delta++) {
+            values.push_back(asFloat(base + delta));
+            values.push_back(-asFloat(base + delta));
+            values.push_back(asFloat(base + (1u << 12) + delta));  // half of f16 ULP
+        }
+    }
+    return values;
+}
+
+}  // namespace
+
+TEST(PrecisionUtilsTests, f32tof16KeepsSignOfInfAndNan) {
+    ASSERT_EQ(0x7C00, static_cast<uint16_t>(PrecisionUtils::f32tof16(std::numeric_limits<float>::infinity())));
+    ASSERT_EQ(0xFC00, static_cast<uint16_t>(PrecisionUtils::f32tof16(-std::numeric_limits<float>::infinity())));
+    ASSERT_EQ(0x7E00, static_cast<uint16_t>(PrecisionUtils::f32tof16(std::numeric_limits<float>::quiet_NaN())));
+    ASSERT_EQ(0xFE00, static_cast<uint16_t>(PrecisionUtils::f32tof16(-std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST(PrecisionUtilsTests, f16tof32ArraysIsBitExactForAllValues) {
+    // every f16 value, the array is large enough to be converted in parallel
+    std::vector<ie_fp16> src(1 << 16);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<ie_fp16>(i);
+    }
+    for (float scale : {1.f, 0.3f}) {
+        for (float bias : {0.f, -2.5f}) {
+            std::vector<float> dst(src.size());
+            PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(), scale, bias);
+            for (size_t i = 0; i < src.size(); i++) {
+                ASSERT_EQ(asUint(PrecisionUtils::f16tof32(src[i]) * scale + bias), asUint(dst[i]))
+                    << "f16 value 0x" << std::hex << i << " scale " << scale << " bias " << bias;
+            }
+        }
+    }
+}
+
+TEST(PrecisionUtilsTests, f32tof16ArraysIsBitExactForSpecialValues) {
+    auto src = makeSpecialValues();
+    for (float scale : {1.f, 0.3f}) {
+        for (float bias : {0.f, -2.5f}) {
+            // every size up to two SIMD vectors to check the tails
+            for (size_t size = 1; size <= 33; size++) {
+                for (size_t offset = 0; offset + size <= src.size(); offset += size) {
+                    std::vector<ie_fp16> dst(size);
+                    PrecisionUtils::f32tof16Arrays(dst.data(), src.data() + offset, size, scale, bias);
+                    for (size_t i = 0; i < size; i++) {
+                        auto value = src[offset + i];
+                        ASSERT_EQ(PrecisionUtils::f32tof16(value * scale + bias), dst[i])
+                            << "f32 value 0x" << std::hex << asUint(value) << " scale " << scale << " bias " << bias;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(PrecisionUtilsTests, f32tof16ArraysIsBitExactForLargeArrays) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint32_t> distribution;
+    // random bit patterns cover denormals, NaNs and Infs, the array is converted in parallel
+    std::vector<float> src(1000003);
+    for (auto&& value : src) {
+        value = asFloat(distribution(generator));
+    }
+    std::vector<ie_fp16> dst(src.size());
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * 1.f + 0.f), dst[i]) << "f32 value 0x" << std::hex << asUint(src[i]);
+    }
+
+    std::vector<float> back(src.size());
+    PrecisionUtils::f16tof32Arrays(back.data(), dst.data(), dst.size());
+    for (size_t i = 0; i < dst.size(); i++) {
+        ASSERT_EQ(asUint(PrecisionUtils::f16tof32(dst[i]) * 1.f + 0.f), asUint(back[i]));
+    }
+}
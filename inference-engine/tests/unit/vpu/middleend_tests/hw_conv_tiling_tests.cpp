@@ -0,0 +1,145 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_parallel.hpp>
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace vpu {
+
+namespace ie = InferenceEngine;
+
+using namespace HWTilingNS;
+
+class HWConvTilingSearchTests : public ::testing::Test {
+protected:
+    static DimValues makeDims(int width, int height, int channels) {
+        return DimValues{{Dim::W, width}, {Dim::H, height}, {Dim::C, channels}, {Dim::N, 1}};
+    }
+
+    static ConvolutionOptions makeOptions(int size, int inChannels, int outChannels,
+                                          int kernelSize, int stride, bool withPool) {
+        const int pad = kernelSize / 2;
+        const int outSize = (size + 2 * pad - kernelSize) / stride + 1;
+        // the merged 2x2 pooling halves the output of the convolution
+        const auto origOutputDims = makeDims(outSize, outSize, outChannels);
+        const auto outputDims = withPool ? makeDims(outSize / 2, outSize / 2, outChannels) : origOutputDims;
+        return ConvolutionOptions("conv", makeDims(size, size, inChannels), outputDims, origOutputDims,
+                                  kernelSize, kernelSize, stride, pad, pad, pad, pad, withPool, numCMXSlices);
+    }
+
+    // the convolutions of a typical classification network, several of them are repeated
+    static std::vector<ConvolutionOptions> makeNetworkOptions() {
+        std::vector<ConvolutionOptions> options;
+        for (int repeat = 0; repeat < 2; ++repeat) {
+            options.push_back(makeOptions(224, 3, 64, 3, 1, false));
+            options.push_back(makeOptions(112, 64, 128, 3, 1, true));
+            options.push_back(makeOptions(56, 128, 256, 3, 1, false));
+            options.push_back(makeOptions(56, 256, 64, 1, 1, false));
+            options.push_back(makeOptions(28, 256, 512, 3, 2, false));
+            options.push_back(makeOptions(14, 512, 512, 3, 1, true));
+        }
+        return options;
+    }
+
+    static std::vector<TilingOption> search(const ConvolutionOptions& options, TilingCache* cache) {
+        return HWConvolutionTilingSearcher(options, Direction::INPUT_TO_OUTPUT, maxTilingOptions, cache).tilingOptions();
+    }
+
+    static void expectEqual(const std::vector<TilingOption>& expected, const std::vector<TilingOption>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(expected[i].numWidthTiles, actual[i].numWidthTiles);
+            EXPECT_EQ(expected[i].numHeightTiles, actual[i].numHeightTiles);
+            EXPECT_EQ(expected[i].numChannelTiles, actual[i].numChannelTiles);
+            EXPECT_EQ(expected[i].totalNumTiles, actual[i].totalNumTiles);
+            EXPECT_EQ(expected[i].cost, actual[i].cost);
+        }
+    }
+
+    static constexpr int numCMXSlices = 16;
+    static constexpr std::size_t maxTilingOptions = 3;
+};
+
+constexpr int HWConvTilingSearchTests::numCMXSlices;
+constexpr std::size_t HWConvTilingSearchTests::maxTilingOptions;
+
+TEST_F(HWConvTilingSearchTests, ParallelSearchMatchesSerialOne) {
+    const auto options = makeNetworkOptions();
+
+    std::vector<std::vector<TilingOption>> serial;
+    for (const auto& convOptions : options) {
+        serial.push_back(search(convOptions, nullptr));
+    }
+
+    std::vector<std::vector<TilingOption>> parallel(options.size());
+    TilingCache cache;
+    ie::parallel_for(options.size(), [&](size_t ind) {
+        parallel[ind] = search(options[ind], &cache);
+    });
+
+    for (size_t ind = 0; ind < options.size(); ++ind) {
+        ASSERT_NO_FATAL_FAILURE(expectEqual(serial[ind], parallel[ind])) << "convolution " << ind;
+    }
+}
+
+TEST_F(HWConvTilingSearchTests, CachedSearchMatchesFreshOne) {
+    const auto options = makeNetworkOptions();
+    const auto uniqueOptions = options.size() / 2;
+
+    TilingCache cache;
+    for (size_t ind = 0; ind < uniqueOptions; ++ind) {
+        search(options[ind], &cache);
+    }
+    EXPECT_EQ(0u, cache.hits());
+
+    // the repeated convolutions are taken from the cache
+    for (size_t ind = uniqueOptions; ind < options.size(); ++ind) {
+        const auto cached = search(options[ind], &cache);
+        ASSERT_NO_FATAL_FAILURE(expectEqual(search(options[ind], nullptr), cached)) << "convolution " << ind;
+    }
+    EXPECT_EQ(uniqueOptions, cache.hits());
+}
+
+TEST_F(HWConvTilingSearchTests, CacheDistinguishesConvolutionParameters) {
+    TilingCache cache;
+    search(makeOptions(56, 128, 256, 3, 1, false), &cache);
+    search(makeOptions(56, 128, 256, 3, 1, true), &cache);
+    search(makeOptions(56, 128, 256, 3, 2, false), &cache);
+    search(makeOptions(56, 128, 128, 3, 1, false), &cache);
+    EXPECT_EQ(0u, cache.hits());
+
+    const auto options = makeOptions(56, 128, 256, 3, 1, true);
+    ASSERT_NO_FATAL_FAILURE(expectEqual(search(options, nullptr), search(options, &cache)));
+    EXPECT_EQ(1u, cache.hits());
+}
+
+TEST_F(HWConvTilingSearchTests, TilerWithCacheProducesSameTilings) {
+    const auto options = makeOptions(112, 64, 128, 3, 1, true);
+
+    TilingCache cache;
+    const HWConvolutionTiler fresh(options, Direction::INPUT_TO_OUTPUT, 1);
+    const HWConvolutionTiler first(options, Direction::INPUT_TO_OUTPUT, 1, &cache);
+    const HWConvolutionTiler cached(options, Direction::INPUT_TO_OUTPUT, 1, &cache);
+    EXPECT_EQ(1u, cache.hits());
+
+    ASSERT_TRUE(fresh.isTilingPossible());
+    for (const auto& tiler : {&first, &cached}) {
+        ASSERT_EQ(fresh.isTilingPossible(), tiler->isTilingPossible());
+        ASSERT_EQ(fresh.getHwTilings().size(), tiler->getHwTilings().size());
+        for (size_t i = 0; i < fresh.getHwTilings().size(); ++i) {
+            const auto& expected = fresh.getHwTilings()[i];
+            const auto& actual = tiler->getHwTilings()[i];
+            EXPECT_EQ(expected->sohTiles, actual->sohTiles);
+            EXPECT_EQ(expected->sowTiles, actual->sowTiles);
+            EXPECT_EQ(expected->socTiles, actual->socTiles);
+            EXPECT_EQ(expected->planeTiles.size(), actual->planeTiles.size());
+        }
+    }
+}
+
+}  // namespace vpu
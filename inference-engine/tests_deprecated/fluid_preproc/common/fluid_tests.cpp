@@ -548,6 +548,42 @@ TEST_P(MergeTestGAPI, AccuracyTest)
     }
 }
 
+TEST_P(NormalizePlaneTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int depth   = std::get<0>(params);
+    cv::Size sz = std::get<1>(params);
+    double tolerance = std::get<2>(params);
+
+    const float mean  = 127.5f;
+    const float scale = 1.f / 58.f;
+
+    cv::Mat in_mat(sz, CV_MAKE_TYPE(depth, 1));
+    cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    cv::Mat out_mat_ocv;
+    cv::Mat out_mat_gapi(sz, CV_32FC1);
+
+    // G-API code //////////////////////////////////////////////////////////////
+    FluidNormalizePlaneComputation nc(to_test(in_mat), to_test(out_mat_gapi), mean, scale);
+    nc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ nc.apply(); },
+        400, "NormalizePlane GAPI %s %dx%d", typeToString(in_mat.type()).c_str(), sz.width, sz.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        in_mat.convertTo(out_mat_ocv, CV_32F, scale, -mean * scale);
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
+
 TEST_P(NV12toRGBTestGAPI, AccuracyTest)
 {
     const auto params = GetParam();
@@ -700,6 +736,122 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+TEST_P(BatchedResizeTestIE, AccuracyTest)
+{
+    int interp = 0;
+    cv::Size sz_out;
+    double tolerance = 0.0;
+    std::tie(interp, sz_out, tolerance) = GetParam();
+
+    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+
+    using namespace InferenceEngine;
+
+    const size_t channels = 3;
+    const cv::Size sz_frame(64, 48);
+    cv::Mat frame_mat(sz_frame, CV_8UC3);
+    cv::randn(frame_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    // HWC blob: channels are interleaved
+    Blob::Ptr frame_blob = make_blob_with_precision(
+        TensorDesc(Precision::U8, {1, channels, static_cast<size_t>(sz_frame.height),
+                                   static_cast<size_t>(sz_frame.width)}, Layout::NHWC),
+        frame_mat.data);
+    auto make_roi_blob = [&](const cv::Rect& rect) {
+        return make_shared_blob(frame_blob, ROI{0, static_cast<size_t>(rect.x), static_cast<size_t>(rect.y),
+                                                static_cast<size_t>(rect.width), static_cast<size_t>(rect.height)});
+    };
+    auto out_desc = [&](Precision precision, size_t batch, Layout layout) {
+        return TensorDesc(precision, {batch, channels, static_cast<size_t>(sz_out.height),
+                                      static_cast<size_t>(sz_out.width)}, layout);
+    };
+
+    ResizeAlgorithm algorithm = cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR;
+    PreProcessInfo info;
+    info.setResizeAlgorithm(algorithm);
+
+    // the ROIs are both smaller and larger than the output, so AREA upscale and downscale kernels are mixed
+    // in one batch, and the second set has other sizes of the same number of images
+    const std::vector<cv::Rect> rois_a = {cv::Rect(0, 0, 8, 6), cv::Rect(10, 4, 40, 30), cv::Rect(20, 20, 16, 16)};
+    const std::vector<cv::Rect> rois_b = {cv::Rect(5, 5, 24, 12), cv::Rect(30, 10, 10, 30), cv::Rect(1, 2, 60, 40)};
+
+    // Inference Engine code: every ROI alone ////////////////////////////////
+    auto resize_single = [&](const cv::Rect& rect) {
+        cv::Mat out_mat(sz_out, CV_8UC3);
+        Blob::Ptr out_blob = make_blob_with_precision(out_desc(Precision::U8, 1, Layout::NHWC), out_mat.data);
+        PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+        preprocess->setRoiBlob(make_roi_blob(rect));
+        preprocess->execute(out_blob, info, false);
+
+        // OpenCV code /////////////////////////////////////////////////////////
+        cv::Mat out_mat_ocv;
+        cv::resize(frame_mat(rect), out_mat_ocv, sz_out, 0, 0, interp);
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance);
+        return out_mat;
+    };
+
+    // Inference Engine code: all ROIs at once //////////////////////////////
+    // the same pre-processing object is used for all the calls, so the graphs are reused across ROI sizes
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    auto make_batched_blob = [&](const std::vector<cv::Rect>& rects) {
+        std::vector<Blob::Ptr> rois;
+        for (const auto& rect : rects) {
+            rois.push_back(make_roi_blob(rect));
+        }
+        return make_shared_blob<BatchedBlob>(rois);
+    };
+    auto check_batched = [&](const std::vector<cv::Rect>& rects) {
+        // NHWC images of the batch are stacked vertically
+        cv::Mat out_mat(cv::Size(sz_out.width, sz_out.height * static_cast<int>(rects.size())), CV_8UC3);
+        Blob::Ptr out_blob = make_blob_with_precision(out_desc(Precision::U8, rects.size(), Layout::NHWC),
+                                                      out_mat.data);
+        preprocess->setRoiBlob(make_batched_blob(rects));
+        preprocess->execute(out_blob, info, false);
+
+        // Comparison //////////////////////////////////////////////////////////
+        for (size_t i = 0; i < rects.size(); i++) {
+            cv::Mat image = out_mat.rowRange(static_cast<int>(i) * sz_out.height, static_cast<int>(i + 1) * sz_out.height);
+            EXPECT_EQ(0.0, cv::norm(resize_single(rects[i]), image, cv::NORM_INF)) << "image " << i;
+        }
+    };
+    check_batched(rois_a);
+    check_batched(rois_b);
+    check_batched(rois_a);
+
+    // Inference Engine code: mean values and scales fused into the batched resize
+    const std::vector<float> means = {100.f, 127.f, 20.f};
+    const std::vector<float> scales = {0.5f, 1.f, 2.f};
+    PreProcessInfo norm_info;
+    norm_info.setResizeAlgorithm(algorithm);
+    norm_info.init(channels);
+    for (size_t c = 0; c < channels; c++) {
+        norm_info[c]->meanValue = means[c];
+        norm_info[c]->stdScale = scales[c];
+    }
+    norm_info.setVariant(MEAN_VALUE);
+
+    Blob::Ptr norm_blob = make_blob_with_precision(out_desc(Precision::FP32, rois_b.size(), Layout::NCHW));
+    norm_blob->allocate();
+    preprocess->setRoiBlob(make_batched_blob(rois_b));
+    ASSERT_TRUE(preprocess->executeNormalized(norm_blob, norm_info, false));
+
+    // Comparison //////////////////////////////////////////////////////////////
+    const auto norm_data = norm_blob->cbuffer().as<const float*>();
+    const size_t plane_size = static_cast<size_t>(sz_out.area());
+    for (size_t i = 0; i < rois_b.size(); i++) {
+        cv::Mat image = resize_single(rois_b[i]);
+        for (size_t c = 0; c < channels; c++) {
+            for (int y = 0; y < sz_out.height; y++) {
+                for (int x = 0; x < sz_out.width; x++) {
+                    const float expected = (image.at<cv::Vec3b>(y, x)[c] - means[c]) * scales[c];
+                    ASSERT_NEAR(expected, norm_data[(i * channels + c) * plane_size + y * sz_out.width + x], 1e-4)
+                        << "image " << i << ", channel " << c << ", y " << y << ", x " << x;
+                }
+            }
+        }
+    }
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
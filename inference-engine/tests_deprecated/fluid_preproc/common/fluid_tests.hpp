@@ -15,6 +15,7 @@ struct ResizeRGB8UTestGAPI: public testing::TestWithParam<std::tuple<int, int, s
 struct SplitTestGAPI: public TestParams<std::tuple<int, int, cv::Size, double>> {};
 struct ChanToPlaneTestGAPI: public TestParams<std::tuple<int, int, cv::Size, double>> {};
 struct MergeTestGAPI: public TestParams<std::tuple<int, int, cv::Size, double>> {};
+struct NormalizePlaneTestGAPI: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct NV12toRGBTestGAPI: public TestParams<std::tuple<cv::Size, double>> {};
 struct I420toRGBTestGAPI: public TestParams<std::tuple<cv::Size, double>> {};
 struct ResizeRoiTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, cv::Rect, double>> {};
@@ -23,6 +24,10 @@ struct ResizeRGB8URoiTestGAPI: public testing::TestWithParam<std::tuple<int, int
 //------------------------------------------------------------------------------
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
+struct BatchedResizeTestIE: public testing::TestWithParam<std::tuple<int,       // interpolation
+                                                                    cv::Size,  // output size
+                                                                    double>>   // tolerance
+{};
 
 struct SplitTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct MergeTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
@@ -134,6 +134,11 @@ INSTANTIATE_TEST_CASE_P(MergeTestFluid, MergeTestGAPI,
                                 Values(TEST_SIZES),
                                 Values(0)));
 
+INSTANTIATE_TEST_CASE_P(NormalizePlaneTestFluid, NormalizePlaneTestGAPI,
+                        Combine(Values(CV_8U, CV_16U, CV_16S, CV_32F),
+                                Values(TEST_SIZES),
+                                Values(1e-5)));
+
 INSTANTIATE_TEST_CASE_P(NV12toRGBTestFluid, NV12toRGBTestGAPI,
                         Combine(Values(cv::Size(3840, 2160),
                                        cv::Size(1920, 1080),
@@ -191,6 +196,11 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+INSTANTIATE_TEST_CASE_P(BatchedResizeTestFluid, BatchedResizeTestIE,
+                        Combine(Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(cv::Size(16, 16), cv::Size(20, 12)),
+                                Values(1))); // error not more than 1 unit
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
@@ -185,6 +185,20 @@ FluidMergeComputation::FluidMergeComputation(std::vector<test::Mat> inMats, test
                                })
 {}
 
+static cv::GComputation buildNormalizePlaneComputation(float mean, float scale)
+{
+    cv::GMat in;
+    cv::GMat out = InferenceEngine::gapi::NormalizePlane::on(in, mean, scale);
+    return cv::GComputation(in, out);
+}
+
+FluidNormalizePlaneComputation::FluidNormalizePlaneComputation(test::Mat inMat, test::Mat outMat, float mean, float scale)
+    : FluidComputation(new Priv{buildNormalizePlaneComputation(mean, scale)
+                               ,{to_own(inMat)}
+                               ,{to_own(outMat)}
+                               })
+{}
+
 static cv::GComputation buildFluidNV12toRGBComputation()
 {
     cv::GMat in_y, in_uv;
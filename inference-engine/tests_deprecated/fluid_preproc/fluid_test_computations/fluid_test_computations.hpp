@@ -86,6 +86,12 @@ public:
     FluidMergeComputation(std::vector<test::Mat> inMats, test::Mat outMat);
 };
 
+class FLUID_COMPUTATION_VISIBILITY FluidNormalizePlaneComputation : public FluidComputation
+{
+public:
+    FluidNormalizePlaneComputation(test::Mat inMat, test::Mat outMat, float mean, float scale);
+};
+
 class FLUID_COMPUTATION_VISIBILITY FluidNV12toRGBComputation : public FluidComputation
 {
 public:
@@ -8,6 +8,10 @@
 #include "tests_common.hpp"
 #include <ie_core.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
 
 using namespace ::testing;
 using namespace std;
@@ -27,6 +31,9 @@ struct nmsTF_test_params {
     std::vector<int> ref;
 
     std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+
+    // if not zero, the inference and the reference are timed over the given number of runs
+    int benchmark_runs;
 };
 
 static float intersectionOverUnion(float* boxesI, float* boxesJ, bool center_point_box) {
@@ -116,7 +123,7 @@ static void ref_nms(
                     scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
             }
 
-            if (scores_vector.size()) {
+            if (scores_vector.size() && max_output_boxes_per_class > 0) {
                 std::sort(scores_vector.begin(), scores_vector.end(),
                           [](const std::pair<float, int>& l, const std::pair<float, int>& r) { return l.first > r.first; });
 
@@ -504,6 +511,20 @@ protected:
                 selected_indices_ref.allocate();
                 ref_nms(*srcBoxesPtr, *srcScoresPtr, selected_indices_ref, p);
                 compare(*output, selected_indices_ref);
+
+                if (p.benchmark_runs) {
+                    auto measure = [&](const std::function<void()>& run) {
+                        auto start = std::chrono::high_resolution_clock::now();
+                        for (int i = 0; i < p.benchmark_runs; i++)
+                            run();
+                        std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+                        return duration.count() / p.benchmark_runs;
+                    };
+                    double inferTime = measure([&] { graph.Infer(srcs, outputBlobs); });
+                    double refTime = measure([&] { ref_nms(*srcBoxesPtr, *srcScoresPtr, selected_indices_ref, p); });
+                    std::cout << "[ BENCHMARK ] NonMaxSuppression " << p.scoresDim[0] << "x" << p.scoresDim[1] << "x" << p.scoresDim[2]
+                              << ": " << inferTime << " ms, reference: " << refTime << " ms" << std::endl;
+                }
             } else {
                 //  Check results
                 if (p.ref.size() != output->size())
@@ -519,6 +540,62 @@ protected:
 
 TEST_P(MKLDNNCPUExtNonMaxSuppressionTFTests, TestsNonMaxSuppression) {}
 
+// Detection-like input: boxes are clustered around a grid of anchors, scores are distinct
+// so the order of the selected boxes does not depend on the sort stability
+static nmsTF_test_params realistic_params(size_t batches, size_t classes, size_t boxes_num, int max_output_boxes_per_class,
+                                          int center_point_box, int benchmark_runs) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+
+    nmsTF_test_params p{};
+    p.center_point_box = center_point_box;
+    p.sort_result_descending = 1;
+    p.scoresDim = { batches, classes, boxes_num };
+    p.max_output_boxes_per_class = { max_output_boxes_per_class };
+    p.iou_threshold = { 0.5f };
+    p.score_threshold = { 0.05f };
+    p.num_selected_indices = static_cast<int>(batches * classes) * max_output_boxes_per_class;
+    p.benchmark_runs = benchmark_runs;
+
+    const size_t grid = 32;
+    for (size_t i = 0; i < batches * boxes_num; i++) {
+        float y = (((i / grid) % grid) + dist(gen)) / grid;
+        float x = ((i % grid) + dist(gen)) / grid;
+        float h = 0.02f + 0.2f * dist(gen);
+        float w = 0.02f + 0.2f * dist(gen);
+        if (center_point_box)
+            p.boxes.insert(p.boxes.end(), { x, y, w, h });
+        else
+            p.boxes.insert(p.boxes.end(), { y - h / 2, x - w / 2, y + h / 2, x + w / 2 });
+    }
+
+    std::vector<size_t> order(batches * classes * boxes_num);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), gen);
+    p.scores.resize(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        float score = static_cast<float>(order[i] + 1) / (order.size() + 1);
+        p.scores[i] = score * score * score;
+    }
+    return p;
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsNonMaxSuppressionRealistic, MKLDNNCPUExtNonMaxSuppressionTFTests,
+        ::testing::Values(
+            realistic_params(1, 8, 2000, 50, 0, 0),
+            realistic_params(2, 4, 1000, 100, 1, 0)
+));
+
+// Prints the inference and reference timings, run with --gtest_also_run_disabled_tests
+INSTANTIATE_TEST_CASE_P(
+        DISABLED_TestsNonMaxSuppressionBenchmark, MKLDNNCPUExtNonMaxSuppressionTFTests,
+        ::testing::Values(
+            realistic_params(1, 80, 20000, 100, 0, 10),
+            realistic_params(2, 80, 8000, 200, 0, 10),
+            realistic_params(1, 91, 12000, 100, 1, 10)
+));
+
 static std::vector<float> boxes = { 0.0, 0.0, 1.0, 1.0, 0.0, 0.1, 1.0, 1.1, 0.0, -0.1, 1.0, 0.9, 0.0, 10.0, 1.0, 11.0, 0.0, 10.1, 1.0, 11.1, 0.0, 100.0, 1.0, 101.0 };
 static std::vector<float> scores = { 0.9f, 0.75f, 0.6f, 0.95f, 0.5f, 0.3f };
 static std::vector<int> reference = { 0,0,3,0,0,0,0,0,5 };
@@ -542,6 +619,8 @@ INSTANTIATE_TEST_CASE_P(
 
             nmsTF_test_params{ 0, 1,{ 1,1,1 },{ 0.0, 0.0, 1.0, 1.0 }, { 0.9 },{ 3 },{ 0.5 },{ 0.0 }, 1, { 0,0,0 } }, /*nonmaxsuppression_single_box*/
 
+            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 0 }, { 0.5 }, { 0.0 }, 3, { -1,-1,-1,-1,-1,-1,-1,-1,-1 } }, /*nonmaxsuppression_zero_max_output_boxes*/
+
             nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 3 }, { 0.5 }, { 0.0 }, 3, reference }, /*nonmaxsuppression_suppress_by_IOU*/
 
             nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 3 }, { 0.5 }, { 0.4 }, 2, { 0,0,3,0,0,0 } }, /*nonmaxsuppression_suppress_by_IOU_and_scores*/
@@ -7,6 +7,7 @@
 #include "single_layer_common.hpp"
 #include "tests_common.hpp"
 #include <ie_core.hpp>
+#include <ie_system_conf.h>
 
 
 using namespace ::testing;
@@ -531,5 +532,307 @@ INSTANTIATE_TEST_CASE_P(
                 reduce_test_params{ "ReduceSumSquare", true,{ 10, 10, 2 },"FP32",{},{ 2 },{ 10, 10, 1 },{} },
                 reduce_test_params{ "ReduceSumSquare", true, { 3, 2, 2 },"FP32",{},{ 1 },{ 3, 1, 2 },{ 10, 20, 74, 100, 202, 244 } },
                 reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },"FP32",{},{ 1 },{ 3, 2 },{ 10, 20, 74, 100, 202, 244 } },
-                reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },"FP32",{},{ 0, 1, 2 },{ },{ 650 } }
+                reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },"FP32",{},{ 0, 1, 2 },{ },{ 650 } },
+// Long rows and columns go through the vectorized and unrolled parts of the kernel
+                reduce_test_params{ "ReduceSum", true,{ 2, 5, 70 },"FP32",{},{ 2 },{ 2, 5, 1 },{} },
+                reduce_test_params{ "ReduceSum", false,{ 3, 40, 41 },"FP32",{},{ 0, 2 },{ 40 },{} },
+                reduce_test_params{ "ReduceMax", true,{ 2, 70, 37 },"FP32",{},{ 1 },{ 2, 1, 37 },{} },
+                reduce_test_params{ "ReduceMin", false,{ 4, 3, 67 },"FP32",{},{ 0, 1 },{ 67 },{} },
+                reduce_test_params{ "ReduceMean", true,{ 2, 3, 16, 9 },"FP32",{},{ 2, 3 },{ 2, 3, 1, 1 },{} },
+                reduce_test_params{ "ReduceL1", true,{ 2, 3, 16, 9 },"FP32",{},{ 0, 2 },{ 1, 3, 1, 9 },{} }
+));
+
+struct reduce_layout_test_params {
+    std::string                 reduce_type;
+    InferenceEngine::SizeVector in_shape;
+    std::string                 inType;
+    std::vector<int32_t>        axes_for_reduction;
+    // axes of the second inference, the axes are read from an input if it is not empty
+    std::vector<int32_t>        second_axes;
+    std::string                 format;
+    std::string                 fused_type;
+};
+
+class MKLDNNCPUExtReduceLayoutTests : public TestsCommon, public WithParamInterface<reduce_layout_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="Reduce_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="_IP_" id="1">
+            <output>
+                <port id="1">
+                    _IN_
+                </port>
+            </output>
+        </layer>
+        <layer name="axes_for_reduction" type="_AXES_TYPE_" precision="I32" id="2">
+            <output>
+                <port id="2">
+                    <dim>_DIM_SIZE_</dim>
+                </port>
+            </output>
+            _AXES_BLOBS_
+        </layer>
+        <layer name="reduce" id="3" type="_REDUCE_TYPE_">
+            <data keep_dims="1" _FORMATS_/>
+            <input>
+                <port id="1" precision="_IP_">
+                    _IN_
+                </port>
+                <port id="2" precision="I32">
+                    <dim>_DIM_SIZE_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3" precision="_IP_">
+                    _OUT_
+                </port>
+            </output>
+        </layer>
+        _FUSED_LAYERS_
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="2"/>
+        _FUSED_EDGES_
+    </edges>
+</net>
+)V0G0N";
+
+    std::string relu_t = R"V0G0N(
+        <layer name="relu" id="4" type="ReLU" precision="FP32">
+            <input>
+                <port id="1">
+                    _OUT_
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    _OUT_
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string fake_quantize_t = R"V0G0N(
+        <layer name="quantize" id="4" type="FakeQuantize" precision="FP32">
+            <data levels="256"/>
+            <input>
+                <port id="1">
+                    _OUT_
+                </port>
+                <port id="2"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+                <port id="3"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+                <port id="4"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+                <port id="5"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+            </input>
+            <output>
+                <port id="6">
+                    _OUT_
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string fake_quantize_const_t = R"V0G0N(
+        <layer name="quantize_const_ID_" id="_ID_" type="Const" precision="FP32">
+            <output>
+                <port id="1"><dim>1</dim><dim>1</dim><dim>1</dim><dim>1</dim></port>
+            </output>
+            <blobs>
+                <custom offset="_OFFSET_" size="4"/>
+            </blobs>
+        </layer>
+)V0G0N";
+
+    std::string getDims(const InferenceEngine::SizeVector &dims) {
+        std::string str;
+        for (auto dim : dims)
+            str += "<dim>" + std::to_string(dim) + "</dim>\n";
+        return str;
+    }
+
+    std::string getModel(reduce_layout_test_params p, const InferenceEngine::SizeVector &out_shape) {
+        std::string model = model_t;
+        std::string fused_layers, fused_edges;
+        if (p.fused_type == "ReLU") {
+            fused_layers = relu_t;
+            fused_edges = "<edge from-layer=\"3\" from-port=\"3\" to-layer=\"4\" to-port=\"1\"/>";
+        } else if (p.fused_type == "FakeQuantize") {
+            fused_layers = fake_quantize_t;
+            fused_edges = "<edge from-layer=\"3\" from-port=\"3\" to-layer=\"4\" to-port=\"1\"/>";
+            for (size_t i = 0; i < 4; i++) {
+                std::string layer = fake_quantize_const_t;
+                REPLACE_WITH_NUM(layer, "_ID_", 5 + i);
+                REPLACE_WITH_NUM(layer, "_OFFSET_", (p.axes_for_reduction.size() + i) * sizeof(float));
+                fused_layers += layer;
+                fused_edges += "<edge from-layer=\"" + std::to_string(5 + i) + "\" from-port=\"1\" to-layer=\"4\" to-port=\"" +
+                               std::to_string(2 + i) + "\"/>";
+            }
+        }
+        REPLACE_WITH_STR(model, "_FUSED_LAYERS_", fused_layers);
+        REPLACE_WITH_STR(model, "_FUSED_EDGES_", fused_edges);
+
+        if (p.second_axes.empty()) {
+            REPLACE_WITH_STR(model, "_AXES_TYPE_", "Const");
+            REPLACE_WITH_STR(model, "_AXES_BLOBS_", "<blobs><custom offset=\"0\" size=\"" +
+                             std::to_string(p.axes_for_reduction.size() * sizeof(int32_t)) + "\"/></blobs>");
+        } else {
+            REPLACE_WITH_STR(model, "_AXES_TYPE_", "Input");
+            REPLACE_WITH_STR(model, "_AXES_BLOBS_", "");
+        }
+        REPLACE_WITH_STR(model, "_FORMATS_", p.format.empty() ? "" :
+                         "InputMemoryFormats=\"cpu:" + p.format + "\" OutputMemoryFormats=\"cpu:" + p.format + "\"");
+
+        REPLACE_WITH_STR(model, "_IN_", getDims(p.in_shape));
+        REPLACE_WITH_STR(model, "_OUT_", getDims(out_shape));
+        REPLACE_WITH_STR(model, "_IP_", p.inType);
+        REPLACE_WITH_NUM(model, "_DIM_SIZE_", p.axes_for_reduction.size());
+        REPLACE_WITH_STR(model, "_REDUCE_TYPE_", p.reduce_type);
+        return model;
+    }
+
+protected:
+    // fake quantization with the step 0.1 of the values [0, 255], the reduced values are integers, so there are no ties
+    const std::vector<float> quantizeParams = { 0.f, 255.f, 0.f, 25.5f };
+
+    float quantize(float x) {
+        const float levels = 256.f;
+        if (x <= quantizeParams[0])
+            return quantizeParams[2];
+        if (x > quantizeParams[1])
+            return quantizeParams[3];
+        return std::round((x - quantizeParams[0]) / (quantizeParams[1] - quantizeParams[0]) * (levels - 1)) / (levels - 1) *
+               (quantizeParams[3] - quantizeParams[2]) + quantizeParams[2];
+    }
+
+    template <typename T>
+    void inferAndCompare(MKLDNNGraphTestClass &graph, const reduce_layout_test_params &p, const InferenceEngine::CNNNetwork &network,
+                         const std::vector<int32_t> &axes) {
+        auto item = *network.getOutputsInfo().begin();
+        InferenceEngine::BlobMap srcs, outputBlobs;
+
+        auto src = InferenceEngine::make_shared_blob<T>({network.getInputsInfo().at("input")->getPrecision(), p.in_shape,
+                                                         InferenceEngine::TensorDesc::getLayoutByDims(p.in_shape)});
+        src->allocate();
+        // negative values are required to check the fused ReLU
+        for (size_t i = 0; i < src->size(); i++)
+            src->data()[i] = static_cast<T>(static_cast<int>(i % 37) - 9);
+        srcs["input"] = src;
+
+        if (!p.second_axes.empty()) {
+            InferenceEngine::SizeVector axes_dims(1, axes.size());
+            auto axesBlob = InferenceEngine::make_shared_blob<int32_t>({InferenceEngine::Precision::I32, axes_dims, InferenceEngine::C});
+            axesBlob->allocate();
+            std::copy(axes.begin(), axes.end(), axesBlob->buffer().as<int32_t *>());
+            srcs["axes_for_reduction"] = axesBlob;
+        }
+
+        auto output = InferenceEngine::make_shared_blob<T>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+        graph.Infer(srcs, outputBlobs);
+
+        InferenceEngine::TBlob<T> dst_ref(item.second->getTensorDesc());
+        dst_ref.allocate();
+        InferenceEngine::SizeVector out_dims;
+        ref_reduce<T, T>(p.reduce_type, *src, true, axes, dst_ref, out_dims);
+        for (size_t i = 0; i < dst_ref.size(); i++) {
+            if (p.fused_type == "ReLU")
+                dst_ref.data()[i] = (std::max)(dst_ref.data()[i], static_cast<T>(0));
+            else if (p.fused_type == "FakeQuantize")
+                dst_ref.data()[i] = static_cast<T>(quantize(static_cast<float>(dst_ref.data()[i])));
+        }
+
+        for (size_t i = 0; i < dst_ref.size(); i++)
+            ASSERT_NEAR(static_cast<float>(dst_ref.data()[i]), static_cast<float>(output->data()[i]), 0.01f) << "index=" << i;
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            reduce_layout_test_params p = ::testing::WithParamInterface<reduce_layout_test_params>::GetParam();
+            if ((p.format == "nChw16c" && !InferenceEngine::with_cpu_x86_avx512f()) ||
+                (p.format == "nChw8c" && InferenceEngine::with_cpu_x86_avx512f()) ||
+                (!p.format.empty() && !InferenceEngine::with_cpu_x86_sse42()))
+                GTEST_SKIP() << "The layout is not supported by the CPU";
+
+            InferenceEngine::SizeVector out_shape = p.in_shape;
+            for (auto axis : p.axes_for_reduction)
+                out_shape[axis < 0 ? axis + out_shape.size() : axis] = 1;
+
+            InferenceEngine::TBlob<uint8_t>::Ptr weights = InferenceEngine::make_shared_blob<uint8_t>(
+                {InferenceEngine::Precision::U8, {(p.axes_for_reduction.size() + quantizeParams.size()) * sizeof(int32_t)}, InferenceEngine::C});
+            weights->allocate();
+            std::copy(p.axes_for_reduction.begin(), p.axes_for_reduction.end(), weights->buffer().as<int32_t *>());
+            std::copy(quantizeParams.begin(), quantizeParams.end(), weights->buffer().as<float *>() + p.axes_for_reduction.size());
+
+            InferenceEngine::Core core;
+            InferenceEngine::CNNNetwork network;
+            ASSERT_NO_THROW(network = core.ReadNetwork(getModel(p, out_shape), weights));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(network);
+
+            for (auto &node : graph.getNodes()) {
+                // the fused operation is applied by the reduce kernel
+                ASSERT_NE(MKLDNNPlugin::Activation, node->getType());
+                ASSERT_NE(MKLDNNPlugin::Quantize, node->getType());
+                if (node->getType() != MKLDNNPlugin::Reduce)
+                    continue;
+
+                auto desc = node->getParentEdgeAt(0)->getDesc();
+                if (p.format == "nhwc") {
+                    ASSERT_EQ(InferenceEngine::NHWC, desc.getLayout());
+                } else if (!p.format.empty()) {
+                    ASSERT_EQ(p.in_shape.size() + 1, desc.getBlockingDesc().getBlockDims().size());
+                    ASSERT_EQ(p.format == "nChw16c" ? 16u : 8u, desc.getBlockingDesc().getBlockDims().back());
+                }
+            }
+
+            if (p.inType == "FP32") {
+                inferAndCompare<float>(graph, p, network, p.axes_for_reduction);
+            } else if (p.inType == "I32") {
+                inferAndCompare<int32_t>(graph, p, network, p.axes_for_reduction);
+            }
+
+            // the node prepares the reduction again only if the axes are changed
+            if (!p.second_axes.empty()) {
+                inferAndCompare<float>(graph, p, network, p.second_axes);
+                inferAndCompare<float>(graph, p, network, p.second_axes);
+                inferAndCompare<float>(graph, p, network, p.axes_for_reduction);
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtReduceLayoutTests, TestsReduceLayouts) {}
+
+INSTANTIATE_TEST_CASE_P(
+    TestsReduceLayouts, MKLDNNCPUExtReduceLayoutTests,
+            ::testing::Values(
+// Params: reduce_type, in_shape, inType, axes_for_reduction, second_axes, format, fused_type
+                reduce_layout_test_params{ "ReduceSum", { 2, 19, 5, 7 }, "FP32", { 2, 3 }, {}, "nhwc", "" },
+                reduce_layout_test_params{ "ReduceMean", { 2, 19, 5, 7 }, "FP32", { 0, 3 }, {}, "nhwc", "" },
+                reduce_layout_test_params{ "ReduceMax", { 2, 19, 5, 7 }, "I32", { 2 }, {}, "nhwc", "" },
+                reduce_layout_test_params{ "ReduceSum", { 2, 19, 5, 7 }, "I32", { 2, 3 }, {}, "nChw8c", "" },
+                reduce_layout_test_params{ "ReduceSum", { 2, 19, 5, 7 }, "I32", { 2, 3 }, {}, "nChw16c", "" },
+// Channels which are not a multiple of the block have the padding cleared after the reduction
+                reduce_layout_test_params{ "ReduceL2", { 2, 5, 6, 4 }, "FP32", { 2, 3 }, {}, "nChw8c", "" },
+                reduce_layout_test_params{ "ReduceL2", { 2, 5, 6, 4 }, "FP32", { 2, 3 }, {}, "nChw16c", "" },
+                reduce_layout_test_params{ "ReduceLogSumExp", { 1, 21, 3, 4 }, "FP32", { 0, 2 }, {}, "nChw8c", "" },
+                reduce_layout_test_params{ "ReduceLogSumExp", { 1, 21, 3, 4 }, "FP32", { 0, 2 }, {}, "nChw16c", "" },
+                reduce_layout_test_params{ "ReduceMax", { 2, 3, 5, 7 }, "I32", { 3 }, {}, "nChw8c", "" },
+                reduce_layout_test_params{ "ReduceMax", { 2, 3, 5, 7 }, "I32", { 3 }, {}, "nChw16c", "" },
+// Fused operations
+                reduce_layout_test_params{ "ReduceMin", { 2, 19, 5, 7 }, "FP32", { 2, 3 }, {}, "nhwc", "ReLU" },
+                reduce_layout_test_params{ "ReduceMin", { 2, 19, 5, 7 }, "FP32", { 2, 3 }, {}, "nChw8c", "ReLU" },
+                reduce_layout_test_params{ "ReduceMin", { 2, 19, 5, 7 }, "FP32", { 2, 3 }, {}, "nChw16c", "ReLU" },
+                reduce_layout_test_params{ "ReduceSum", { 1, 10, 6, 6 }, "FP32", { 2, 3 }, {}, "nhwc", "FakeQuantize" },
+                reduce_layout_test_params{ "ReduceSum", { 1, 10, 6, 6 }, "FP32", { 2, 3 }, {}, "nChw8c", "FakeQuantize" },
+                reduce_layout_test_params{ "ReduceSum", { 1, 10, 6, 6 }, "FP32", { 2, 3 }, {}, "nChw16c", "FakeQuantize" },
+// Axes which are changed between the inferences, the output shape is kept by the axes of size 1 and duplicates
+                reduce_layout_test_params{ "ReduceSum", { 1, 4, 5, 6 }, "FP32", { 2, 2 }, { 0, 2 }, "", "" },
+                reduce_layout_test_params{ "ReduceMean", { 1, 4, 5, 6 }, "FP32", { 3, 0 }, { -1, -1 }, "", "" }
 ));
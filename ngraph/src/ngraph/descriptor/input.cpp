@@ -50,6 +50,7 @@ descriptor::Input::~Input()
 
 void descriptor::Input::replace_output(Output& new_output)
 {
+    Node::update_graph_version();
     if (m_output != nullptr)
     {
         m_output->remove_input(this);
@@ -74,6 +75,7 @@ void descriptor::Input::replace_output(std::shared_ptr<Node> node, size_t i)
 
 void descriptor::Input::remove_output()
 {
+    Node::update_graph_version();
     if (m_output != nullptr)
     {
         m_output->remove_input(this);
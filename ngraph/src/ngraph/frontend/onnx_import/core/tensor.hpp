@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -23,6 +25,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -411,6 +414,10 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (has_external_data())
+                {
+                    return get_external_data<T>();
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -504,11 +511,63 @@ namespace ngraph
             }
 
         private:
+            bool has_external_data() const
+            {
+                return m_tensor_proto->data_location() ==
+                       ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
+            }
+
+            template <typename T>
+            std::vector<T> get_external_data() const
+            {
+                if (sizeof(T) != get_ng_type().size())
+                {
+                    throw error::tensor::invalid_data_type{m_tensor_proto->data_type()};
+                }
+                const auto buffer =
+                    detail::TensorExternalData{*m_tensor_proto}.load_external_data();
+                std::vector<T> data(buffer->size() / sizeof(T));
+                std::memcpy(data.data(), buffer->get_ptr(), data.size() * sizeof(T));
+                return data;
+            }
+
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                const std::size_t byte_size = shape_size(m_shape) * type.size();
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (has_external_data())
+                {
+                    const auto buffer =
+                        detail::TensorExternalData{*m_tensor_proto}.load_external_data();
+                    if (buffer->size() != byte_size)
+                    {
+                        throw error::tensor::invalid_external_data{
+                            "the size of the data does not match the shape of tensor '" +
+                            m_tensor_proto->name() + "'"};
+                    }
+                    if (reinterpret_cast<std::uintptr_t>(buffer->get_ptr()) % alignof(T) == 0)
+                    {
+                        // The constant shares the mapped file instead of copying it
+                        constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                    else
+                    {
+                        constant = std::make_shared<ngraph::op::Constant>(
+                            type, m_shape, buffer->get_ptr());
+                    }
+                }
+                else if (m_tensor_proto->has_raw_data() && !m_tensor_proto->has_segment() &&
+                         m_tensor_proto->raw_data().size() == byte_size)
+                {
+                    // Copy the raw data straight into the constant, without a temporary vector
+                    constant = std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                else
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -24,6 +24,7 @@
 #include "ngraph/except.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -53,6 +54,12 @@ namespace ngraph
         }     // namespace detail
 
         std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        {
+            return import_onnx_model(stream, "");
+        }
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path)
         {
             ONNX_NAMESPACE::ModelProto model_proto;
             // Try parsing input as a binary protobuf message
@@ -69,6 +76,8 @@ namespace ngraph
                 }
             }
 
+            detail::update_external_data_paths(model_proto, model_path);
+
             Model model{model_proto};
             Graph graph{model_proto.graph(), model};
             auto function = std::make_shared<Function>(
@@ -87,7 +96,7 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            return import_onnx_model(ifs, file_path);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
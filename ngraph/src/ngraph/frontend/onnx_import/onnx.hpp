@@ -68,6 +68,22 @@ namespace ngraph
         ONNX_IMPORTER_API
         std::shared_ptr<Function> import_onnx_model(std::istream& stream);
 
+        /// \brief      Imports and converts an serialized ONNX model from the input stream
+        ///             to an nGraph Function representation.
+        ///
+        /// \note       Tensors stored in external data files are looked up relative to the
+        ///             directory of model_path, as if the model was read from that file. They
+        ///             are memory mapped and shared by the created Constant nodes instead of
+        ///             being copied, and the model protobuf is released before returning.
+        ///
+        /// \param[in]  stream      The input stream (e.g. file stream, memory stream, etc).
+        /// \param[in]  model_path  The path of the file the stream was opened from.
+        ///
+        /// \return     An nGraph function that represents a single output from the created graph.
+        ONNX_IMPORTER_API
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path);
+
         /// \brief     Imports and converts an ONNX model from the input file
         ///            to an nGraph Function representation.
         ///
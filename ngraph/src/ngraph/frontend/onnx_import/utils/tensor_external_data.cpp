@@ -0,0 +1,310 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "tensor_external_data.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            namespace
+            {
+                /// \brief Maps [offset, offset + length) of the file copy-on-write, or returns
+                ///        nullptr if the platform refuses to map it.
+                std::shared_ptr<runtime::AlignedBuffer>
+                    map_file(const std::string& path, std::size_t offset, std::size_t length)
+                {
+#ifdef _WIN32
+                    SYSTEM_INFO system_info;
+                    GetSystemInfo(&system_info);
+                    const std::size_t map_offset =
+                        offset - offset % system_info.dwAllocationGranularity;
+                    HANDLE file = CreateFileA(path.c_str(),
+                                              GENERIC_READ,
+                                              FILE_SHARE_READ,
+                                              nullptr,
+                                              OPEN_EXISTING,
+                                              FILE_ATTRIBUTE_NORMAL,
+                                              nullptr);
+                    if (file == INVALID_HANDLE_VALUE)
+                    {
+                        return nullptr;
+                    }
+                    HANDLE mapping_handle =
+                        CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                    CloseHandle(file);
+                    if (mapping_handle == nullptr)
+                    {
+                        return nullptr;
+                    }
+                    void* data = MapViewOfFile(mapping_handle,
+                                               FILE_MAP_COPY,
+                                               static_cast<DWORD>(uint64_t(map_offset) >> 32),
+                                               static_cast<DWORD>(map_offset & 0xFFFFFFFF),
+                                               length + (offset - map_offset));
+                    CloseHandle(mapping_handle);
+                    if (data == nullptr)
+                    {
+                        return nullptr;
+                    }
+                    std::shared_ptr<void> mapping(data, [](void* ptr) { UnmapViewOfFile(ptr); });
+#else
+                    const std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+                    const std::size_t map_offset = offset - offset % page_size;
+                    const std::size_t map_size = length + (offset - map_offset);
+                    int fd = open(path.c_str(), O_RDONLY);
+                    if (fd == -1)
+                    {
+                        return nullptr;
+                    }
+                    void* data = mmap(nullptr,
+                                      map_size,
+                                      PROT_READ | PROT_WRITE,
+                                      MAP_PRIVATE,
+                                      fd,
+                                      static_cast<off_t>(map_offset));
+                    close(fd);
+                    if (data == MAP_FAILED)
+                    {
+                        return nullptr;
+                    }
+                    std::shared_ptr<void> mapping(data,
+                                                  [map_size](void* ptr) { munmap(ptr, map_size); });
+#endif
+                    char* tensor_data = static_cast<char*>(data) + (offset - map_offset);
+                    return std::make_shared<runtime::SharedBuffer<std::shared_ptr<void>>>(
+                        tensor_data, length, mapping);
+                }
+
+                /// \brief Checks both POSIX and Windows forms, a model file can come from either.
+                bool is_absolute_path(const std::string& path)
+                {
+                    return (!path.empty() && (path[0] == '/' || path[0] == '\\')) ||
+                           (path.size() > 1 && path[1] == ':');
+                }
+
+                bool has_parent_directory_component(const std::string& path)
+                {
+                    std::size_t begin = 0;
+                    while (begin <= path.size())
+                    {
+                        std::size_t end = path.find_first_of("/\\", begin);
+                        if (end == std::string::npos)
+                        {
+                            end = path.size();
+                        }
+                        if (path.compare(begin, end - begin, "..") == 0)
+                        {
+                            return true;
+                        }
+                        begin = end + 1;
+                    }
+                    return false;
+                }
+
+                void update_external_data_paths(ONNX_NAMESPACE::TensorProto& tensor,
+                                                const std::string& model_dir)
+                {
+                    if (tensor.data_location() !=
+                        ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL)
+                    {
+                        return;
+                    }
+                    for (auto& entry : *tensor.mutable_external_data())
+                    {
+                        if (entry.key() != "location")
+                        {
+                            continue;
+                        }
+                        // The data must stay within the directory of the model
+                        if (is_absolute_path(entry.value()))
+                        {
+                            throw error::tensor::invalid_external_data{
+                                "the location of tensor '" + tensor.name() +
+                                "' is an absolute path: " + entry.value()};
+                        }
+                        if (has_parent_directory_component(entry.value()))
+                        {
+                            throw error::tensor::invalid_external_data{
+                                "the location of tensor '" + tensor.name() +
+                                "' refers to a parent directory: " + entry.value()};
+                        }
+                        if (!model_dir.empty())
+                        {
+                            entry.set_value(file_util::path_join(model_dir, entry.value()));
+                        }
+                    }
+                }
+
+                void update_external_data_paths(ONNX_NAMESPACE::GraphProto& graph,
+                                                const std::string& model_dir)
+                {
+                    for (auto& initializer : *graph.mutable_initializer())
+                    {
+                        update_external_data_paths(initializer, model_dir);
+                    }
+                    // Tensor attributes (e.g. the value of a Constant node) and subgraphs
+                    // can refer to external data too.
+                    for (auto& node : *graph.mutable_node())
+                    {
+                        for (auto& attribute : *node.mutable_attribute())
+                        {
+                            if (attribute.has_t())
+                            {
+                                update_external_data_paths(*attribute.mutable_t(), model_dir);
+                            }
+                            for (auto& tensor : *attribute.mutable_tensors())
+                            {
+                                update_external_data_paths(tensor, model_dir);
+                            }
+                            if (attribute.has_g())
+                            {
+                                update_external_data_paths(*attribute.mutable_g(), model_dir);
+                            }
+                            for (auto& subgraph : *attribute.mutable_graphs())
+                            {
+                                update_external_data_paths(subgraph, model_dir);
+                            }
+                        }
+                    }
+                }
+            }
+
+            TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                for (const auto& entry : tensor.external_data())
+                {
+                    try
+                    {
+                        if (entry.key() == "location")
+                        {
+                            m_data_location = entry.value();
+                        }
+                        else if (entry.key() == "offset")
+                        {
+                            m_offset = std::stoull(entry.value());
+                        }
+                        else if (entry.key() == "length")
+                        {
+                            m_data_length = std::stoull(entry.value());
+                        }
+                        else if (entry.key() == "checksum")
+                        {
+                            m_sha1_digest = entry.value();
+                        }
+                    }
+                    catch (const std::logic_error&)
+                    {
+                        throw error::tensor::invalid_external_data{
+                            "the value of '" + entry.key() + "' is not a number: " +
+                            entry.value()};
+                    }
+                }
+                if (m_data_location.empty())
+                {
+                    throw error::tensor::invalid_external_data{
+                        "the location of tensor '" + tensor.name() + "' is not specified"};
+                }
+            }
+
+            std::shared_ptr<runtime::AlignedBuffer> TensorExternalData::load_external_data() const
+            {
+                std::ifstream external_data_stream(m_data_location,
+                                                   std::ios::binary | std::ios::in |
+                                                       std::ios::ate);
+                if (external_data_stream.fail())
+                {
+                    throw error::tensor::invalid_external_data{"cannot open " + to_string()};
+                }
+                const std::size_t file_size = external_data_stream.tellg();
+                // The length is optional, the data then runs to the end of the file
+                const std::size_t data_length =
+                    m_data_length > 0 ? m_data_length
+                                      : (m_offset < file_size ? file_size - m_offset : 0);
+                if (m_offset > file_size || data_length > file_size - m_offset)
+                {
+                    throw error::tensor::invalid_external_data{
+                        "the data is out of the bounds of the file, " + to_string()};
+                }
+                if (data_length == 0)
+                {
+                    return std::make_shared<runtime::AlignedBuffer>();
+                }
+
+                if (auto mapped = map_file(m_data_location, m_offset, data_length))
+                {
+                    return mapped;
+                }
+
+                auto buffer = std::make_shared<runtime::AlignedBuffer>(data_length);
+                external_data_stream.seekg(m_offset, std::ios::beg);
+                external_data_stream.read(buffer->get_ptr<char>(), data_length);
+                if (external_data_stream.fail())
+                {
+                    throw error::tensor::invalid_external_data{"cannot read " + to_string()};
+                }
+                return buffer;
+            }
+
+            std::string TensorExternalData::to_string() const
+            {
+                std::stringstream s;
+                s << "ExternalDataInfo(";
+                s << "data_full_path: " << m_data_location;
+                s << ", offset: " << m_offset;
+                s << ", data_length: " << m_data_length;
+                if (!m_sha1_digest.empty())
+                {
+                    s << ", sha1_digest: " << m_sha1_digest << ")";
+                }
+                else
+                {
+                    s << ")";
+                }
+                return s.str();
+            }
+
+            void update_external_data_paths(ONNX_NAMESPACE::ModelProto& model_proto,
+                                            const std::string& model_path)
+            {
+                const auto separator = model_path.find_last_of("/\\");
+                const std::string model_dir =
+                    separator == std::string::npos ? "" : model_path.substr(0, separator + 1);
+                update_external_data_paths(*model_proto.mutable_graph(), model_dir);
+            }
+        }
+    }
+}
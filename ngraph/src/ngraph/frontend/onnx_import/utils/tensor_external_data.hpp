@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace error
+        {
+            namespace tensor
+            {
+                struct invalid_external_data : ngraph_error
+                {
+                    explicit invalid_external_data(const std::string& description)
+                        : ngraph_error{"invalid external data: " + description}
+                    {
+                    }
+                };
+            }
+        }
+
+        namespace detail
+        {
+            /// \brief      Helper class used to load the data of a tensor stored outside of the
+            ///             ONNX model file (TensorProto.data_location == EXTERNAL).
+            class TensorExternalData
+            {
+            public:
+                explicit TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
+
+                /// \brief      Maps the tensor data from the external file into memory.
+                ///
+                /// \note       The file is memory mapped copy-on-write, so the pages are read
+                ///             only when the data is accessed and the returned buffer does not
+                ///             copy them. If the file cannot be mapped, the data is read into
+                ///             an allocated buffer instead.
+                ///
+                /// \return     A buffer with the tensor data, which keeps the mapping alive.
+                std::shared_ptr<runtime::AlignedBuffer> load_external_data() const;
+
+                /// \brief      Returns a human-readable description of the external data
+                std::string to_string() const;
+
+            private:
+                std::string m_data_location{};
+                std::size_t m_offset = 0;
+                std::size_t m_data_length = 0;
+                std::string m_sha1_digest{};
+            };
+
+            /// \brief      Makes the locations of the external data of all the tensors in the
+            ///             model relative to the directory of the model file.
+            ///
+            /// \note       The ONNX specification resolves relative locations against the
+            ///             directory of the model file, which is only known to the importer
+            ///             while the model is being read.
+            ///
+            /// \param[in]  model_proto  The model to update.
+            /// \param[in]  model_path   The path of the model file.
+            ///
+            /// \throws     error::tensor::invalid_external_data if a location is an absolute
+            ///             path or has a '..' component.
+            void update_external_data_paths(ONNX_NAMESPACE::ModelProto& model_proto,
+                                            const std::string& model_path);
+        }
+    }
+}
@@ -18,6 +18,7 @@
 #include <list>
 #include <memory>
 
+#include "ngraph/env_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -101,17 +102,54 @@ void Function::init()
 
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
+    static const bool s_check_cache = getenv_bool("NGRAPH_CHECK_ORDERED_OPS_CACHE");
+
     vector<shared_ptr<Node>> nodes;
+    vector<Node*> roots;
     for (auto& r : get_results())
     {
         nodes.push_back(r);
+        roots.push_back(r.get());
     }
     for (auto& param : get_parameters())
     {
         nodes.push_back(param);
+        roots.push_back(param.get());
+    }
+
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    size_t graph_version = Node::get_graph_version();
+    if (m_ordered_ops_valid && m_ordered_ops_graph_version == graph_version &&
+        m_ordered_ops_roots == roots)
+    {
+        // All the cached nodes are still reachable from the roots, so they are alive
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_ordered_ops.size());
+        for (Node* node : m_ordered_ops)
+        {
+            ordered_ops.push_back(node->shared_from_this());
+        }
+        if (s_check_cache)
+        {
+            NGRAPH_CHECK(ordered_ops == m_topological_sorter(nodes),
+                         "Cached topological order of ",
+                         get_friendly_name(),
+                         " differs from the actual one");
+        }
+        return ordered_ops;
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    m_ordered_ops.clear();
+    m_ordered_ops.reserve(ordered_ops.size());
+    for (auto& node : ordered_ops)
+    {
+        m_ordered_ops.push_back(node.get());
+    }
+    m_ordered_ops_roots = move(roots);
+    m_ordered_ops_graph_version = graph_version;
+    m_ordered_ops_valid = true;
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -291,5 +329,7 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
     m_topological_sorter = sorter;
+    m_ordered_ops_valid = false;
 }
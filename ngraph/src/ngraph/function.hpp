@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -93,6 +94,12 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the nodes of the function in the topological order.
+        ///
+        /// The order is cached until the arguments or the control dependencies of any node
+        /// (see Node::get_graph_version()), the results or the parameters of the function change.
+        /// With NGRAPH_CHECK_ORDERED_OPS_CACHE environment variable set the cached order is
+        /// verified against a fresh sort.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -141,5 +148,12 @@ namespace ngraph
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
+
+        // Cache of get_ordered_ops(), valid while the graph version and the roots are the same
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable bool m_ordered_ops_valid{false};
+        mutable size_t m_ordered_ops_graph_version{0};
+        mutable std::vector<Node*> m_ordered_ops_roots;
+        mutable std::vector<Node*> m_ordered_ops;
     };
 }
@@ -35,6 +35,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::s_graph_version(0);
 
 Node::Node(size_t output_size)
     : Node()
@@ -194,6 +195,7 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    update_graph_version();
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -547,6 +549,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        update_graph_version();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -580,6 +583,7 @@ void Node::transfer_control_dependents(std::shared_ptr<Node> replacement)
 
 void Node::remove_control_dependency(std::shared_ptr<Node> node)
 {
+    update_graph_version();
     {
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
@@ -598,6 +602,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
 
 void Node::clear_control_dependencies()
 {
+    update_graph_version();
     for (auto& node : m_control_dependencies)
     {
         auto it = find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this);
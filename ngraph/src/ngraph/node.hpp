@@ -309,6 +309,9 @@ namespace ngraph
         virtual bool is_dynamic() const;
         virtual bool has_state() const { return false; }
         size_t get_instance_id() const { return m_instance_id; }
+        /// \brief Returns a counter which changes on each change of the arguments or the control
+        ///        dependencies of any node, so the analyses of the graphs can be cached.
+        static size_t get_graph_version() { return s_graph_version.load(); }
         /// \brief Writes a description of a node to a stream
         /// \param os The stream; should be returned
         /// \param depth How many levels of inputs to describe
@@ -574,6 +577,8 @@ namespace ngraph
         virtual bool match_node(pattern::Matcher* matcher, const Output<Node>& graph_value);
 
     private:
+        static void update_graph_version() { s_graph_version.fetch_add(1); }
+
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
@@ -584,6 +589,7 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> s_graph_version;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
         std::deque<descriptor::Input> m_inputs;
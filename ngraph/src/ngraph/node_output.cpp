@@ -95,6 +95,7 @@ namespace ngraph
 
     void Output<Node>::remove_target_input(const Input<Node>& target_input) const
     {
+        Node::update_graph_version();
         m_node->m_outputs.at(m_index).remove_input(
             &(target_input.get_node()->m_inputs.at(target_input.get_index())));
     }
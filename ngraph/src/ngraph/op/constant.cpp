@@ -316,11 +316,28 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+    if (!m_data || m_data->size() < size)
+    {
+        throw ngraph_error("Constant buffer is smaller than the size of constant data");
+    }
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::Constant::Constant(const Constant& other)
     : Constant(other.m_element_type, other.m_shape)
 {
     m_data = other.m_data;
-    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical.load();
+    m_all_elements_bitwise_identical_checked = other.m_all_elements_bitwise_identical_checked.load();
     constructor_validate_and_infer_types();
 }
 
@@ -618,12 +635,24 @@ bool op::v0::Constant::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("element_type", m_element_type);
     visitor.on_attribute("shape", m_shape);
+    if (m_data != nullptr)
+    {
+        visitor.on_attribute("value", m_data);
+        return true;
+    }
+    // Filling in a fresh constant. The visitor either copies the data into the buffer the adapter
+    // allocates or supplies a buffer of its own, e.g. sharing memory mapped data.
+    AttributeAdapter<std::shared_ptr<runtime::AlignedBuffer>> adapter(
+        m_data, shape_size(m_shape) * m_element_type.size(), host_alignment());
+    visitor.on_adapter("value", adapter);
     if (m_data == nullptr)
     {
-        // Filling in a fresh constant
         allocate_buffer();
     }
-    visitor.on_attribute("value", m_data);
+    constructor_validate_and_infer_types();
+    // The data is scanned by the first get_all_data_elements_bitwise_identical(), so the shared
+    // data is not read while the function is loaded
+    m_all_elements_bitwise_identical_checked = false;
     return true;
 }
 
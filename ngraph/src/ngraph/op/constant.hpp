@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <sstream>
@@ -233,6 +234,16 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant which shares the supplied buffer
+                ///        instead of copying its contents
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer with the constant data, it is kept alive by the constant.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
@@ -445,6 +456,11 @@ namespace ngraph
                 bool is_constant() const override { return true; }
                 bool get_all_data_elements_bitwise_identical() const
                 {
+                    if (!m_all_elements_bitwise_identical_checked)
+                    {
+                        m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+                        m_all_elements_bitwise_identical_checked = true;
+                    }
                     return m_all_elements_bitwise_identical;
                 }
                 std::string convert_value_to_string(size_t index) const;
@@ -557,7 +573,9 @@ namespace ngraph
                 element::Type m_element_type;
                 Shape m_shape{};
                 std::shared_ptr<runtime::AlignedBuffer> m_data;
-                bool m_all_elements_bitwise_identical;
+                // Is computed on demand for the constants filled by an attribute visitor
+                mutable std::atomic<bool> m_all_elements_bitwise_identical{false};
+                mutable std::atomic<bool> m_all_elements_bitwise_identical_checked{true};
                 bool are_all_data_elements_bitwise_identical() const;
             };
 
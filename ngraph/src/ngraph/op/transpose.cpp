@@ -18,7 +18,7 @@
 
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/transpose.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -147,7 +147,7 @@ namespace
 
         out->set_shape(out_shape);
         return (INPUT_ET == arg1->get_element_type()) &&
-               (runtime::reference::reshape(arg1->get_data_ptr<INPUT_ET>(),
+               (runtime::opt_kernel::reshape(arg1->get_data_ptr<INPUT_ET>(),
                                             out->get_data_ptr<INPUT_ET>(),
                                             arg1->get_shape(),
                                             in_axis_order,
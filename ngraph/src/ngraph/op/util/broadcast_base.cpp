@@ -21,7 +21,7 @@
 #include "ngraph/op/sum.hpp"
 #include "ngraph/partial_shape.hpp"
 
-#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/opt_kernel/broadcast.hpp"
 
 #include <numeric>
 
@@ -315,7 +315,7 @@ bool op::util::BroadcastBase::evaluate(const HostTensorPtr& arg0,
                                        const AxisSet& broadcast_axes)
 {
     using T = typename element_type_traits<ET>::value_type;
-    runtime::reference::broadcast<T>((arg0->get_data_ptr<ET>()),
+    runtime::opt_kernel::broadcast<T>((arg0->get_data_ptr<ET>()),
                                      (out->get_data_ptr<ET>()),
                                      arg0->get_shape(),
                                      out->get_shape(),
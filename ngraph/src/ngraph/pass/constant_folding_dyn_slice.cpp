@@ -16,7 +16,7 @@
 
 #include "constant_folding.hpp"
 #include "ngraph/op/experimental/dyn_slice.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
 #include "ngraph/slice_plan.hpp"
@@ -54,7 +54,7 @@ shared_ptr<op::Constant> fold_constant_dyn_slice(shared_ptr<op::Constant> data,
 
     runtime::AlignedBuffer reshape_out_buffer(shape_size(plan.reshape_out_shape) * sizeof(T));
     T* reshape_out_data = reshape_out_buffer.get_ptr<T>();
-    runtime::reference::reshape<T>(slice_out_data,
+    runtime::opt_kernel::reshape<T>(slice_out_data,
                                    reshape_out_data,
                                    plan.reshape_in_shape,
                                    get_default_order(plan.reshape_in_shape.size()),
@@ -15,7 +15,10 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <map>
 #include <regex>
 #include <unordered_set>
 #include <vector>
@@ -23,6 +26,8 @@
 #include "graph_rewrite.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -60,6 +65,65 @@ using namespace ngraph;
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
+// Matchers are indexed by the type of the root node of their patterns. A node is only offered
+// to the matchers of its type and to the matchers (and handlers) which can match any node, in
+// the order of registration. So the extra passes, which run only the newly registered matchers,
+// skip the nodes those matchers can't match.
+
+namespace
+{
+    class MatcherIndex
+    {
+    public:
+        template <typename Closures>
+        explicit MatcherIndex(const Closures& closures)
+        {
+            for (size_t i = 0; i < closures.size(); i++)
+            {
+                if (closures[i].root_type)
+                {
+                    m_typed[*closures[i].root_type].push_back(i);
+                }
+                else
+                {
+                    m_any.push_back(i);
+                }
+            }
+        }
+
+        // Returns the indexes of the closures applicable to the node in the order of registration
+        const vector<size_t>& get(const Node& node)
+        {
+            auto it = m_typed.find(node.get_type_info());
+            if (it == m_typed.end())
+            {
+                return m_any;
+            }
+            if (m_any.empty())
+            {
+                return it->second;
+            }
+            m_merged.clear();
+            merge(it->second.begin(),
+                  it->second.end(),
+                  m_any.begin(),
+                  m_any.end(),
+                  back_inserter(m_merged));
+            return m_merged;
+        }
+
+    private:
+        map<DiscreteTypeInfo, vector<size_t>> m_typed;
+        vector<size_t> m_any;
+        vector<size_t> m_merged;
+    };
+
+    struct MatcherProfile
+    {
+        size_t hits = 0;
+        stopwatch timer;
+    };
+}
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
@@ -70,6 +134,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     // This check is very expensive and is only needed for experimental features, so we will hide
     // it behind an environment variable for now. TODO: Find a less expensive way to handle this.
     static bool s_rerun_dynamic_check = getenv_bool("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK");
+    static bool s_profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    map<string, MatcherProfile> profile;
     bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
     do
     {
@@ -78,14 +144,16 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
+        MatcherIndex index(matchers_to_run);
         for (auto node : f->get_ordered_ops())
         {
             if (m_enable_shape_inference)
             {
                 node->revalidate_and_infer_types();
             }
-            for (auto& closure : matchers_to_run)
+            for (size_t i : index.get(*node))
             {
+                auto& closure = matchers_to_run[i];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -94,7 +162,20 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                                     "materialized";
                     continue;
                 }
-                if (closure.handler(node))
+                bool handled = false;
+                if (s_profile_enabled)
+                {
+                    auto& matcher_profile = profile[closure.name];
+                    matcher_profile.timer.start();
+                    handled = closure.handler(node);
+                    matcher_profile.timer.stop();
+                    matcher_profile.hits += handled ? 1 : 0;
+                }
+                else
+                {
+                    handled = closure.handler(node);
+                }
+                if (handled)
                 {
                     rewritten = true;
                     // If call back may change function's is_dynamic state, we need to
@@ -110,6 +191,17 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
     } while (rewritten && m_matchers.size() > 0 && tries--);
 
+    if (s_profile_enabled)
+    {
+        for (auto& matcher_profile : profile)
+        {
+            cout << setw(7) << matcher_profile.second.timer.get_total_microseconds() << "us "
+                 << setw(7) << matcher_profile.second.timer.get_call_count() << " calls "
+                 << setw(7) << matcher_profile.second.hits << " hits " << matcher_profile.first
+                 << "\n";
+        }
+    }
+
     m_matchers.assign(original_matchers.begin(), original_matchers.end());
     return (NUM_TRIES - tries) > 1; // this means a graph was transformed
 }
@@ -150,10 +242,18 @@ bool pass::GraphRewriteBase::is_enabled(const std::string& name) const
 void pass::GraphRewriteBase::add_handler(const std::string& name,
                                          function<bool(const std::shared_ptr<Node>&)> handler,
                                          const PassPropertyMask& property)
+{
+    add_handler(name, handler, property, nullptr);
+}
+
+void pass::GraphRewriteBase::add_handler(const std::string& name,
+                                         function<bool(const std::shared_ptr<Node>&)> handler,
+                                         const PassPropertyMask& property,
+                                         const DiscreteTypeInfo* root_type)
 {
     if (is_enabled(name))
     {
-        m_matchers.push_back({name, handler, property});
+        m_matchers.push_back({name, handler, property, root_type});
         // If any matcher call back may change dynamic state, we need to
         // update the pass property.
         if (property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -167,6 +267,11 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                                      const graph_rewrite_callback& callback,
                                      const PassPropertyMask& property)
 {
+    // A pattern node which is not a pattern op only matches the nodes of its own type
+    // (see Node::match_node), so the matcher is not tried on the other nodes.
+    Node* root = m->get_pattern_value().get_node();
+    const DiscreteTypeInfo* root_type =
+        dynamic_cast<pattern::op::Pattern*>(root) ? nullptr : &root->get_type_info();
     add_handler(m->get_name(),
                 [m, callback](const std::shared_ptr<Node>& node) -> bool {
                     NGRAPH_DEBUG << "Running matcher " << m->get_name() << " on " << node;
@@ -177,7 +282,8 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                     }
                     return false;
                 },
-                property);
+                property,
+                root_type);
 }
 
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
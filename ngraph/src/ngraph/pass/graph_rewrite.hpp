@@ -49,6 +49,13 @@ public:
                      const PassPropertyMask& property);
 
 protected:
+    /// \brief Add a handler which can change only the nodes of the given type
+    /// \param root_type The type of nodes the handler is called for, nullptr for all the nodes
+    void add_handler(const std::string& name,
+                     std::function<bool(const std::shared_ptr<Node>& node)> handler,
+                     const PassPropertyMask& property,
+                     const DiscreteTypeInfo* root_type);
+
     GraphRewriteBase()
         : FunctionPass()
     {
@@ -65,6 +72,8 @@ protected:
         std::string name;
         std::function<bool(const std::shared_ptr<Node>& node)> handler;
         PassPropertyMask property;
+        // Type of the root node of the matcher's pattern, nullptr if any node can be matched
+        const DiscreteTypeInfo* root_type;
     };
     std::vector<MatchClosure> m_matchers;
 };
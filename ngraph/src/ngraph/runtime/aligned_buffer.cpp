@@ -87,9 +87,30 @@ namespace ngraph
     {
     }
 
+    AttributeAdapter<shared_ptr<runtime::AlignedBuffer>>::AttributeAdapter(
+        shared_ptr<runtime::AlignedBuffer>& value, size_t byte_size, size_t alignment)
+        : m_ref(value)
+        , m_byte_size(byte_size)
+        , m_alignment(alignment)
+    {
+    }
+
     void* AttributeAdapter<shared_ptr<runtime::AlignedBuffer>>::get_ptr()
     {
+        if (!m_ref)
+        {
+            m_ref = make_shared<runtime::AlignedBuffer>(m_byte_size, m_alignment);
+        }
         return m_ref->get_ptr();
     }
-    size_t AttributeAdapter<shared_ptr<runtime::AlignedBuffer>>::size() { return m_ref->size(); }
+    size_t AttributeAdapter<shared_ptr<runtime::AlignedBuffer>>::size()
+    {
+        return m_ref ? m_ref->size() : m_byte_size;
+    }
+
+    void AttributeAdapter<shared_ptr<runtime::AlignedBuffer>>::set(
+        const shared_ptr<runtime::AlignedBuffer>& value)
+    {
+        m_ref = value;
+    }
 }
@@ -40,7 +40,7 @@ public:
     AlignedBuffer(size_t byte_size, size_t alignment = 64);
 
     AlignedBuffer();
-    ~AlignedBuffer();
+    virtual ~AlignedBuffer();
 
     AlignedBuffer(AlignedBuffer&& other);
     AlignedBuffer& operator=(AlignedBuffer&& other);
@@ -70,6 +70,7 @@ private:
     AlignedBuffer(const AlignedBuffer&) = delete;
     AlignedBuffer& operator=(const AlignedBuffer&) = delete;
 
+protected:
     char* m_allocated_buffer;
     char* m_aligned_buffer;
     size_t m_byte_size;
@@ -83,13 +84,23 @@ namespace ngraph
     {
     public:
         AttributeAdapter(std::shared_ptr<runtime::AlignedBuffer>& value);
+        /// \brief Adapts an empty buffer of the given size, which is allocated by the first
+        /// get_ptr() unless set() supplies the buffer
+        AttributeAdapter(std::shared_ptr<runtime::AlignedBuffer>& value,
+                         size_t byte_size,
+                         size_t alignment);
         void* get_ptr() override;
         size_t size() override;
+        /// \brief Replaces the buffer instead of copying data into it, e.g. with a buffer
+        /// sharing memory mapped data
+        void set(const std::shared_ptr<runtime::AlignedBuffer>& value);
 
         static constexpr DiscreteTypeInfo type_info{
             "AttributeAdapter<std::shared_ptr<runtime::AlignedBuffer>>", 0};
         const DiscreteTypeInfo& get_type_info() const override { return type_info; }
     protected:
         std::shared_ptr<runtime::AlignedBuffer>& m_ref;
+        size_t m_byte_size = 0;
+        size_t m_alignment = 64;
     };
 }
@@ -16,9 +16,7 @@
 
 #pragma once
 
-#include <cmath>
-#include <utility>
-
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/util.hpp"
@@ -29,147 +27,6 @@ namespace ngraph
     {
         namespace opt_kernel
         {
-            template <typename T>
-            void broadcast_2d(
-                const T* in, T* out, const Shape& in_shape, const Shape& out_shape, size_t out_axis)
-            {
-                size_t index[2];
-                size_t& in_index = index[out_axis];
-                auto out_strides = row_major_strides(out_shape);
-                for (index[0] = 0; index[0] < out_shape[0]; ++index[0])
-                {
-                    for (index[1] = 0; index[1] < out_shape[1]; ++index[1])
-                    {
-                        // clang-format off
-                        out[index[0] * out_strides[0] +
-                            index[1]] =
-                                in[in_index];
-                        // clang-format on
-                    }
-                }
-            }
-
-            // #define PARALLEL
-            template <typename T>
-            void broadcast_3d(
-                const T* in, T* out, const Shape& in_shape, const Shape& out_shape, size_t out_axis)
-            {
-                size_t index[3];
-                size_t& in_index = index[out_axis];
-                auto out_strides = row_major_strides(out_shape);
-                for (index[0] = 0; index[0] < out_shape[0]; ++index[0])
-                {
-                    for (index[1] = 0; index[1] < out_shape[1]; ++index[1])
-                    {
-                        for (index[2] = 0; index[2] < out_shape[2]; ++index[2])
-                        {
-                            // clang-format off
-                            out[index[0] * out_strides[0] +
-                                index[1] * out_strides[1] +
-                                index[2]] =
-                                    in[in_index];
-                            // clang-format on
-                        }
-                    }
-                }
-            }
-
-            template <typename T>
-            void broadcast_4d(
-                const T* in, T* out, const Shape& in_shape, const Shape& out_shape, size_t out_axis)
-            {
-                size_t index[4];
-                size_t& in_index = index[out_axis];
-                auto out_strides = row_major_strides(out_shape);
-                for (index[0] = 0; index[0] < out_shape[0]; ++index[0])
-                {
-                    for (index[1] = 0; index[1] < out_shape[1]; ++index[1])
-                    {
-                        for (index[2] = 0; index[2] < out_shape[2]; ++index[2])
-                        {
-                            for (index[3] = 0; index[3] < out_shape[3]; ++index[3])
-                            {
-                                // clang-format off
-                                out[index[0] * out_strides[0] +
-                                    index[1] * out_strides[1] +
-                                    index[2] * out_strides[2] +
-                                    index[3]] =
-                                        in[in_index];
-                                // clang-format on
-                            }
-                        }
-                    }
-                }
-            }
-
-            template <typename T>
-            void broadcast_5d(
-                const T* in, T* out, const Shape& in_shape, const Shape& out_shape, size_t out_axis)
-            {
-                size_t index[5];
-                size_t& in_index = index[out_axis];
-                auto out_strides = row_major_strides(out_shape);
-                for (index[0] = 0; index[0] < out_shape[0]; ++index[0])
-                {
-                    for (index[1] = 0; index[1] < out_shape[1]; ++index[1])
-                    {
-                        for (index[2] = 0; index[2] < out_shape[2]; ++index[2])
-                        {
-                            for (index[3] = 0; index[3] < out_shape[3]; ++index[3])
-                            {
-                                for (index[4] = 0; index[4] < out_shape[4]; ++index[4])
-                                {
-                                    // clang-format off
-                                    out[index[0] * out_strides[0] +
-                                        index[1] * out_strides[1] +
-                                        index[2] * out_strides[2] +
-                                        index[3] * out_strides[3] +
-                                        index[4]] =
-                                            in[in_index];
-                                    // clang-format on
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-
-            template <typename T>
-            void broadcast_6d(
-                const T* in, T* out, const Shape& in_shape, const Shape& out_shape, size_t out_axis)
-            {
-                size_t index[6];
-                size_t& in_index = index[out_axis];
-                auto out_strides = row_major_strides(out_shape);
-                for (index[0] = 0; index[0] < out_shape[0]; ++index[0])
-                {
-                    for (index[1] = 0; index[1] < out_shape[1]; ++index[1])
-                    {
-                        for (index[2] = 0; index[2] < out_shape[2]; ++index[2])
-                        {
-                            for (index[3] = 0; index[3] < out_shape[3]; ++index[3])
-                            {
-                                for (index[4] = 0; index[4] < out_shape[4]; ++index[4])
-                                {
-                                    for (index[5] = 0; index[5] < out_shape[5]; ++index[5])
-                                    {
-                                        // clang-format off
-                                        out[index[0] * out_strides[0] +
-                                            index[1] * out_strides[1] +
-                                            index[2] * out_strides[2] +
-                                            index[3] * out_strides[3] +
-                                            index[4] * out_strides[4] +
-                                            index[5]] =
-                                                in[in_index];
-                                        // clang-format on
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-
             template <typename T>
             void broadcast(const T* in,
                            T* out,
@@ -177,36 +34,37 @@ namespace ngraph
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                if (in_shape.size() == 0)
+                // Like in the reference implementation, the unit axes of in_shape are dropped and
+                // the remaining ones are matched in order with the output axes which are neither
+                // broadcast nor of length 1. The input is then read with a zero stride along
+                // every other output axis.
+                Shape adjusted_in_shape;
+                for (auto length : in_shape)
                 {
-                    for (size_t i = 0; i < shape_size(out_shape); ++i)
+                    if (length != 1)
                     {
-                        out[i] = in[0];
+                        adjusted_in_shape.push_back(length);
                     }
                 }
-                else if (in_shape.size() == 1)
+                auto adjusted_in_strides = row_major_strides(adjusted_in_shape);
+
+                Strides in_strides(out_shape.size(), 0);
+                size_t in_axis = 0;
+                for (size_t i = 0; i < out_shape.size(); i++)
                 {
-                    size_t output_axis = 0;
-                    for (size_t i = 0; i < out_shape.size(); i++)
+                    if (broadcast_axes.count(i) == 0 && out_shape[i] != 1)
                     {
-                        if (broadcast_axes.count(i) == 0)
+                        if (in_axis < adjusted_in_shape.size())
                         {
-                            output_axis = i;
-                            break;
+                            in_strides[i] = adjusted_in_strides[in_axis];
                         }
+                        in_axis++;
                     }
-                    switch (out_shape.size())
-                    {
-                    case 2: broadcast_2d<T>(in, out, in_shape, out_shape, output_axis); break;
-                    case 3: broadcast_3d<T>(in, out, in_shape, out_shape, output_axis); break;
-                    case 4: broadcast_4d<T>(in, out, in_shape, out_shape, output_axis); break;
-                    case 5: broadcast_5d<T>(in, out, in_shape, out_shape, output_axis); break;
-                    case 6: broadcast_6d<T>(in, out, in_shape, out_shape, output_axis); break;
-                    default:
-                        runtime::reference::broadcast<T>(
-                            in, out, in_shape, out_shape, broadcast_axes);
-                        break;
-                    }
+                }
+
+                if (in_axis == adjusted_in_shape.size())
+                {
+                    strided_copy(in, out, out_shape, in_strides);
                 }
                 else
                 {
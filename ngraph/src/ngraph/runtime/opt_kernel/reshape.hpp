@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "ngraph/axis_vector.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strides.hpp"
 
 namespace ngraph
 {
@@ -26,213 +30,130 @@ namespace ngraph
     {
         namespace opt_kernel
         {
+            /// \brief Batched, cache blocked transpose of [batch, cols, rows] into
+            ///        [batch, rows, cols].
             template <typename T>
-            void reshape_in0(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
+            void transpose_2d(const T* in, T* out, size_t batch, size_t rows, size_t cols)
             {
-                *out = *in;
+                constexpr size_t block = 32;
+                size_t row_blocks = (rows + block - 1) / block;
+                parallel_for(
+                    batch * row_blocks, block * cols, [&](size_t begin, size_t end) {
+                        for (size_t item = begin; item < end; item++)
+                        {
+                            const T* src = in + item / row_blocks * rows * cols;
+                            T* dst = out + item / row_blocks * rows * cols;
+                            size_t row_begin = item % row_blocks * block;
+                            size_t row_end = std::min(rows, row_begin + block);
+                            for (size_t col_begin = 0; col_begin < cols; col_begin += block)
+                            {
+                                size_t col_end = std::min(cols, col_begin + block);
+                                for (size_t row = row_begin; row < row_end; row++)
+                                {
+                                    for (size_t col = col_begin; col < col_end; col++)
+                                    {
+                                        dst[row * cols + col] = src[col * rows + row];
+                                    }
+                                }
+                            }
+                        }
+                    });
             }
 
+            /// \brief Fills a row-major tensor of shape out_shape, taking the element at
+            ///        coordinate c from in[c[0] * in_strides[0] + c[1] * in_strides[1] + ...].
+            ///
+            /// A zero stride repeats the input along an axis, so this covers both broadcasts
+            /// and axis permutations.
             template <typename T>
-            void reshape_in1(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
+            void strided_copy(const T* in,
+                              T* out,
+                              const Shape& out_shape,
+                              const Strides& in_strides)
             {
-                size_t size[1];
-                size_t in_index[1];
-                size_t* map_index[1];
-                for (size_t i = 0; i < 1; i++)
+                if (shape_size(out_shape) == 0)
                 {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
+                    return;
                 }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    *out++ = in[*map_index[0]];
-                }
-            }
 
-            template <typename T>
-            void reshape_in2(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[2];
-                size_t in_index[2];
-                size_t* map_index[2];
-                for (size_t i = 0; i < 2; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+                // Drop the unit axes and merge every axis with the next one when together they
+                // walk the input with a single stride.
+                Shape shape;
+                Strides strides;
+                for (size_t i = 0; i < out_shape.size(); i++)
                 {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    if (out_shape[i] == 1)
                     {
-                        // clang-format off
-                        *out++ = in[*map_index[0] * in_shape[1] +
-                                    *map_index[1]];
-                        // clang-format on
+                        continue;
                     }
-                }
-            }
-
-            template <typename T>
-            void reshape_in3(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[3];
-                size_t in_index[3];
-                size_t* map_index[3];
-                for (size_t i = 0; i < 3; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    if (!shape.empty() && strides.back() == in_strides[i] * out_shape[i])
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                        {
-                            // clang-format off
-                            *out++ = in[*map_index[0] * in_shape[1] * in_shape[2] +
-                                        *map_index[1] * in_shape[2] +
-                                        *map_index[2]];
-                            // clang-format on
-                        }
+                        shape.back() *= out_shape[i];
+                        strides.back() = in_strides[i];
                     }
-                }
-            }
-
-            template <typename T>
-            void reshape_in4(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[4];
-                size_t in_index[4];
-                size_t* map_index[4];
-                for (size_t i = 0; i < 4; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    else
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                        {
-                            for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                            {
-                                // clang-format off
-                                *out++ =
-                                    in[*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                       *map_index[1] * in_shape[2] * in_shape[3] +
-                                       *map_index[2] * in_shape[3] +
-                                       *map_index[3]];
-                                // clang-format on
-                            }
-                        }
+                        shape.push_back(out_shape[i]);
+                        strides.push_back(in_strides[i]);
                     }
                 }
-            }
-
-            template <typename T>
-            void reshape_in5(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[5];
-                size_t in_index[5];
-                size_t* map_index[5];
-                for (size_t i = 0; i < 5; i++)
+                if (shape.empty())
                 {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
+                    *out = *in;
+                    return;
                 }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+
+                size_t rank = shape.size();
+                size_t inner = shape[rank - 1];
+                size_t outer = rank > 1 ? shape[rank - 2] : 0;
+                if (rank > 1 && rank < 4 && strides[rank - 2] == 1 && strides[rank - 1] == outer &&
+                    (rank == 2 || strides[0] == outer * inner))
                 {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    transpose_2d(in, out, rank == 3 ? shape[0] : 1, outer, inner);
+                    return;
+                }
+
+                size_t inner_stride = strides[rank - 1];
+                parallel_for(shape_size(shape) / inner, inner, [&](size_t begin, size_t end) {
+                    // Position an odometer over the outer axes at the first row of the range
+                    std::vector<size_t> index(rank - 1);
+                    size_t offset = 0;
+                    for (size_t i = rank - 1, row = begin; i-- > 0;)
+                    {
+                        index[i] = row % shape[i];
+                        row /= shape[i];
+                        offset += index[i] * strides[i];
+                    }
+                    T* dst = out + begin * inner;
+                    for (size_t row = begin; row < end; row++)
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                        const T* src = in + offset;
+                        if (inner_stride == 1)
                         {
-                            for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+                            std::copy(src, src + inner, dst);
+                        }
+                        else
+                        {
+                            for (size_t j = 0; j < inner; j++)
                             {
-                                for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                                {
-                                    // clang-format off
-                                    *out++ =
-                                        in[*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                           *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                           *map_index[2] * in_shape[3] * in_shape[4] +
-                                           *map_index[3] * in_shape[4] +
-                                           *map_index[4]];
-                                    // clang-format on
-                                }
+                                dst[j] = src[j * inner_stride];
                             }
                         }
-                    }
-                }
-            }
-
-            template <typename T>
-            void reshape_in6(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[6];
-                size_t in_index[6];
-                size_t* map_index[6];
-                for (size_t i = 0; i < 6; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-                    {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                        dst += inner;
+                        for (size_t i = rank - 1; i-- > 0;)
                         {
-                            for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+                            offset += strides[i];
+                            if (++index[i] < shape[i])
                             {
-                                for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                                {
-                                    for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
-                                    {
-                                        // clang-format off
-                                        *out++ = in[*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[4] * in_shape[5] +
-                                                    *map_index[5]];
-                                        // clang-format on
-                                    }
-                                }
+                                break;
                             }
+                            offset -= index[i] * strides[i];
+                            index[i] = 0;
                         }
                     }
-                }
+                });
             }
+
             template <typename T>
             void reshape(const T* in,
                          T* out,
@@ -240,17 +161,17 @@ namespace ngraph
                          const AxisVector& in_axis_order,
                          const Shape& out_shape)
             {
-                switch (in_shape.size())
+                // The output is the input with permuted axes laid out in row-major order, so
+                // out_shape only has to hold the same number of elements.
+                auto in_strides = row_major_strides(in_shape);
+                Shape permuted_shape(in_axis_order.size());
+                Strides permuted_strides(in_axis_order.size());
+                for (size_t i = 0; i < in_axis_order.size(); i++)
                 {
-                case 0: reshape_in0<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 1: reshape_in1<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 2: reshape_in2<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 3: reshape_in3<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 4: reshape_in4<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 5: reshape_in5<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 6: reshape_in6<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                default: reference::reshape(in, out, in_shape, in_axis_order, out_shape); break;
+                    permuted_shape[i] = in_shape[in_axis_order[i]];
+                    permuted_strides[i] = in_strides[in_axis_order[i]];
                 }
+                strided_copy(in, out, permuted_shape, permuted_strides);
             }
         }
     }
@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief The amount of work (roughly, elements touched or multiply-adds) every thread
+        ///        gets at least, smaller kernels are computed in the calling thread.
+        constexpr size_t parallel_min_work = 1 << 18;
+
+        /// \brief The default limit of the number of threads a single kernel is split between.
+        constexpr size_t parallel_default_max_threads = 8;
+
+        /// \brief Returns the maximum number of threads of a kernel.
+        ///
+        /// It is the number of hardware threads capped by parallel_default_max_threads or
+        /// the NGRAPH_PARALLEL_THREADS environment variable, which value 1 disables threading.
+        inline size_t parallel_max_threads()
+        {
+            static const size_t max_threads = []() {
+                size_t hardware_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+                int32_t env_threads = getenv_int("NGRAPH_PARALLEL_THREADS");
+                return env_threads > 0
+                           ? static_cast<size_t>(env_threads)
+                           : std::min(hardware_threads, parallel_default_max_threads);
+            }();
+            return max_threads;
+        }
+
+        /// \brief Is set in the threads running the subranges of a parallel_for.
+        inline bool& parallel_in_worker()
+        {
+            static thread_local bool in_worker = false;
+            return in_worker;
+        }
+
+        /// \brief Calls func(begin, end) on disjoint subranges covering [0, work_amount).
+        ///
+        /// The subranges are processed by concurrent threads if the total work is large enough
+        /// to amortize starting them, otherwise func(0, work_amount) is called in the calling
+        /// thread. The threads are not shared with the caller's thread pool, so their number is
+        /// limited by parallel_max_threads() and a call made from a worker of another
+        /// parallel_for is not split again. An exception thrown by func is rethrown in the
+        /// calling thread once all the subranges are done.
+        ///
+        /// \param work_amount The number of independent work items.
+        /// \param item_cost An estimate of the work needed for one item.
+        /// \param func The callable processing a subrange of items.
+        template <typename F>
+        void parallel_for(size_t work_amount, size_t item_cost, const F& func)
+        {
+            bool& in_worker = parallel_in_worker();
+            size_t threads =
+                in_worker
+                    ? 1
+                    : std::min(parallel_max_threads(),
+                               std::min(work_amount,
+                                        work_amount * std::max<size_t>(item_cost, 1) /
+                                            parallel_min_work));
+            if (threads <= 1)
+            {
+                if (work_amount > 0)
+                {
+                    func(size_t(0), work_amount);
+                }
+                return;
+            }
+
+            size_t chunk = (work_amount + threads - 1) / threads;
+            std::vector<std::exception_ptr> errors((work_amount + chunk - 1) / chunk);
+            std::vector<std::thread> workers;
+            workers.reserve(errors.size() - 1);
+            for (size_t i = 1; i < errors.size(); i++)
+            {
+                workers.emplace_back([&func, &errors, i, chunk, work_amount]() {
+                    parallel_in_worker() = true;
+                    try
+                    {
+                        func(i * chunk, std::min(work_amount, (i + 1) * chunk));
+                    }
+                    catch (...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                });
+            }
+            in_worker = true;
+            try
+            {
+                func(size_t(0), chunk);
+            }
+            catch (...)
+            {
+                errors[0] = std::current_exception();
+            }
+            in_worker = false;
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+            for (auto& error : errors)
+            {
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+    }
+}
@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strides.hpp"
 
 namespace ngraph
 {
@@ -63,84 +67,118 @@ namespace ngraph
                     }
                     break;
                 case op::AutoBroadcastType::NUMPY:
-                    // We'll be using CoordinateTransform to handle the broadcasting. The general
-                    // procedure is as follows:
+                    // Both args are left padded with ones to the output rank, and then read with
+                    // a zero stride along their axes of length 1. The general procedure is as
+                    // follows:
                     //
                     // (1) Left pad the shorter of the two shapes with ones.
-                    // (2) Squeeze (remove ones from) both shapes, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast both args to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     2.
+                    // (2) Compute the row-major strides of both padded shapes, and zero the
+                    //     strides of the axes of length 1.
+                    // (3) Merge every axis with the next one if neither arg needs to restart
+                    //     its walk between them, which usually leaves a short outer odometer
+                    //     and a long inner loop.
                     //
                     // Example:
                     //
-                    //    Input shape->Padded shape->Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 3, 2   ]     {2}
-                    // b: [    1, 6]   [ 1, 1, 6]    [       6]     {0,1}
+                    //    Input shape->Padded shape->Strides
+                    //    -----------  ------------  ----------
+                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 2, 1, 0]
+                    // b: [    1, 6]   [ 1, 1, 6]    [ 0, 0, 1]
                     //                   |  |  |
                     //                   v  v  v
                     //                 Output shape
                     //                 ------------
                     //                 [ 3, 2, 6]
                     {
-                        Shape arg0_padded_shape = arg0_shape;
-                        Shape arg1_padded_shape = arg1_shape;
-
-                        while (arg0_padded_shape.size() < arg1_padded_shape.size())
-                        {
-                            arg0_padded_shape.insert(arg0_padded_shape.begin(), 1);
-                        }
-
-                        while (arg1_padded_shape.size() < arg0_padded_shape.size())
+                        size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+                        Shape arg0_padded_shape(rank - arg0_shape.size(), 1);
+                        arg0_padded_shape.insert(
+                            arg0_padded_shape.end(), arg0_shape.begin(), arg0_shape.end());
+                        Shape arg1_padded_shape(rank - arg1_shape.size(), 1);
+                        arg1_padded_shape.insert(
+                            arg1_padded_shape.end(), arg1_shape.begin(), arg1_shape.end());
+                        auto arg0_padded_strides = row_major_strides(arg0_padded_shape);
+                        auto arg1_padded_strides = row_major_strides(arg1_padded_shape);
+
+                        Shape shape;
+                        Strides arg0_strides;
+                        Strides arg1_strides;
+                        for (size_t i = 0; i < rank; i++)
                         {
-                            arg1_padded_shape.insert(arg1_padded_shape.begin(), 1);
-                        }
-
-                        Shape arg0_squeezed_shape;
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg0_squeezed_axes;
-                        AxisSet arg1_squeezed_axes;
-                        Shape output_shape;
-
-                        for (size_t i = 0; i < arg0_padded_shape.size(); i++)
-                        {
-                            if (arg0_padded_shape[i] == 1)
+                            size_t length = arg0_padded_shape[i] == 1 ? arg1_padded_shape[i]
+                                                                      : arg0_padded_shape[i];
+                            size_t arg0_stride =
+                                arg0_padded_shape[i] == 1 ? 0 : arg0_padded_strides[i];
+                            size_t arg1_stride =
+                                arg1_padded_shape[i] == 1 ? 0 : arg1_padded_strides[i];
+                            if (length == 1)
                             {
-                                arg0_squeezed_axes.insert(i);
+                                continue;
                             }
-                            else
+                            if (!shape.empty() && arg0_strides.back() == arg0_stride * length &&
+                                arg1_strides.back() == arg1_stride * length)
                             {
-                                arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                            }
-
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
+                                shape.back() *= length;
+                                arg0_strides.back() = arg0_stride;
+                                arg1_strides.back() = arg1_stride;
                             }
                             else
                             {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
+                                shape.push_back(length);
+                                arg0_strides.push_back(arg0_stride);
+                                arg1_strides.push_back(arg1_stride);
                             }
-
-                            output_shape.push_back(arg0_padded_shape[i] == 1
-                                                       ? arg1_padded_shape[i]
-                                                       : arg0_padded_shape[i]);
                         }
-
-                        CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(output_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
+                        if (shape.empty())
                         {
-                            Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes);
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
+                            shape.push_back(1);
+                            arg0_strides.push_back(0);
+                            arg1_strides.push_back(0);
                         }
+
+                        size_t outer_rank = shape.size() - 1;
+                        size_t inner = shape.back();
+                        size_t arg0_inner_stride = arg0_strides.back();
+                        size_t arg1_inner_stride = arg1_strides.back();
+                        parallel_for(
+                            inner == 0 ? 0 : shape_size(shape) / inner,
+                            inner, [&](size_t begin, size_t end) {
+                                // Position an odometer over the outer axes at the first row
+                                std::vector<size_t> index(outer_rank);
+                                size_t arg0_offset = 0;
+                                size_t arg1_offset = 0;
+                                for (size_t i = outer_rank, row = begin; i-- > 0;)
+                                {
+                                    index[i] = row % shape[i];
+                                    row /= shape[i];
+                                    arg0_offset += index[i] * arg0_strides[i];
+                                    arg1_offset += index[i] * arg1_strides[i];
+                                }
+                                U* dst = out + begin * inner;
+                                for (size_t row = begin; row < end; row++)
+                                {
+                                    const T* src0 = arg0 + arg0_offset;
+                                    const T* src1 = arg1 + arg1_offset;
+                                    for (size_t j = 0; j < inner; j++)
+                                    {
+                                        dst[j] = elementwise_functor(src0[j * arg0_inner_stride],
+                                                                     src1[j * arg1_inner_stride]);
+                                    }
+                                    dst += inner;
+                                    for (size_t i = outer_rank; i-- > 0;)
+                                    {
+                                        arg0_offset += arg0_strides[i];
+                                        arg1_offset += arg1_strides[i];
+                                        if (++index[i] < shape[i])
+                                        {
+                                            break;
+                                        }
+                                        arg0_offset -= index[i] * arg0_strides[i];
+                                        arg1_offset -= index[i] * arg1_strides[i];
+                                        index[i] = 0;
+                                    }
+                                }
+                            });
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
@@ -16,13 +16,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include <cfenv>
 #include <functional>
 #include "convolution.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -56,8 +59,6 @@ namespace ngraph
                     is_quantized = true;
                 }
 
-                auto old_mode = std::fegetround();
-                std::fesetround(FE_TONEAREST);
                 // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
                 // they're right up front.
                 Shape dot_axis_sizes(reduction_axes_count);
@@ -65,6 +66,42 @@ namespace ngraph
                           arg1_shape.begin() + reduction_axes_count,
                           dot_axis_sizes.begin());
 
+                // The threads of parallel_for inherit the rounding mode of the calling thread
+                auto old_mode = std::fegetround();
+                std::fesetround(FE_TONEAREST);
+
+                if (!is_quantized)
+                {
+                    // Both arguments are row-major, so this is a [M, K] x [K, N] matrix product.
+                    // Every row of the output is accumulated over k in the same ascending order
+                    // as in the general loop below, which keeps the results bit-exact, but the
+                    // inner loop runs over contiguous columns of arg1.
+                    size_t k_size = shape_size(dot_axis_sizes);
+                    size_t m_size = shape_size(
+                        Shape(arg0_shape.begin(), arg0_shape.end() - reduction_axes_count));
+                    size_t n_size = shape_size(
+                        Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+                    parallel_for(m_size, k_size * n_size, [&](size_t begin, size_t end) {
+                        std::vector<ACCUMULATION> sums(n_size);
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            std::fill(sums.begin(), sums.end(), ACCUMULATION(0));
+                            for (size_t k = 0; k < k_size; k++)
+                            {
+                                auto a = static_cast<ACCUMULATION>(arg0[i * k_size + k]);
+                                const INPUT1* b = arg1 + k * n_size;
+                                for (size_t j = 0; j < n_size; j++)
+                                {
+                                    sums[j] = sums[j] + a * static_cast<ACCUMULATION>(b[j]);
+                                }
+                            }
+                            std::copy(sums.begin(), sums.end(), out + i * n_size);
+                        }
+                    });
+                    std::fesetround(old_mode);
+                    return;
+                }
+
                 CoordinateTransform arg0_transform(arg0_shape);
                 CoordinateTransform arg1_transform(arg1_shape);
                 CoordinateTransform output_transform(out_shape);
@@ -162,8 +199,8 @@ namespace ngraph
                             out[out_index] = sum;
                         }
                     }
-                    std::fesetround(old_mode);
                 }
+                std::fesetround(old_mode);
             }
         }
     }
@@ -20,6 +20,7 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 
 namespace ngraph
 {
@@ -61,6 +62,46 @@ namespace ngraph
     NGRAPH_API
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 
+    /// \brief Serialize a Function to a stream in the binary format
+    ///
+    /// The binary format is versioned and consists of a string table, a flat table of the ops
+    /// in topological order, the op attributes written through their AttributeVisitor and a
+    /// section with the constant data, each constant aligned to 64 bytes. It does not need the
+    /// JSON support, and a file in this format can be loaded without copying the constants.
+    /// Ops that do not support visit_attributes cannot be serialized in this format.
+    /// \param out The output stream to which the data is serialized.
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(std::ostream& out, const std::shared_ptr<ngraph::Function>& func);
+
+    /// \brief Serialize a Function to a file in the binary format
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(const std::string& path, const std::shared_ptr<ngraph::Function>& func);
+
+    /// \brief Deserialize a Function in the binary format from a buffer
+    ///
+    /// The data of the constants is not copied, the constants share the buffer, which should be
+    /// aligned to 64 bytes.
+    /// \param buffer The serialized Function
+    NGRAPH_API
+    std::shared_ptr<ngraph::Function>
+        deserialize_binary(const std::shared_ptr<runtime::AlignedBuffer>& buffer);
+
+    /// \brief Deserialize a Function in the binary format from a stream
+    /// \param in An istream to the input data
+    NGRAPH_API
+    std::shared_ptr<ngraph::Function> deserialize_binary(std::istream& in);
+
+    /// \brief Deserialize a Function in the binary format from a file
+    ///
+    /// The file is memory mapped copy-on-write and the constants refer to the mapping, so their
+    /// data is read from the disk only when it is accessed.
+    /// \param path The path to the serialized Function
+    NGRAPH_API
+    std::shared_ptr<ngraph::Function> deserialize_binary(const std::string& path);
+
     /// \brief If enabled adds output shapes to the serialized graph
     /// \param enable Set to true to enable or false otherwise
     ///
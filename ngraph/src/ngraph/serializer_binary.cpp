@@ -0,0 +1,982 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/factory.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "ngraph/serializer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The binary format
+//
+// header      Header, the offsets of the sections are relative to the start of the data
+// strings     uint32 count, then uint32 size + characters for every string. All the other
+//             sections refer to strings by their index in this table.
+// graph       The function (name, parameter and result node indices) followed by the flat
+//             table of nodes in topological order. A node has its type name and version,
+//             friendly name, inputs as (node index, output index), control dependencies,
+//             provenance tags and the location of its attributes in the attribute section.
+// attributes  For every node, the records written by its visit_attributes: uint32 name,
+//             uint8 AttributeKind, then the value. Vectors are a uint64 element count followed
+//             by the raw elements. Buffers are a uint64 offset in the constant section and a
+//             uint64 size.
+// constants   The data of the constants, each one aligned to constant_alignment bytes from the
+//             start of the data, so they can be used in place when the data is 64-byte aligned.
+//
+// Numbers are written in the byte order of the host; a file from a host with a different byte
+// order is rejected.
+
+namespace
+{
+    const char binary_magic[8] = {'N', 'G', 'R', 'A', 'P', 'H', 'B', 'F'};
+    constexpr uint32_t binary_format_version = 1;
+    constexpr uint32_t byte_order_mark = 0x01020304;
+    constexpr size_t constant_alignment = 64;
+
+    struct Header
+    {
+        char magic[8];
+        uint32_t format_version;
+        uint32_t byte_order_mark;
+        uint64_t strings_offset;
+        uint64_t strings_size;
+        uint64_t graph_offset;
+        uint64_t graph_size;
+        uint64_t attributes_offset;
+        uint64_t attributes_size;
+        uint64_t constants_offset;
+        uint64_t constants_size;
+    };
+
+    enum class AttributeKind : uint8_t
+    {
+        boolean,
+        i64,
+        f64,
+        string,
+        i8_vector,
+        i16_vector,
+        i32_vector,
+        i64_vector,
+        u8_vector,
+        u16_vector,
+        u32_vector,
+        u64_vector,
+        f32_vector,
+        f64_vector,
+        string_vector,
+        buffer
+    };
+
+    class ByteWriter
+    {
+    public:
+        void write_bytes(const void* data, size_t size)
+        {
+            m_data.append(static_cast<const char*>(data), size);
+        }
+        template <typename T>
+        void write(const T& value)
+        {
+            write_bytes(&value, sizeof(T));
+        }
+        size_t size() const { return m_data.size(); }
+        const string& data() const { return m_data; }
+    private:
+        string m_data;
+    };
+
+    class ByteReader
+    {
+    public:
+        ByteReader(const char* begin, const char* end)
+            : m_ptr(begin)
+            , m_end(end)
+        {
+        }
+        const char* read_bytes(size_t size)
+        {
+            if (size > static_cast<size_t>(m_end - m_ptr))
+            {
+                throw ngraph_error("Unexpected end of the binary serialized function");
+            }
+            const char* data = m_ptr;
+            m_ptr += size;
+            return data;
+        }
+        template <typename T>
+        T read()
+        {
+            T value;
+            memcpy(&value, read_bytes(sizeof(T)), sizeof(T));
+            return value;
+        }
+        /// \brief Reads the number of the following records, which take at least
+        ///        min_record_size bytes each, so a corrupted count is not allocated
+        uint32_t read_count(size_t min_record_size)
+        {
+            uint32_t count = read<uint32_t>();
+            if (count > static_cast<size_t>(m_end - m_ptr) / min_record_size)
+            {
+                throw ngraph_error("The binary serialized function is truncated");
+            }
+            return count;
+        }
+        bool at_end() const { return m_ptr == m_end; }
+    private:
+        const char* m_ptr;
+        const char* m_end;
+    };
+
+    class StringTable
+    {
+    public:
+        uint32_t get_id(const string& value)
+        {
+            auto it = m_ids.find(value);
+            if (it != m_ids.end())
+            {
+                return it->second;
+            }
+            uint32_t id = static_cast<uint32_t>(m_strings.size());
+            m_ids.emplace(value, id);
+            m_strings.push_back(value);
+            return id;
+        }
+        void write(ByteWriter& writer) const
+        {
+            writer.write<uint32_t>(m_strings.size());
+            for (auto& value : m_strings)
+            {
+                writer.write<uint32_t>(value.size());
+                writer.write_bytes(value.data(), value.size());
+            }
+        }
+
+    private:
+        unordered_map<string, uint32_t> m_ids;
+        vector<string> m_strings;
+    };
+
+    /// \brief Lays out the constant section. The data is only referenced, it is written to
+    /// the output at the end.
+    class ConstantSection
+    {
+    public:
+        /// \returns The offset of the data in the section
+        uint64_t add(const void* data, size_t size)
+        {
+            m_size = (m_size + constant_alignment - 1) / constant_alignment * constant_alignment;
+            m_chunks.push_back({static_cast<const char*>(data), size, m_size});
+            m_size += size;
+            return m_chunks.back().offset;
+        }
+        void write(ostream& out) const
+        {
+            const string padding(constant_alignment, '\0');
+            uint64_t position = 0;
+            for (auto& chunk : m_chunks)
+            {
+                out.write(padding.data(), chunk.offset - position);
+                out.write(chunk.data, chunk.size);
+                position = chunk.offset + chunk.size;
+            }
+        }
+        uint64_t size() const { return m_size; }
+    private:
+        struct Chunk
+        {
+            const char* data;
+            size_t size;
+            uint64_t offset;
+        };
+        vector<Chunk> m_chunks;
+        uint64_t m_size{0};
+    };
+
+    class BinaryAttributeSerializer : public AttributeVisitor
+    {
+    public:
+        BinaryAttributeSerializer(StringTable& strings,
+                                  ByteWriter& attributes,
+                                  ConstantSection& constants)
+            : m_strings(strings)
+            , m_attributes(attributes)
+            , m_constants(constants)
+        {
+        }
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            NGRAPH_CHECK(false, "Adapter ", adapter.get_type_info().name, " is not handled");
+        }
+        void on_adapter(const string& name, ValueAccessor<void*>& adapter) override
+        {
+            uint64_t offset = m_constants.add(adapter.get_ptr(), adapter.size());
+            write_record(name, AttributeKind::buffer);
+            m_attributes.write<uint64_t>(offset);
+            m_attributes.write<uint64_t>(adapter.size());
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            write_record(name, AttributeKind::boolean);
+            m_attributes.write<uint8_t>(adapter.get() ? 1 : 0);
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            write_record(name, AttributeKind::string);
+            m_attributes.write<uint32_t>(m_strings.get_id(adapter.get()));
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            write_record(name, AttributeKind::i64);
+            m_attributes.write<int64_t>(adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            write_record(name, AttributeKind::f64);
+            m_attributes.write<double>(adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::i8_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::i16_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::i32_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::i64_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::u8_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::u16_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::u32_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            write_vector(name, AttributeKind::u64_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            write_vector(name, AttributeKind::f32_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            write_vector(name, AttributeKind::f64_vector, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            const vector<string>& value = adapter.get();
+            write_record(name, AttributeKind::string_vector);
+            m_attributes.write<uint64_t>(value.size());
+            for (auto& element : value)
+            {
+                m_attributes.write<uint32_t>(m_strings.get_id(element));
+            }
+        }
+
+    protected:
+        void write_record(const string& name, AttributeKind kind)
+        {
+            m_attributes.write<uint32_t>(m_strings.get_id(name));
+            m_attributes.write<AttributeKind>(kind);
+        }
+        template <typename T>
+        void write_vector(const string& name, AttributeKind kind, const vector<T>& value)
+        {
+            write_record(name, kind);
+            m_attributes.write<uint64_t>(value.size());
+            m_attributes.write_bytes(value.data(), value.size() * sizeof(T));
+        }
+
+        StringTable& m_strings;
+        ByteWriter& m_attributes;
+        ConstantSection& m_constants;
+    };
+
+    size_t get_element_size(AttributeKind kind)
+    {
+        switch (kind)
+        {
+        case AttributeKind::i8_vector:
+        case AttributeKind::u8_vector: return 1;
+        case AttributeKind::i16_vector:
+        case AttributeKind::u16_vector: return 2;
+        case AttributeKind::i32_vector:
+        case AttributeKind::u32_vector:
+        case AttributeKind::f32_vector:
+        case AttributeKind::string_vector: return 4;
+        case AttributeKind::i64_vector:
+        case AttributeKind::u64_vector:
+        case AttributeKind::f64_vector: return 8;
+        default: break;
+        }
+        return 0;
+    }
+
+    class BinaryAttributeDeserializer : public AttributeVisitor
+    {
+    public:
+        /// Buffers refer to the constant section, which is kept alive by the constants
+        /// sharing it.
+        BinaryAttributeDeserializer(const vector<string>& strings,
+                                    const shared_ptr<runtime::AlignedBuffer>& data,
+                                    const char* constants,
+                                    size_t constants_size)
+            : m_strings(strings)
+            , m_data(data)
+            , m_constants(constants)
+            , m_constants_size(constants_size)
+        {
+        }
+
+        /// \brief Sets the attributes of the next node to visit, which are in [begin, end)
+        void set_attributes(const char* begin, const char* end)
+        {
+            m_records.clear();
+            m_next = 0;
+            ByteReader reader(begin, end);
+            while (!reader.at_end())
+            {
+                Record record;
+                record.name = &get_string(reader.read<uint32_t>());
+                record.kind = reader.read<AttributeKind>();
+                const char* value = nullptr;
+                switch (record.kind)
+                {
+                case AttributeKind::boolean: value = reader.read_bytes(1); break;
+                case AttributeKind::i64:
+                case AttributeKind::f64: value = reader.read_bytes(8); break;
+                case AttributeKind::string: value = reader.read_bytes(4); break;
+                case AttributeKind::buffer: value = reader.read_bytes(16); break;
+                default:
+                {
+                    size_t element_size = get_element_size(record.kind);
+                    if (element_size == 0)
+                    {
+                        throw ngraph_error("Unknown attribute kind in the binary serialized "
+                                           "function");
+                    }
+                    value = reader.read_bytes(8);
+                    uint64_t count;
+                    memcpy(&count, value, sizeof(count));
+                    if (count > numeric_limits<size_t>::max() / element_size)
+                    {
+                        throw ngraph_error("Unexpected end of the binary serialized function");
+                    }
+                    reader.read_bytes(count * element_size);
+                }
+                }
+                record.value = value;
+                m_records.push_back(record);
+            }
+        }
+
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            NGRAPH_CHECK(false, "Adapter ", adapter.get_type_info().name, " is not handled");
+        }
+        void on_adapter(const string& name, ValueAccessor<void*>& adapter) override
+        {
+            if (auto value = find(name, AttributeKind::buffer))
+            {
+                uint64_t offset;
+                uint64_t size;
+                memcpy(&offset, value, sizeof(offset));
+                memcpy(&size, value + sizeof(offset), sizeof(size));
+                if (offset > m_constants_size || size > m_constants_size - offset)
+                {
+                    throw ngraph_error("The data of attribute '" + name +
+                                       "' is out of the bounds of the constant section");
+                }
+                NGRAPH_CHECK(size == adapter.size(),
+                             "Attribute '",
+                             name,
+                             "' has ",
+                             size,
+                             " bytes instead of ",
+                             adapter.size());
+                const char* data = m_constants + offset;
+                auto buffer_adapter =
+                    as_type<AttributeAdapter<shared_ptr<runtime::AlignedBuffer>>>(&adapter);
+                if (buffer_adapter != nullptr &&
+                    reinterpret_cast<uintptr_t>(data) % constant_alignment == 0)
+                {
+                    // Share the data instead of copying it
+                    buffer_adapter->set(
+                        make_shared<runtime::SharedBuffer<shared_ptr<runtime::AlignedBuffer>>>(
+                            const_cast<char*>(data), size, m_data));
+                }
+                else
+                {
+                    memcpy(adapter.get_ptr(), data, size);
+                }
+            }
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            if (auto value = find(name, AttributeKind::boolean))
+            {
+                adapter.set(*value != 0);
+            }
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            if (auto value = find(name, AttributeKind::string))
+            {
+                adapter.set(read_string(value));
+            }
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            read_scalar(name, AttributeKind::i64, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            read_scalar(name, AttributeKind::f64, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            read_vector(name, AttributeKind::i8_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            read_vector(name, AttributeKind::i16_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            read_vector(name, AttributeKind::i32_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            read_vector(name, AttributeKind::i64_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            read_vector(name, AttributeKind::u8_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            read_vector(name, AttributeKind::u16_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            read_vector(name, AttributeKind::u32_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            read_vector(name, AttributeKind::u64_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            read_vector(name, AttributeKind::f32_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            read_vector(name, AttributeKind::f64_vector, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            if (auto value = find(name, AttributeKind::string_vector))
+            {
+                uint64_t count;
+                memcpy(&count, value, sizeof(count));
+                vector<string> result(count);
+                for (size_t i = 0; i < result.size(); i++)
+                {
+                    result[i] = read_string(value + sizeof(count) + i * sizeof(uint32_t));
+                }
+                adapter.set(result);
+            }
+        }
+
+    protected:
+        struct Record
+        {
+            const string* name;
+            AttributeKind kind;
+            const char* value;
+        };
+
+        const string& get_string(uint32_t id) const
+        {
+            if (id >= m_strings.size())
+            {
+                throw ngraph_error("Invalid string index in the binary serialized function");
+            }
+            return m_strings[id];
+        }
+        const string& read_string(const char* value) const
+        {
+            uint32_t id;
+            memcpy(&id, value, sizeof(id));
+            return get_string(id);
+        }
+
+        /// \brief Returns the value of the named attribute, or nullptr if it was not saved.
+        ///
+        /// The attributes are normally visited in the order they were written, so the search
+        /// starts after the last attribute found. An attribute missing from older data keeps
+        /// its default value, like in the JSON deserializer.
+        const char* find(const string& name, AttributeKind kind)
+        {
+            for (size_t i = 0; i < m_records.size(); i++)
+            {
+                const Record& record = m_records[(m_next + i) % m_records.size()];
+                if (*record.name == name)
+                {
+                    if (record.kind != kind)
+                    {
+                        throw ngraph_error("Attribute '" + name +
+                                           "' has an unexpected type in the binary serialized "
+                                           "function");
+                    }
+                    m_next = (m_next + i + 1) % m_records.size();
+                    return record.value;
+                }
+            }
+            return nullptr;
+        }
+        template <typename T>
+        void read_scalar(const string& name, AttributeKind kind, ValueAccessor<T>& adapter)
+        {
+            if (auto value = find(name, kind))
+            {
+                T result;
+                memcpy(&result, value, sizeof(T));
+                adapter.set(result);
+            }
+        }
+        template <typename T>
+        void read_vector(const string& name, AttributeKind kind, ValueAccessor<vector<T>>& adapter)
+        {
+            if (auto value = find(name, kind))
+            {
+                uint64_t count;
+                memcpy(&count, value, sizeof(count));
+                vector<T> result(count);
+                memcpy(result.data(), value + sizeof(count), result.size() * sizeof(T));
+                adapter.set(result);
+            }
+        }
+
+        const vector<string>& m_strings;
+        shared_ptr<runtime::AlignedBuffer> m_data;
+        const char* m_constants;
+        size_t m_constants_size;
+        vector<Record> m_records;
+        size_t m_next{0};
+    };
+
+    string node_id(size_t index) { return to_string(index); }
+
+    /// \brief Maps the whole file copy-on-write, or returns nullptr if it cannot be mapped
+    shared_ptr<runtime::AlignedBuffer> map_file(const string& path)
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+        HANDLE mapping_handle = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping_handle == nullptr)
+        {
+            return nullptr;
+        }
+        void* data = MapViewOfFile(mapping_handle, FILE_MAP_COPY, 0, 0, 0);
+        CloseHandle(mapping_handle);
+        if (data == nullptr)
+        {
+            return nullptr;
+        }
+        size_t size = static_cast<size_t>(file_size.QuadPart);
+        shared_ptr<void> mapping(data, [](void* ptr) { UnmapViewOfFile(ptr); });
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return nullptr;
+        }
+        struct stat file_status;
+        if (fstat(fd, &file_status) != 0 || file_status.st_size == 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+        size_t size = static_cast<size_t>(file_status.st_size);
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            return nullptr;
+        }
+        shared_ptr<void> mapping(data, [size](void* ptr) { munmap(ptr, size); });
+#endif
+        return make_shared<runtime::SharedBuffer<shared_ptr<void>>>(
+            static_cast<char*>(data), size, mapping);
+    }
+}
+
+void ngraph::serialize_binary(ostream& out, const shared_ptr<Function>& func)
+{
+    auto& factory_registry = FactoryRegistry<Node>::get();
+    StringTable strings;
+    ByteWriter graph;
+    ByteWriter attributes;
+    ConstantSection constants;
+    BinaryAttributeSerializer visitor(strings, attributes, constants);
+
+    auto ops = func->get_ordered_ops();
+    unordered_map<const Node*, uint32_t> node_index;
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        node_index[ops[i].get()] = static_cast<uint32_t>(i);
+    }
+
+    graph.write<uint32_t>(strings.get_id(func->get_friendly_name()));
+    graph.write<uint32_t>(func->get_parameters().size());
+    for (auto& parameter : func->get_parameters())
+    {
+        graph.write<uint32_t>(node_index.at(parameter.get()));
+    }
+    graph.write<uint32_t>(func->get_results().size());
+    for (auto& result : func->get_results())
+    {
+        graph.write<uint32_t>(node_index.at(result.get()));
+    }
+
+    graph.write<uint32_t>(ops.size());
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        Node& node = *ops[i];
+        const NodeTypeInfo& type_info = node.get_type_info();
+        NGRAPH_CHECK(factory_registry.has_factory(type_info),
+                     "Cannot serialize ",
+                     type_info.name,
+                     ":",
+                     type_info.version,
+                     " in the binary format, the op has no factory");
+        graph.write<uint32_t>(strings.get_id(type_info.name));
+        graph.write<uint64_t>(type_info.version);
+        graph.write<uint32_t>(strings.get_id(node.get_friendly_name()));
+
+        graph.write<uint32_t>(node.get_input_size());
+        for (auto& input : node.inputs())
+        {
+            auto source = input.get_source_output();
+            graph.write<uint32_t>(node_index.at(source.get_node()));
+            graph.write<uint32_t>(source.get_index());
+        }
+        graph.write<uint32_t>(node.get_control_dependencies().size());
+        for (auto& control_dependency : node.get_control_dependencies())
+        {
+            graph.write<uint32_t>(node_index.at(control_dependency.get()));
+        }
+        graph.write<uint32_t>(node.get_provenance_tags().size());
+        for (auto& tag : node.get_provenance_tags())
+        {
+            graph.write<uint32_t>(strings.get_id(tag));
+        }
+
+        // Attributes that refer to other nodes are written as their indices
+        visitor.register_node(ops[i], node_id(i));
+        uint64_t attributes_offset = attributes.size();
+        NGRAPH_CHECK(node.visit_attributes(visitor),
+                     "Cannot serialize ",
+                     type_info.name,
+                     ":",
+                     type_info.version,
+                     " in the binary format, the op does not support visit_attributes");
+        graph.write<uint64_t>(attributes_offset);
+        graph.write<uint64_t>(attributes.size() - attributes_offset);
+    }
+
+    ByteWriter string_table;
+    strings.write(string_table);
+
+    Header header;
+    memcpy(header.magic, binary_magic, sizeof(header.magic));
+    header.format_version = binary_format_version;
+    header.byte_order_mark = byte_order_mark;
+    header.strings_offset = sizeof(Header);
+    header.strings_size = string_table.size();
+    header.graph_offset = header.strings_offset + header.strings_size;
+    header.graph_size = graph.size();
+    header.attributes_offset = header.graph_offset + header.graph_size;
+    header.attributes_size = attributes.size();
+    header.constants_offset = (header.attributes_offset + header.attributes_size +
+                               constant_alignment - 1) /
+                              constant_alignment * constant_alignment;
+    header.constants_size = constants.size();
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(string_table.data().data(), string_table.size());
+    out.write(graph.data().data(), graph.size());
+    out.write(attributes.data().data(), attributes.size());
+    string padding(header.constants_offset - header.attributes_offset - header.attributes_size,
+                   '\0');
+    out.write(padding.data(), padding.size());
+    constants.write(out);
+}
+
+void ngraph::serialize_binary(const string& path, const shared_ptr<Function>& func)
+{
+    ofstream out(path, ios::out | ios::binary);
+    if (!out)
+    {
+        throw ngraph_error("Cannot open " + path + " for writing");
+    }
+    serialize_binary(out, func);
+}
+
+shared_ptr<Function> ngraph::deserialize_binary(const shared_ptr<runtime::AlignedBuffer>& buffer)
+{
+    const char* data = buffer->get_ptr<char>();
+    size_t size = buffer->size();
+
+    Header header;
+    if (size < sizeof(header))
+    {
+        throw ngraph_error("The binary serialized function is truncated");
+    }
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, binary_magic, sizeof(header.magic)) != 0)
+    {
+        throw ngraph_error("The data is not a binary serialized function");
+    }
+    if (header.byte_order_mark != byte_order_mark)
+    {
+        throw ngraph_error("The binary serialized function has a different byte order");
+    }
+    if (header.format_version != binary_format_version)
+    {
+        throw ngraph_error("Unsupported version " + to_string(header.format_version) +
+                           " of the binary serialized function");
+    }
+    auto section = [&](uint64_t offset, uint64_t section_size) {
+        if (offset > size || section_size > size - offset)
+        {
+            throw ngraph_error("The binary serialized function is truncated");
+        }
+        return ByteReader(data + offset, data + offset + section_size);
+    };
+
+    ByteReader string_reader = section(header.strings_offset, header.strings_size);
+    vector<string> strings(string_reader.read_count(sizeof(uint32_t)));
+    for (auto& value : strings)
+    {
+        uint32_t length = string_reader.read<uint32_t>();
+        value.assign(string_reader.read_bytes(length), length);
+    }
+    auto get_string = [&strings](uint32_t id) -> const string& {
+        if (id >= strings.size())
+        {
+            throw ngraph_error("Invalid string index in the binary serialized function");
+        }
+        return strings[id];
+    };
+
+    // Validates the ranges
+    section(header.attributes_offset, header.attributes_size);
+    section(header.constants_offset, header.constants_size);
+    const char* attributes = data + header.attributes_offset;
+    const char* constants = data + header.constants_offset;
+
+    ByteReader graph = section(header.graph_offset, header.graph_size);
+    string function_name = get_string(graph.read<uint32_t>());
+    vector<uint32_t> parameter_indices(graph.read_count(sizeof(uint32_t)));
+    for (auto& index : parameter_indices)
+    {
+        index = graph.read<uint32_t>();
+    }
+    vector<uint32_t> result_indices(graph.read_count(sizeof(uint32_t)));
+    for (auto& index : result_indices)
+    {
+        index = graph.read<uint32_t>();
+    }
+
+    // type name, version, friendly name, the counts of inputs, control dependencies and
+    // provenance tags, the offset and the size of the attributes
+    constexpr size_t min_node_size = 5 * sizeof(uint32_t) + 3 * sizeof(uint64_t);
+    auto& factory_registry = FactoryRegistry<Node>::get();
+    BinaryAttributeDeserializer visitor(strings, buffer, constants, header.constants_size);
+    vector<shared_ptr<Node>> nodes(graph.read_count(min_node_size));
+    auto get_node = [&nodes](uint32_t index) -> const shared_ptr<Node>& {
+        if (index >= nodes.size() || !nodes[index])
+        {
+            throw ngraph_error("Invalid node index in the binary serialized function");
+        }
+        return nodes[index];
+    };
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        const string& type_name = get_string(graph.read<uint32_t>());
+        uint64_t type_version = graph.read<uint64_t>();
+        Node::type_info_t type_info{type_name.c_str(), type_version};
+        shared_ptr<Node> node(factory_registry.create(type_info));
+        if (!node)
+        {
+            throw ngraph_error("Cannot deserialize " + type_name + ":" + to_string(type_version) +
+                               ", the op has no factory");
+        }
+        const string& friendly_name = get_string(graph.read<uint32_t>());
+
+        OutputVector arguments(graph.read_count(2 * sizeof(uint32_t)));
+        for (auto& argument : arguments)
+        {
+            auto& source = get_node(graph.read<uint32_t>());
+            uint32_t output_index = graph.read<uint32_t>();
+            argument = Output<Node>(source, output_index);
+        }
+        node->set_arguments(arguments);
+        uint32_t control_dependencies = graph.read<uint32_t>();
+        for (uint32_t j = 0; j < control_dependencies; j++)
+        {
+            node->add_control_dependency(get_node(graph.read<uint32_t>()));
+        }
+        uint32_t provenance_tags = graph.read<uint32_t>();
+        for (uint32_t j = 0; j < provenance_tags; j++)
+        {
+            node->add_provenance_tag(get_string(graph.read<uint32_t>()));
+        }
+
+        uint64_t attributes_offset = graph.read<uint64_t>();
+        uint64_t attributes_size = graph.read<uint64_t>();
+        if (attributes_offset > header.attributes_size ||
+            attributes_size > header.attributes_size - attributes_offset)
+        {
+            throw ngraph_error("The binary serialized function is truncated");
+        }
+        visitor.set_attributes(attributes + attributes_offset,
+                               attributes + attributes_offset + attributes_size);
+        if (!node->visit_attributes(visitor))
+        {
+            throw ngraph_error("Cannot deserialize " + type_name + ":" + to_string(type_version) +
+                               ", the op does not support visit_attributes");
+        }
+        node->set_friendly_name(friendly_name);
+        node->constructor_validate_and_infer_types();
+        visitor.register_node(node, node_id(i));
+        nodes[i] = node;
+    }
+
+    ParameterVector parameters;
+    for (auto index : parameter_indices)
+    {
+        auto parameter = as_type_ptr<op::Parameter>(get_node(index));
+        if (!parameter)
+        {
+            throw ngraph_error("A parameter of the binary serialized function is not a Parameter");
+        }
+        parameters.push_back(parameter);
+    }
+    ResultVector results;
+    for (auto index : result_indices)
+    {
+        auto result = as_type_ptr<op::Result>(get_node(index));
+        if (!result)
+        {
+            throw ngraph_error("A result of the binary serialized function is not a Result");
+        }
+        results.push_back(result);
+    }
+    return make_shared<Function>(results, parameters, function_name);
+}
+
+shared_ptr<Function> ngraph::deserialize_binary(istream& in)
+{
+    auto begin = in.tellg();
+    in.seekg(0, ios::end);
+    auto end = in.tellg();
+    in.seekg(begin);
+    if (!in || end < begin)
+    {
+        throw ngraph_error("Cannot read the binary serialized function from the stream");
+    }
+    auto buffer = make_shared<runtime::AlignedBuffer>(static_cast<size_t>(end - begin),
+                                                      constant_alignment);
+    in.read(buffer->get_ptr<char>(), end - begin);
+    if (!in)
+    {
+        throw ngraph_error("Cannot read the binary serialized function from the stream");
+    }
+    return deserialize_binary(buffer);
+}
+
+shared_ptr<Function> ngraph::deserialize_binary(const string& path)
+{
+    if (auto mapped = map_file(path))
+    {
+        return deserialize_binary(mapped);
+    }
+    ifstream in(path, ios::in | ios::binary);
+    if (!in)
+    {
+        throw ngraph_error("Cannot open " + path);
+    }
+    return deserialize_binary(in);
+}
@@ -18,6 +18,9 @@
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/reshape_elimination.hpp"
+#include "ngraph/pass/validate.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/test_tools.hpp"
 
@@ -236,3 +239,100 @@ TEST(build_graph, default_output_checks)
         FAIL() << "nullptr initialization of Output failed";
     }
 }
+
+TEST(build_graph, ordered_ops_cache)
+{
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{7});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{7});
+    auto add = make_shared<op::Add>(arg0, arg1);
+    auto neg = make_shared<op::Negative>(add);
+    auto f = make_shared<Function>(neg, ParameterVector{arg0, arg1});
+    auto fresh_sort = [&]() {
+        NodeVector roots{f->get_results().begin(), f->get_results().end()};
+        roots.insert(roots.end(), f->get_parameters().begin(), f->get_parameters().end());
+        return topological_sort(roots);
+    };
+
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, fresh_sort());
+    EXPECT_EQ(ops, f->get_ordered_ops());
+
+    // replacement of a node
+    auto abs = make_shared<op::Abs>(add);
+    replace_node(neg, abs);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, fresh_sort());
+    EXPECT_NE(find(ops.begin(), ops.end(), abs), ops.end());
+    EXPECT_EQ(find(ops.begin(), ops.end(), neg), ops.end());
+
+    // reconnection of an input
+    auto mul = make_shared<op::Multiply>(arg0, arg1);
+    abs->input(0).replace_source_output(mul);
+    EXPECT_EQ(f->get_ordered_ops(), fresh_sort());
+
+    // control dependency on a node which is not reachable otherwise
+    abs->add_control_dependency(add);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, fresh_sort());
+    EXPECT_NE(find(ops.begin(), ops.end(), add), ops.end());
+    abs->remove_control_dependency(add);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, fresh_sort());
+    EXPECT_EQ(find(ops.begin(), ops.end(), add), ops.end());
+
+    // replacement of a parameter
+    auto arg2 = make_shared<op::Parameter>(element::f32, Shape{7});
+    f->replace_parameter(1, arg2);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, fresh_sort());
+    EXPECT_EQ(find(ops.begin(), ops.end(), arg1), ops.end());
+}
+
+TEST(build_graph, DISABLED_benchmark_ordered_ops)
+{
+    constexpr size_t num_nodes = 20000;
+    constexpr size_t num_iterations = 100;
+
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{7});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{7});
+    shared_ptr<Node> node = arg0;
+    for (size_t i = 0; i < num_nodes / 2; i++)
+    {
+        node = make_shared<op::Abs>(make_shared<op::Add>(node, arg1));
+    }
+    auto f = make_shared<Function>(node, ParameterVector{arg0, arg1});
+    NodeVector roots{f->get_results().at(0), arg0, arg1};
+
+    stopwatch sort_timer;
+    sort_timer.start();
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        topological_sort(roots);
+    }
+    sort_timer.stop();
+
+    stopwatch cached_timer;
+    cached_timer.start();
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        f->get_ordered_ops();
+    }
+    cached_timer.stop();
+
+    // passes which traverse the graph without changing it
+    pass::Manager pass_manager;
+    for (size_t i = 0; i < 10; i++)
+    {
+        pass_manager.register_pass<pass::ReshapeElimination>();
+        pass_manager.register_pass<pass::Validate>();
+    }
+    stopwatch pipeline_timer;
+    pipeline_timer.start();
+    pass_manager.run_passes(f);
+    pipeline_timer.stop();
+
+    std::cout << num_iterations << " sorts of " << num_nodes << " nodes: " << std::fixed
+              << sort_timer.get_milliseconds() << " ms, cached: " << cached_timer.get_milliseconds()
+              << " ms" << std::endl;
+    std::cout << "Pass pipeline: " << pipeline_timer.get_milliseconds() << " ms" << std::endl;
+}
@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "util/type_prop.hpp"
 
 using namespace ngraph;
@@ -1389,3 +1390,30 @@ TEST(constant, bad_get_data_ptr)
         EXPECT_HAS_SUBSTRING(error.what(), std::string("get_data_ptr"));
     }
 }
+
+TEST(constant, shared_buffer)
+{
+    auto data = make_shared<vector<float>>(vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    auto buffer = make_shared<runtime::SharedBuffer<shared_ptr<vector<float>>>>(
+        reinterpret_cast<char*>(data->data()), data->size() * sizeof(float), data);
+    op::Constant c(element::f32, Shape{2, 2}, buffer);
+    EXPECT_EQ(c.get_data_ptr(), data->data());
+    EXPECT_EQ(c.get_vector<float>(), *data);
+
+    data->at(0) = 5.0f;
+    EXPECT_EQ(c.get_vector<float>()[0], 5.0f);
+
+    // The buffer keeps the data alive
+    auto ptr = data->data();
+    data.reset();
+    EXPECT_EQ(c.get_data_ptr(), ptr);
+    EXPECT_EQ(c.get_vector<float>()[3], 4.0f);
+}
+
+TEST(constant, shared_buffer_too_small)
+{
+    vector<float> data{1.0f, 2.0f};
+    auto buffer = make_shared<runtime::SharedBuffer<int>>(
+        reinterpret_cast<char*>(data.data()), data.size() * sizeof(float), 0);
+    EXPECT_THROW(op::Constant(element::f32, Shape{2, 2}, buffer), ngraph_error);
+}
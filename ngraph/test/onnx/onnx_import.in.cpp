@@ -188,6 +188,89 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_add_abc_initializers)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data)
+{
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt"));
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({12, 24, 36, 48});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_from_stream)
+{
+    const auto model_path =
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt");
+    std::ifstream model_stream{model_path, std::ios::in | std::ios::binary};
+    auto function = onnx_import::import_onnx_model(model_stream, model_path);
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({12, 24, 36, 48});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_file_not_found)
+{
+    try
+    {
+        onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_file_not_found.prototxt"));
+        FAIL() << "Expected ngraph::ngraph_error";
+    }
+    catch (const ngraph::ngraph_error& err)
+    {
+        std::string what{err.what()};
+        EXPECT_NE(what.find("not_existing_file.data"), std::string::npos);
+    }
+    catch (...)
+    {
+        FAIL() << "Expected ngraph::ngraph_error";
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_absolute_location)
+{
+    try
+    {
+        onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_absolute_location.prototxt"));
+        FAIL() << "Expected ngraph::ngraph_error";
+    }
+    catch (const ngraph::ngraph_error& err)
+    {
+        std::string what{err.what()};
+        EXPECT_NE(what.find("is an absolute path: /tmp/tensors.data"), std::string::npos);
+    }
+    catch (...)
+    {
+        FAIL() << "Expected ngraph::ngraph_error";
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_parent_location)
+{
+    // the file exists, but the data outside of the model directory is not read
+    try
+    {
+        onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_parent_location.prototxt"));
+        FAIL() << "Expected ngraph::ngraph_error";
+    }
+    catch (const ngraph::ngraph_error& err)
+    {
+        std::string what{err.what()};
+        EXPECT_NE(what.find("refers to a parent directory: ../external_data/data/tensors.data"),
+                  std::string::npos);
+    }
+    catch (...)
+    {
+        FAIL() << "Expected ngraph::ngraph_error";
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_model_override_op)
 {
     onnx_import::register_operator(
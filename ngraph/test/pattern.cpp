@@ -290,6 +290,63 @@ TEST(pattern, graph_rewrite)
     }
 }
 
+class TestDispatchGraphRewrite : public ngraph::pass::GraphRewrite
+{
+public:
+    TestDispatchGraphRewrite(map<Node*, vector<string>>& calls)
+    {
+        add_matcher("add1", make_shared<op::Add>(label(), label()), calls);
+        add_handler("any",
+                    [&calls](const std::shared_ptr<Node>& node) {
+                        calls[node.get()].push_back("any");
+                        return false;
+                    },
+                    pass::all_pass_property_off);
+        add_matcher("mul", make_shared<op::Multiply>(label(), label()), calls);
+        add_matcher("add2", make_shared<op::Add>(label(), label()), calls);
+    }
+
+private:
+    static shared_ptr<pattern::op::Label> label()
+    {
+        return make_shared<pattern::op::Label>(element::i32, Shape{});
+    }
+
+    void add_matcher(const string& name,
+                     const shared_ptr<Node>& pattern,
+                     map<Node*, vector<string>>& calls)
+    {
+        auto callback = [name, &calls](pattern::Matcher& m) {
+            calls[m.get_match_root().get()].push_back(name);
+            return false;
+        };
+        GraphRewrite::add_matcher(
+            make_shared<pattern::Matcher>(pattern, name), callback, pass::all_pass_property_off);
+    }
+};
+
+TEST(pattern, graph_rewrite_dispatch_by_type)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto sum = make_shared<op::Add>(a, b);
+    auto product = make_shared<op::Multiply>(a, b);
+    auto f = make_shared<Function>(NodeVector{sum, product}, ParameterVector{a, b});
+
+    map<Node*, vector<string>> calls;
+    pass::Manager pass_manager;
+    pass_manager.register_pass<TestDispatchGraphRewrite>(calls);
+    pass_manager.run_passes(f);
+
+    // every node is offered to the handler, the matchers are only tried on the nodes of their
+    // types, all in the order of registration
+    EXPECT_EQ(calls[sum.get()], (vector<string>{"add1", "any", "add2"}));
+    EXPECT_EQ(calls[product.get()], (vector<string>{"any", "mul"}));
+    EXPECT_EQ(calls[a.get()], (vector<string>{"any"}));
+    EXPECT_EQ(calls.size(), f->get_ops().size());
+}
+
 TEST(pattern, matcher)
 {
     Shape shape{};
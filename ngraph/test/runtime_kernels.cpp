@@ -0,0 +1,363 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cfenv>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/opt_kernel/broadcast.hpp"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    vector<float> random_floats(const Shape& shape, unsigned seed)
+    {
+        mt19937 gen(seed);
+        uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        vector<float> data(shape_size(shape));
+        for (auto& x : data)
+        {
+            x = dist(gen);
+        }
+        return data;
+    }
+
+    Shape permute(const Shape& shape, const AxisVector& order)
+    {
+        Shape permuted;
+        for (auto axis : order)
+        {
+            permuted.push_back(shape[axis]);
+        }
+        return permuted;
+    }
+
+    void check_reshape(const Shape& in_shape, const AxisVector& order)
+    {
+        auto in = random_floats(in_shape, 1);
+        auto out_shape = permute(in_shape, order);
+        vector<float> expected(in.size());
+        vector<float> actual(in.size());
+        runtime::reference::reshape(in.data(), expected.data(), in_shape, order, out_shape);
+        runtime::opt_kernel::reshape(in.data(), actual.data(), in_shape, order, out_shape);
+        EXPECT_EQ(expected, actual) << "shape " << in_shape << " order " << order;
+    }
+
+    void check_broadcast(const Shape& in_shape, const Shape& out_shape, const AxisSet& axes)
+    {
+        auto in = random_floats(in_shape, 2);
+        vector<float> expected(shape_size(out_shape));
+        vector<float> actual(shape_size(out_shape));
+        runtime::reference::broadcast(in.data(), expected.data(), in_shape, out_shape, axes);
+        runtime::opt_kernel::broadcast(in.data(), actual.data(), in_shape, out_shape, axes);
+        EXPECT_EQ(expected, actual) << "in " << in_shape << " out " << out_shape;
+    }
+}
+
+TEST(runtime_kernels, reshape_all_permutations)
+{
+    for (Shape shape : vector<Shape>{{}, {5}, {2, 3}, {2, 1, 3}, {2, 3, 4, 5}, {3, 1, 4, 1, 2}})
+    {
+        AxisVector order(shape.size());
+        iota(order.begin(), order.end(), 0);
+        do
+        {
+            check_reshape(shape, order);
+        } while (next_permutation(order.begin(), order.end()));
+    }
+}
+
+TEST(runtime_kernels, reshape_large_transposes)
+{
+    check_reshape(Shape{1000, 300}, AxisVector{1, 0});
+    check_reshape(Shape{3, 67, 129}, AxisVector{0, 2, 1});
+    check_reshape(Shape{4, 32, 23, 29}, AxisVector{0, 2, 3, 1});
+    check_reshape(Shape{4, 23, 29, 32}, AxisVector{0, 3, 1, 2});
+    check_reshape(Shape{2, 3, 4, 5, 6, 7, 8}, AxisVector{6, 0, 5, 1, 4, 2, 3});
+}
+
+TEST(runtime_kernels, broadcast)
+{
+    check_broadcast(Shape{}, Shape{4, 5}, AxisSet{0, 1});
+    check_broadcast(Shape{3}, Shape{2, 3, 4}, AxisSet{0, 2});
+    check_broadcast(Shape{3, 4}, Shape{3, 5, 4}, AxisSet{1});
+    check_broadcast(Shape{1, 3}, Shape{5, 3}, AxisSet{0});
+    check_broadcast(Shape{2, 1, 3}, Shape{2, 4, 3}, AxisSet{1});
+    check_broadcast(Shape{2, 3}, Shape{2, 1, 3, 4}, AxisSet{1, 3});
+    check_broadcast(Shape{2, 3}, Shape{0, 2, 3}, AxisSet{0});
+    check_broadcast(Shape{64, 256}, Shape{64, 32, 256}, AxisSet{1});
+    check_broadcast(Shape{7}, Shape{2, 3, 4, 5, 6, 7, 2}, AxisSet{0, 1, 2, 3, 4, 6});
+}
+
+TEST(runtime_kernels, dot_matches_naive)
+{
+    for (auto shapes : vector<pair<Shape, Shape>>{{{3, 4}, {4, 5}},
+                                                  {{2, 3, 4, 5}, {4, 5, 6}},
+                                                  {{7}, {7}},
+                                                  {{3, 0}, {0, 2}},
+                                                  {{300, 200}, {200, 150}}})
+    {
+        auto& arg0_shape = shapes.first;
+        auto& arg1_shape = shapes.second;
+        size_t reduction_axes = arg0_shape.size() == 4 ? 2 : 1;
+        size_t k_size = shape_size(Shape(arg1_shape.begin(), arg1_shape.begin() + reduction_axes));
+        size_t m_size = shape_size(arg0_shape) / max<size_t>(k_size, 1);
+        size_t n_size = shape_size(arg1_shape) / max<size_t>(k_size, 1);
+        if (k_size == 0)
+        {
+            m_size = arg0_shape[0];
+            n_size = arg1_shape[1];
+        }
+        Shape out_shape(arg0_shape.begin(), arg0_shape.end() - reduction_axes);
+        out_shape.insert(out_shape.end(), arg1_shape.begin() + reduction_axes, arg1_shape.end());
+
+        auto arg0 = random_floats(arg0_shape, 3);
+        auto arg1 = random_floats(arg1_shape, 4);
+        vector<float> expected(m_size * n_size);
+        for (size_t i = 0; i < m_size; i++)
+        {
+            for (size_t j = 0; j < n_size; j++)
+            {
+                double sum = 0;
+                for (size_t k = 0; k < k_size; k++)
+                {
+                    sum = sum + static_cast<double>(arg0[i * k_size + k]) *
+                                    static_cast<double>(arg1[k * n_size + j]);
+                }
+                expected[i * n_size + j] = sum;
+            }
+        }
+        vector<float> actual(shape_size(out_shape), 42.0f);
+        runtime::reference::dot(arg0.data(),
+                                arg1.data(),
+                                actual.data(),
+                                arg0_shape,
+                                arg1_shape,
+                                out_shape,
+                                reduction_axes);
+        EXPECT_EQ(expected, actual) << arg0_shape << " x " << arg1_shape;
+    }
+}
+
+TEST(runtime_kernels, dot_rounds_to_nearest)
+{
+    Shape arg0_shape{300, 200};
+    Shape arg1_shape{200, 150};
+    Shape out_shape{300, 150};
+    auto arg0 = random_floats(arg0_shape, 5);
+    auto arg1 = random_floats(arg1_shape, 6);
+
+    vector<float> expected(shape_size(out_shape));
+    runtime::reference::dot(
+        arg0.data(), arg1.data(), expected.data(), arg0_shape, arg1_shape, out_shape, 1);
+
+    auto old_mode = fegetround();
+    fesetround(FE_UPWARD);
+    vector<float> actual(shape_size(out_shape));
+    runtime::reference::dot(
+        arg0.data(), arg1.data(), actual.data(), arg0_shape, arg1_shape, out_shape, 1);
+    auto mode = fegetround();
+    fesetround(old_mode);
+
+    EXPECT_EQ(FE_UPWARD, mode);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(runtime_kernels, autobroadcast_numpy)
+{
+    for (auto shapes : vector<pair<Shape, Shape>>{{{3, 2, 1}, {1, 6}},
+                                                  {{4, 1, 5}, {3, 1}},
+                                                  {{}, {2, 3}},
+                                                  {{2, 3}, {2, 3}},
+                                                  {{1, 1}, {1}},
+                                                  {{0, 3}, {1, 3}},
+                                                  {{256, 1, 64}, {1, 128, 64}}})
+    {
+        auto& arg0_shape = shapes.first;
+        auto& arg1_shape = shapes.second;
+        size_t rank = max(arg0_shape.size(), arg1_shape.size());
+        Shape arg0_padded(rank - arg0_shape.size(), 1);
+        arg0_padded.insert(arg0_padded.end(), arg0_shape.begin(), arg0_shape.end());
+        Shape arg1_padded(rank - arg1_shape.size(), 1);
+        arg1_padded.insert(arg1_padded.end(), arg1_shape.begin(), arg1_shape.end());
+        Shape out_shape(rank);
+        for (size_t i = 0; i < rank; i++)
+        {
+            out_shape[i] = arg0_padded[i] == 1 ? arg1_padded[i] : arg0_padded[i];
+        }
+
+        auto arg0 = random_floats(arg0_shape, 5);
+        auto arg1 = random_floats(arg1_shape, 6);
+        vector<float> expected;
+        CoordinateTransform arg0_transform(arg0_padded);
+        CoordinateTransform arg1_transform(arg1_padded);
+        for (const Coordinate& coord : CoordinateTransform(out_shape))
+        {
+            Coordinate arg0_coord(coord);
+            Coordinate arg1_coord(coord);
+            for (size_t i = 0; i < rank; i++)
+            {
+                arg0_coord[i] = min(coord[i], arg0_padded[i] - 1);
+                arg1_coord[i] = min(coord[i], arg1_padded[i] - 1);
+            }
+            expected.push_back(arg0[arg0_transform.index(arg0_coord)] -
+                               arg1[arg1_transform.index(arg1_coord)]);
+        }
+        vector<float> actual(shape_size(out_shape));
+        runtime::reference::autobroadcast_binop(arg0.data(),
+                                                arg1.data(),
+                                                actual.data(),
+                                                arg0_shape,
+                                                arg1_shape,
+                                                op::AutoBroadcastType::NUMPY,
+                                                [](float x, float y) { return x - y; });
+        EXPECT_EQ(expected, actual) << arg0_shape << " - " << arg1_shape;
+    }
+}
+
+TEST(runtime_kernels, parallel_for_small_work_stays_in_calling_thread)
+{
+    vector<pair<size_t, size_t>> ranges;
+    vector<thread::id> threads;
+    runtime::parallel_for(1000, 10, [&](size_t begin, size_t end) {
+        ranges.emplace_back(begin, end);
+        threads.push_back(this_thread::get_id());
+    });
+    ASSERT_EQ(1, ranges.size());
+    EXPECT_EQ(make_pair(size_t(0), size_t(1000)), ranges[0]);
+    EXPECT_EQ(this_thread::get_id(), threads[0]);
+
+    ranges.clear();
+    runtime::parallel_for(0, runtime::parallel_min_work, [&](size_t begin, size_t end) {
+        ranges.emplace_back(begin, end);
+    });
+    EXPECT_TRUE(ranges.empty());
+}
+
+TEST(runtime_kernels, parallel_for_covers_range_with_limited_threads)
+{
+    const size_t work_amount = 1000;
+    mutex ranges_mutex;
+    vector<pair<size_t, size_t>> ranges;
+    runtime::parallel_for(work_amount, runtime::parallel_min_work, [&](size_t begin, size_t end) {
+        lock_guard<mutex> lock(ranges_mutex);
+        ranges.emplace_back(begin, end);
+    });
+
+    EXPECT_LE(ranges.size(), runtime::parallel_max_threads());
+    sort(ranges.begin(), ranges.end());
+    size_t next = 0;
+    for (const auto& range : ranges)
+    {
+        EXPECT_EQ(next, range.first);
+        EXPECT_LT(range.first, range.second);
+        next = range.second;
+    }
+    EXPECT_EQ(work_amount, next);
+}
+
+TEST(runtime_kernels, parallel_for_nested_call_is_not_split)
+{
+    mutex calls_mutex;
+    vector<size_t> nested_calls;
+    runtime::parallel_for(64, runtime::parallel_min_work, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            size_t calls = 0;
+            runtime::parallel_for(
+                64, runtime::parallel_min_work, [&](size_t, size_t) { calls++; });
+            lock_guard<mutex> lock(calls_mutex);
+            nested_calls.push_back(calls);
+        }
+    });
+    EXPECT_EQ(vector<size_t>(64, 1), nested_calls);
+}
+
+TEST(runtime_kernels, parallel_for_rethrows_worker_exception)
+{
+    EXPECT_THROW(runtime::parallel_for(1000,
+                                       runtime::parallel_min_work,
+                                       [](size_t, size_t end) {
+                                           if (end == 1000)
+                                           {
+                                               throw runtime_error("last range");
+                                           }
+                                       }),
+                 runtime_error);
+}
+
+TEST(runtime_kernels, DISABLED_benchmark_kernels)
+{
+    stopwatch timer;
+    auto report = [&timer](const string& name) {
+        timer.stop();
+        cout << name << ": " << timer.get_milliseconds() << "ms" << endl;
+    };
+
+    Shape nchw{8, 64, 56, 56};
+    AxisVector to_nhwc{0, 2, 3, 1};
+    auto data = random_floats(nchw, 7);
+    vector<float> out(data.size());
+    timer.start();
+    runtime::reference::reshape(data.data(), out.data(), nchw, to_nhwc, permute(nchw, to_nhwc));
+    report("reference::reshape NCHW->NHWC");
+    timer.start();
+    runtime::opt_kernel::reshape(data.data(), out.data(), nchw, to_nhwc, permute(nchw, to_nhwc));
+    report("opt_kernel::reshape NCHW->NHWC");
+
+    Shape bias{64};
+    timer.start();
+    runtime::reference::broadcast(data.data(), out.data(), bias, nchw, AxisSet{0, 2, 3});
+    report("reference::broadcast C->NCHW");
+    timer.start();
+    runtime::opt_kernel::broadcast(data.data(), out.data(), bias, nchw, AxisSet{0, 2, 3});
+    report("opt_kernel::broadcast C->NCHW");
+
+    timer.start();
+    runtime::reference::autobroadcast_binop(data.data(),
+                                            data.data(),
+                                            out.data(),
+                                            nchw,
+                                            Shape{64, 1, 1},
+                                            op::AutoBroadcastType::NUMPY,
+                                            [](float x, float y) { return x + y; });
+    report("reference::autobroadcast_binop NCHW+C11");
+
+    Shape matrix{512, 512};
+    timer.start();
+    runtime::reference::dot(
+        data.data(), data.data() + shape_size(matrix), out.data(), matrix, matrix, matrix, 1);
+    report("reference::dot 512x512x512");
+}
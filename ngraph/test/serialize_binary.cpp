@@ -0,0 +1,370 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset1.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
+#include "util/provenance_enabler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    shared_ptr<op::Constant> make_iota_constant(const Shape& shape, float start)
+    {
+        vector<float> values(shape_size(shape));
+        iota(values.begin(), values.end(), start);
+        return op::Constant::create(element::f32, shape, values);
+    }
+
+    shared_ptr<Function> make_test_function()
+    {
+        auto data = make_shared<opset1::Parameter>(element::f32, Shape{1, 3, 8, 8});
+        data->set_friendly_name("data");
+        auto conv = make_shared<opset1::Convolution>(data,
+                                                     make_iota_constant(Shape{4, 3, 3, 3}, 0),
+                                                     Strides{1, 1},
+                                                     CoordinateDiff{1, 1},
+                                                     CoordinateDiff{1, 1},
+                                                     Strides{1, 1});
+        auto bias = make_shared<opset1::Add>(conv, make_iota_constant(Shape{1, 4, 1, 1}, 1));
+        auto relu = make_shared<opset1::Relu>(bias);
+        relu->set_friendly_name("relu");
+        auto pool = make_shared<opset1::MaxPool>(
+            relu, Strides{2, 2}, Shape{0, 0}, Shape{0, 0}, Shape{2, 2}, op::RoundingType::CEIL);
+        auto split = make_shared<opset1::Split>(
+            pool, opset1::Constant::create(element::i64, Shape{}, {1}), 2);
+        auto concat = make_shared<opset1::Concat>(
+            OutputVector{split->output(1), split->output(0)}, 1);
+        auto shape = opset1::Constant::create(element::i64, Shape{2}, {0, -1});
+        auto reshape = make_shared<opset1::Reshape>(concat, shape, true);
+        auto matmul =
+            make_shared<opset1::MatMul>(reshape, make_iota_constant(Shape{10, 64}, 0), false, true);
+        auto softmax = make_shared<opset1::Softmax>(matmul, 1);
+        softmax->add_control_dependency(split);
+        softmax->add_provenance_tag("head");
+
+        auto begin = opset1::Constant::create(element::i64, Shape{2}, {0, 1});
+        auto end = opset1::Constant::create(element::i64, Shape{2}, {1, 8});
+        auto stride = opset1::Constant::create(element::i64, Shape{2}, {1, 2});
+        auto strided_slice = make_shared<opset1::StridedSlice>(softmax,
+                                                               begin,
+                                                               end,
+                                                               stride,
+                                                               vector<int64_t>{1, 0},
+                                                               vector<int64_t>{0, 0},
+                                                               vector<int64_t>{0, 0},
+                                                               vector<int64_t>{0, 0});
+        auto result = make_shared<opset1::Result>(strided_slice);
+        return make_shared<Function>(ResultVector{result}, ParameterVector{data});
+    }
+
+    string serialize_binary_to_string(const shared_ptr<Function>& f)
+    {
+        stringstream out;
+        serialize_binary(out, f);
+        return out.str();
+    }
+
+    shared_ptr<runtime::AlignedBuffer> to_buffer(const string& data)
+    {
+        auto buffer = make_shared<runtime::AlignedBuffer>(data.size());
+        memcpy(buffer->get_ptr(), data.data(), data.size());
+        return buffer;
+    }
+
+    // The data starts one byte after an aligned address, so the constants are copied
+    shared_ptr<runtime::AlignedBuffer> to_misaligned_buffer(const string& data)
+    {
+        auto storage = make_shared<runtime::AlignedBuffer>(data.size() + 1);
+        char* begin = storage->get_ptr<char>() + 1;
+        memcpy(begin, data.data(), data.size());
+        return make_shared<runtime::SharedBuffer<shared_ptr<runtime::AlignedBuffer>>>(
+            begin, data.size(), storage);
+    }
+
+    void expect_same_constants(const shared_ptr<Function>& expected,
+                               const shared_ptr<Function>& actual)
+    {
+        auto expected_ops = expected->get_ordered_ops();
+        auto actual_ops = actual->get_ordered_ops();
+        ASSERT_EQ(expected_ops.size(), actual_ops.size());
+        for (size_t i = 0; i < expected_ops.size(); i++)
+        {
+            auto expected_constant = as_type_ptr<op::Constant>(expected_ops[i]);
+            auto actual_constant = as_type_ptr<op::Constant>(actual_ops[i]);
+            ASSERT_EQ(expected_constant == nullptr, actual_constant == nullptr);
+            if (expected_constant)
+            {
+                EXPECT_EQ(expected_constant->get_value_strings(),
+                          actual_constant->get_value_strings());
+            }
+        }
+    }
+}
+
+TEST(serialize_binary, round_trip)
+{
+    auto f = make_test_function();
+    string data = serialize_binary_to_string(f);
+
+    stringstream in(data);
+    auto g = deserialize_binary(in);
+    ASSERT_TRUE(g);
+    EXPECT_EQ(g->get_friendly_name(), f->get_friendly_name());
+    EXPECT_EQ(g->get_output_element_type(0), f->get_output_element_type(0));
+    EXPECT_EQ(g->get_output_shape(0), f->get_output_shape(0));
+    ASSERT_EQ(g->get_parameters().size(), 1);
+    EXPECT_EQ(g->get_parameters()[0]->get_friendly_name(), "data");
+
+    auto softmax = g->get_results()[0]->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(is_type<opset1::Softmax>(softmax));
+    EXPECT_EQ(as_type_ptr<opset1::Softmax>(softmax)->get_axis(), 1);
+    EXPECT_EQ(softmax->get_provenance_tags(), unordered_set<string>{"head"});
+    ASSERT_EQ(softmax->get_control_dependencies().size(), 1);
+    EXPECT_TRUE(is_type<opset1::Split>(softmax->get_control_dependencies()[0]));
+    expect_same_constants(f, g);
+
+    // Everything, including the attributes, survives another round
+    EXPECT_TRUE(serialize_binary_to_string(g) == data);
+}
+
+#ifndef NGRAPH_JSON_DISABLE
+TEST(serialize_binary, same_as_json)
+{
+    // The JSON serializer drops the provenance tags unless provenance is enabled
+    test::ProvenanceEnabler provenance_enabler;
+    auto f = make_test_function();
+    auto from_json = deserialize(serialize(f));
+    EXPECT_TRUE(serialize_binary_to_string(from_json) == serialize_binary_to_string(f));
+}
+#endif
+
+TEST(serialize_binary, constants_share_buffer)
+{
+    auto f = make_test_function();
+    auto buffer = to_buffer(serialize_binary_to_string(f));
+    auto g = deserialize_binary(buffer);
+
+    const char* begin = buffer->get_ptr<char>();
+    const char* end = begin + buffer->size();
+    size_t constants = 0;
+    for (auto& node : g->get_ordered_ops())
+    {
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            auto data = static_cast<const char*>(constant->get_data_ptr());
+            EXPECT_TRUE(data >= begin && data < end);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % 64, 0);
+            constants++;
+        }
+    }
+    EXPECT_EQ(constants, 8);
+    expect_same_constants(f, g);
+}
+
+TEST(serialize_binary, file)
+{
+    const string tmp_file = "serialize_binary_file.bin";
+    auto f = make_test_function();
+    serialize_binary(tmp_file, f);
+    auto g = deserialize_binary(tmp_file);
+    ASSERT_TRUE(g);
+    expect_same_constants(f, g);
+
+    // The mapping is private, so writing to a constant does not change the file
+    shared_ptr<op::Constant> constant;
+    for (auto& node : g->get_ordered_ops())
+    {
+        if ((constant = as_type_ptr<op::Constant>(node)) &&
+            constant->get_element_type() == element::f32)
+        {
+            break;
+        }
+    }
+    ASSERT_NE(constant, nullptr);
+    *static_cast<float*>(const_cast<void*>(constant->get_data_ptr())) = 42.0f;
+    g = nullptr;
+    auto h = deserialize_binary(tmp_file);
+    file_util::remove_file(tmp_file);
+    expect_same_constants(f, h);
+}
+
+TEST(serialize_binary, unsupported_op)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto f = make_shared<Function>(make_shared<op::v0::Dot>(A, B), ParameterVector{A, B});
+    stringstream out;
+    EXPECT_THROW(serialize_binary(out, f), ngraph_error);
+}
+
+TEST(serialize_binary, invalid_data)
+{
+    string data = serialize_binary_to_string(make_test_function());
+
+    string bad_magic = data;
+    bad_magic[0] = 'X';
+    EXPECT_THROW(deserialize_binary(to_buffer(bad_magic)), ngraph_error);
+
+    EXPECT_THROW(deserialize_binary(to_buffer(data.substr(0, data.size() / 2))), ngraph_error);
+    EXPECT_THROW(deserialize_binary(to_buffer(data.substr(0, 16))), ngraph_error);
+
+    // The size of the data of the 10x64 constant is within the constant section, but does not
+    // match the shape of the constant
+    uint64_t attributes_offset;
+    uint64_t attributes_size;
+    memcpy(&attributes_offset, data.data() + 48, sizeof(attributes_offset));
+    memcpy(&attributes_size, data.data() + 56, sizeof(attributes_size));
+    const uint64_t matmul_weights_size = 10 * 64 * sizeof(float);
+    const string size_bytes(reinterpret_cast<const char*>(&matmul_weights_size),
+                            sizeof(matmul_weights_size));
+    string bad_size = data;
+    auto size_position = bad_size.find(size_bytes, attributes_offset);
+    ASSERT_LT(size_position, attributes_offset + attributes_size);
+    const uint64_t smaller_size = matmul_weights_size - sizeof(float);
+    memcpy(&bad_size[size_position], &smaller_size, sizeof(smaller_size));
+    EXPECT_THROW(deserialize_binary(to_buffer(bad_size)), ngraph_error);
+    EXPECT_THROW(deserialize_binary(to_misaligned_buffer(bad_size)), ngraph_error);
+}
+
+TEST(serialize_binary, invalid_counts)
+{
+    string data = serialize_binary_to_string(make_test_function());
+    uint64_t strings_offset;
+    uint64_t graph_offset;
+    memcpy(&strings_offset, data.data() + 16, sizeof(strings_offset));
+    memcpy(&graph_offset, data.data() + 32, sizeof(graph_offset));
+    auto read_u32 = [&data](uint64_t offset) {
+        uint32_t value;
+        memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    };
+    // A huge count is reported as truncated data rather than allocated
+    auto expect_truncated = [&data](uint64_t count_offset) {
+        string bad_count = data;
+        const uint32_t huge_count = 0xFFFFFFFF;
+        memcpy(&bad_count[count_offset], &huge_count, sizeof(huge_count));
+        try
+        {
+            deserialize_binary(to_buffer(bad_count));
+            FAIL() << "The count at " << count_offset << " is not checked";
+        }
+        catch (const ngraph_error& error)
+        {
+            EXPECT_NE(string(error.what()).find("truncated"), string::npos) << error.what();
+        }
+    };
+
+    const uint64_t parameters_offset = graph_offset + sizeof(uint32_t);
+    const uint64_t results_offset =
+        parameters_offset + sizeof(uint32_t) * (read_u32(parameters_offset) + 1);
+    const uint64_t nodes_offset = results_offset + sizeof(uint32_t) * (read_u32(results_offset) + 1);
+    // The type name, version and friendly name of the first node precede its inputs count
+    const uint64_t inputs_offset = nodes_offset + sizeof(uint32_t) + 2 * sizeof(uint32_t) +
+                                   sizeof(uint64_t);
+    for (auto count_offset :
+         {strings_offset, parameters_offset, results_offset, nodes_offset, inputs_offset})
+    {
+        expect_truncated(count_offset);
+    }
+}
+
+TEST(serialize_binary, misaligned_buffer)
+{
+    auto f = make_test_function();
+    auto g = deserialize_binary(to_misaligned_buffer(serialize_binary_to_string(f)));
+    expect_same_constants(f, g);
+}
+
+TEST(serialize_binary, bitwise_identical_constants)
+{
+    auto param = make_shared<opset1::Parameter>(element::f32, Shape{4, 16});
+    auto uniform = opset1::Constant::create(element::f32, Shape{4, 16}, {2.5f});
+    auto add = make_shared<opset1::Add>(param, uniform);
+    auto multiply = make_shared<opset1::Multiply>(add, make_iota_constant(Shape{4, 16}, 0));
+    auto f = make_shared<Function>(OutputVector{multiply}, ParameterVector{param});
+
+    auto g = deserialize_binary(to_buffer(serialize_binary_to_string(f)));
+    for (auto& node : g->get_ordered_ops())
+    {
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            EXPECT_EQ(constant->get_value_strings() == uniform->get_value_strings(),
+                      constant->get_all_data_elements_bitwise_identical());
+        }
+    }
+}
+
+TEST(serialize_binary, DISABLED_benchmark_load)
+{
+    // A stack of fully connected layers with 1M weights each
+    const size_t layers = 8;
+    const size_t width = 1024;
+    auto input = make_shared<opset1::Parameter>(element::f32, Shape{1, width});
+    Output<Node> value = input;
+    for (size_t i = 0; i < layers; i++)
+    {
+        auto weights = make_iota_constant(Shape{width, width}, 0);
+        auto matmul = make_shared<opset1::MatMul>(value, weights);
+        auto bias =
+            make_shared<opset1::Add>(matmul, make_iota_constant(Shape{1, width}, 0));
+        value = make_shared<opset1::Relu>(bias);
+    }
+    auto f = make_shared<Function>(OutputVector{value}, ParameterVector{input});
+
+    stopwatch timer;
+    auto report = [&timer](const string& name) {
+        timer.stop();
+        cout << name << ": " << timer.get_milliseconds() << "ms" << endl;
+    };
+
+    const string binary_file = "benchmark_load.bin";
+    timer.start();
+    serialize_binary(binary_file, f);
+    report("serialize_binary");
+    timer.start();
+    auto g = deserialize_binary(binary_file);
+    report("deserialize_binary, memory mapped");
+    timer.start();
+    ifstream in(binary_file, ios::in | ios::binary);
+    g = deserialize_binary(in);
+    report("deserialize_binary, stream");
+    file_util::remove_file(binary_file);
+
+#ifndef NGRAPH_JSON_DISABLE
+    const string json_file = "benchmark_load.json";
+    timer.start();
+    serialize(json_file, f);
+    report("serialize");
+    timer.start();
+    g = deserialize(json_file);
+    report("deserialize");
+    file_util::remove_file(json_file);
+#endif
+}